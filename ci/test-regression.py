@@ -28,6 +28,7 @@ parser.add_argument('--recursive-scan', action='store', dest='recursiveScan', ty
 parser.add_argument('--max-fe',         action='store', dest='maxFE',         type=int,   default=100,                       help='Maximum number of frames errors to simulate per SNR point.')                            # choices=xrange(0,   +inf)
 parser.add_argument('--weak-rate',      action='store', dest='weakRate',      type=float, default=0.8,                       help='Rate of valid SNR points to passed a test.')                                            # choices=xrange(0.0, 1.0 )
 parser.add_argument('--max-snr-time',   action='store', dest='maxSNRTime',    type=int,   default=600,                       help='The maximum amount of time to spend to compute a SNR point in seconds (0 = illimited)') # choices=xrange(0,   +inf)
+parser.add_argument('--snr-groups',     action='store', dest='snrGroups',     type=int,   default=0,                         help='Re-simulate the BFER references with the parallel SNR sweep on this number of groups (0 = disabled).') # choices=xrange(0,   +inf)
 parser.add_argument('--verbose',        action='store', dest='verbose',       type=bool,  default=False,                     help='Enable the verbose mode.')
 
 # supported file extensions (filename suffix)
@@ -39,6 +40,18 @@ extensions = ['.txt', '.perf', '.data', '.dat']
 # =============================================================================
 # =================================================================== FUNCTIONS
 
+def isSNRGroupsCompatible(argsAFFECT):
+	# the parallel SNR sweep is only available in the standard BFER simulation
+	if "--sim-type" in argsAFFECT and argsAFFECT[argsAFFECT.index("--sim-type") +1] != "BFER":
+		return False
+
+	incompatibles = ["--sim-pipeline", "--sim-err-trk", "--sim-err-trk-rev", "--sim-debug", "-d", "--sim-chkpt-path"]
+	for i in incompatibles:
+		if i in argsAFFECT:
+			return False
+
+	return True
+
 def getFileNames(currentPath, fileNames):
 	if os.path.isdir(currentPath):
 		if not os.path.exists(currentPath.replace(args.refsPath, args.resultsPath)):
@@ -96,6 +109,7 @@ print('# recursive scan =', args.recursiveScan)
 print('# max fe         =', args.maxFE        )
 print('# weak rate      =', args.weakRate     )
 print('# max snr time   =', args.maxSNRTime   )
+print('# snr groups     =', args.snrGroups    )
 print('# verbose        =', args.verbose      )
 print('#')
 
@@ -200,6 +214,10 @@ for fn in fileNames:
 	if args.maxSNRTime:
 		argsAFFECT.append("--sim-stop-time")
 		argsAFFECT.append(str(args.maxSNRTime))
+	# the parallel SNR sweep has to give the same BER/FER as the sequential one which computed the references
+	if args.snrGroups and isSNRGroupsCompatible(argsAFFECT):
+		argsAFFECT.append("--sim-snr-groups")
+		argsAFFECT.append(str(args.snrGroups))
 
 	os.chdir(args.buildPath)
 	startTime = time.time()
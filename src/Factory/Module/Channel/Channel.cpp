@@ -3,11 +3,14 @@
 #include "Module/Channel/NO/Channel_NO.hpp"
 #include "Module/Channel/User/Channel_user.hpp"
 #include "Module/Channel/AWGN/Channel_AWGN_LLR.hpp"
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_IS.hpp"
 #include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR.hpp"
 #include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR_user.hpp"
 
 #include "Tools/Algo/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp"
 #include "Tools/Algo/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Ziggurat/Gaussian_noise_generator_ziggurat.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Threefry/Gaussian_noise_generator_threefry.hpp"
 #ifdef CHANNEL_MKL
 #include "Tools/Algo/Gaussian_noise_generator/MKL/Gaussian_noise_generator_MKL.hpp"
 #endif
@@ -58,7 +61,7 @@ void Channel::parameters
 		 "type of the channel to use in the simulation.",
 		 "NO, USER, AWGN, RAYLEIGH, RAYLEIGH_USER"};
 
-	std::string implem_avail = "STD, FAST";
+	std::string implem_avail = "STD, FAST, ZIGGURAT, THREEFRY";
 #ifdef CHANNEL_GSL
 	implem_avail += ", GSL";
 #endif
@@ -68,7 +71,8 @@ void Channel::parameters
 
 	opt_args[{p+"-implem"}] =
 		{"string",
-		 "select the implementation of the algorithm to generate noise.",
+		 "select the implementation of the algorithm to generate noise (STD by default, FAST with the RAYLEIGH "
+		 "channel).",
 		 implem_avail};
 
 	opt_args[{p+"-path"}] =
@@ -77,8 +81,19 @@ void Channel::parameters
 
 	opt_args[{p+"-blk-fad"}] =
 		{"string",
-		 "block fading policy for the RAYLEIGH channel.",
-		 "NO, FRAME, ONETAP"};
+		 "block fading policy for the RAYLEIGH channel: a new gain for each symbol (NO), one gain per frame (FRAME) "
+		 "or one gain per block of \"--chn-gain-occur\" symbols (BLOCK).",
+		 "NO, FRAME, BLOCK"};
+
+	opt_args[{p+"-is"}] =
+		{"string",
+		 "importance sampling method (biased noise + weighted errors, \"--chn-type AWGN\" only).",
+		 "NO, MEAN_SHIFT, VAR_SCALING"};
+
+	opt_args[{p+"-is-bias"}] =
+		{"strictly_positive_float",
+		 "bias of the importance sampling (shift of the mean in sigma units or scaling of the standard deviation, "
+		 "0.5 and 1.2 by default)."};
 
 	opt_args[{p+"-sigma"}] =
 		{"strictly_positive_float",
@@ -98,7 +113,8 @@ void Channel::parameters
 
 	opt_args[{p+"-gain-occur"}] =
 		{"strictly_positive_int",
-		 "the number of times a gain is used on consecutive symbols (used with \"--chn-type RAYLEIGH_USER\")."};
+		 "the number of times a gain is used on consecutive symbols (used with \"--chn-type RAYLEIGH_USER\" and with "
+		 "\"--chn-blk-fad BLOCK\")."};
 }
 
 void Channel::parameters
@@ -112,10 +128,16 @@ void Channel::parameters
 	if(exist(vals, {p+"-implem"       })) this->implem       =           vals.at({p+"-implem"       });
 	if(exist(vals, {p+"-path"         })) this->path         =           vals.at({p+"-path"         });
 	if(exist(vals, {p+"-blk-fad"      })) this->block_fading =           vals.at({p+"-blk-fad"      });
+	if(exist(vals, {p+"-is"           })) this->is_method    =           vals.at({p+"-is"           });
+	if(exist(vals, {p+"-is-bias"      })) this->is_bias      = std::stof(vals.at({p+"-is-bias"      }));
 	if(exist(vals, {p+"-sigma"        })) this->sigma        = std::stof(vals.at({p+"-sigma"        }));
 	if(exist(vals, {p+"-seed",     "S"})) this->seed         = std::stoi(vals.at({p+"-seed",     "S"}));
 	if(exist(vals, {p+"-add-users"    })) this->add_users    = true;
 	if(exist(vals, {p+"-complex"      })) this->complex      = true;
+
+	// the RAYLEIGH channel draws the gains and the noise with the same generator, the fast one by default
+	if (this->type == "RAYLEIGH" && !exist(vals, {p+"-implem"}))
+		this->implem = "FAST";
 	if(exist(vals, {p+"-gain-occur"   })) this->gain_occur   = std::stoi(vals.at({p+"-gain-occur"   }));
 }
 
@@ -136,12 +158,18 @@ void Channel::parameters
 	if (this->type == "USER" || this->type == "RAYLEIGH_USER")
 		headers[p].push_back(std::make_pair("Path", this->path));
 
-	if (this->type == "RAYLEIGH_USER")
+	if (this->type == "RAYLEIGH_USER" || (this->type == "RAYLEIGH" && this->block_fading == "BLOCK"))
 		headers[p].push_back(std::make_pair("Gain occurrences", std::to_string(this->gain_occur)));
 
 	if (this->type.find("RAYLEIGH") != std::string::npos)
 		headers[p].push_back(std::make_pair("Block fading policy", this->block_fading));
 
+	if (this->is_method != "NO")
+	{
+		headers[p].push_back(std::make_pair("Importance sampling", this->is_method));
+		headers[p].push_back(std::make_pair("Importance sampling bias", std::to_string(this->get_is_bias())));
+	}
+
 	if ((this->type != "NO" && this->type != "USER") && full)
 		headers[p].push_back(std::make_pair("Seed", std::to_string(this->seed)));
 
@@ -149,24 +177,68 @@ void Channel::parameters
 	headers[p].push_back(std::make_pair("Add users", this->add_users ? "on" : "off"));
 }
 
+float Channel::parameters
+::get_is_bias() const
+{
+	if (this->is_bias > 0.f)
+		return this->is_bias;
+
+	return this->is_method == "VAR_SCALING" ? 1.2f : 0.5f;
+}
+
 template <typename R>
 module::Channel<R>* Channel::parameters
 ::build() const
 {
+	if (is_method != "NO" && is_method != "MEAN_SHIFT" && is_method != "VAR_SCALING")
+	{
+		std::stringstream message;
+		message << "Unknown importance sampling method ('is_method' = " << is_method << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (is_method != "NO" && (type != "AWGN" || add_users))
+	{
+		std::stringstream message;
+		message << "The importance sampling is only available with the AWGN channel without the users addition "
+		        << "('type' = " << type << ", 'add_users' = " << add_users << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (block_fading != "NO" && block_fading != "FRAME" && block_fading != "BLOCK")
+	{
+		std::stringstream message;
+		message << "Unknown block fading policy ('block_fading' = " << block_fading << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the number of consecutive symbols sharing the same gain in the RAYLEIGH channel
+	const auto n_symbs   = complex ? N / 2 : N;
+	const auto blk_occur = block_fading == "FRAME" ? n_symbs : block_fading == "BLOCK" ? gain_occur : 1;
+
 	tools::Gaussian_noise_generator<R>* n = nullptr;
-	     if (implem == "STD" ) n = new tools::Gaussian_noise_generator_std <R>(seed);
-	else if (implem == "FAST") n = new tools::Gaussian_noise_generator_fast<R>(seed);
+	     if (implem == "STD"     ) n = new tools::Gaussian_noise_generator_std     <R>(seed);
+	else if (implem == "FAST"    ) n = new tools::Gaussian_noise_generator_fast    <R>(seed);
+	else if (implem == "ZIGGURAT") n = new tools::Gaussian_noise_generator_ziggurat<R>(seed);
+	else if (implem == "THREEFRY") n = new tools::Gaussian_noise_generator_threefry<R>(seed);
 #ifdef CHANNEL_MKL
-	else if (implem == "MKL" ) n = new tools::Gaussian_noise_generator_MKL <R>(seed);
+	else if (implem == "MKL"     ) n = new tools::Gaussian_noise_generator_MKL     <R>(seed);
 #endif
 #ifdef CHANNEL_GSL
-	else if (implem == "GSL" ) n = new tools::Gaussian_noise_generator_GSL <R>(seed);
+	else if (implem == "GSL"     ) n = new tools::Gaussian_noise_generator_GSL     <R>(seed);
 #endif
 	else
 		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 
+	if (type == "AWGN" && is_method != "NO")
+	{
+		using C = module::Channel_AWGN_LLR_IS<R>;
+		const auto method = is_method == "MEAN_SHIFT" ? C::MEAN_SHIFT : C::VARIANCE_SCALING;
+		return new C(N, method, (R)get_is_bias(), n, sigma, n_frames);
+	}
+
 	     if (type == "AWGN"         ) return new module::Channel_AWGN_LLR         <R>(N,                            n, add_users, sigma, n_frames);
-	else if (type == "RAYLEIGH"     ) return new module::Channel_Rayleigh_LLR     <R>(N, complex,                   n, add_users, sigma, n_frames);
+	else if (type == "RAYLEIGH"     ) return new module::Channel_Rayleigh_LLR     <R>(N, complex,                   n, add_users, sigma, n_frames, blk_occur);
 	else if (type == "RAYLEIGH_USER") return new module::Channel_Rayleigh_LLR_user<R>(N, complex, path, gain_occur, n, add_users, sigma, n_frames);
 	else
 	{
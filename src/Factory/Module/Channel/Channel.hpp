@@ -27,12 +27,14 @@ struct Channel : public Factory
 		std::string implem       = "STD";
 		std::string path         = "";
 		std::string block_fading = "NO";
+		std::string is_method    = "NO";
 		bool        add_users    = false;
 		bool        complex      = false;
 		int         n_frames     = 1;
 		int         seed         = 0;
 		int         gain_occur   = 1;
 		float       sigma        = -1.f;
+		float       is_bias      = 0.f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Channel_prefix);
@@ -44,6 +46,9 @@ struct Channel : public Factory
 		void store          (const arg_val_map &vals                                           );
 		void get_headers    (std::map<std::string,header_list>& headers, const bool full = true) const;
 
+		// the bias of the importance sampling (the default value of the method if "is_bias" is not set)
+		float get_is_bias() const;
+
 		// builder
 		template <typename R = float>
 		module::Channel<R>* build() const;
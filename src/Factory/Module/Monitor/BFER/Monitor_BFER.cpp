@@ -1,3 +1,5 @@
+#include <sstream>
+
 #include "Tools/Exception/exception.hpp"
 
 #include "Module/Monitor/BFER/Monitor_BFER.hpp"
@@ -45,6 +47,20 @@ void Monitor_BFER::parameters
 	opt_args[{p+"-max-fe", "e"}] =
 		{"strictly_positive_int",
 		 "max number of frame errors for each SNR simulation."};
+
+	opt_args[{p+"-ci"}] =
+		{"string",
+		 "stop a SNR point before the max number of frame errors when the confidence interval of the FER is narrow "
+		 "enough (see --mnt-ci-prec).",
+		 "NO, WILSON, CLOPPER_PEARSON"};
+
+	opt_args[{p+"-ci-prec"}] =
+		{"strictly_positive_float",
+		 "target half-width of the confidence interval, relatively to the FER (0.1 for +/- 10%)."};
+
+	opt_args[{p+"-ci-conf"}] =
+		{"strictly_positive_float",
+		 "confidence level of the interval (0.95 for 95%)."};
 }
 
 void Monitor_BFER::parameters
@@ -57,6 +73,9 @@ void Monitor_BFER::parameters
 	if(exist(vals, {p+"-size",   "K"})) this->size           = std::stoi(vals.at({p+"-size",   "K"}));
 	if(exist(vals, {p+"-fra",    "F"})) this->n_frames       = std::stoi(vals.at({p+"-fra",    "F"}));
 	if(exist(vals, {p+"-max-fe", "e"})) this->n_frame_errors = std::stoi(vals.at({p+"-max-fe", "e"}));
+	if(exist(vals, {p+"-ci"         })) this->ci_method      =           vals.at({p+"-ci"         });
+	if(exist(vals, {p+"-ci-prec"    })) this->ci_precision   = std::stof(vals.at({p+"-ci-prec"    }));
+	if(exist(vals, {p+"-ci-conf"    })) this->ci_confidence  = std::stof(vals.at({p+"-ci-conf"    }));
 }
 
 void Monitor_BFER::parameters
@@ -67,6 +86,13 @@ void Monitor_BFER::parameters
 	auto p = this->get_prefix();
 
 	headers[p].push_back(std::make_pair("Frame error count (e)", std::to_string(this->n_frame_errors)));
+	if (this->ci_method != "NO")
+	{
+		std::stringstream ci;
+		ci << this->ci_method << " (+/- " << this->ci_precision * 100.f << "% at " << this->ci_confidence * 100.f
+		   << "%)";
+		headers[p].push_back(std::make_pair("FER confidence interval", ci.str()));
+	}
 	if (full) headers[p].push_back(std::make_pair("Size (K)", std::to_string(this->size)));
 	if (full) headers[p].push_back(std::make_pair("Inter frame level", std::to_string(this->n_frames)));
 }
@@ -75,7 +101,13 @@ template <typename B>
 module::Monitor_BFER<B>* Monitor_BFER::parameters
 ::build() const
 {
-	if (this->type == "STD") return new module::Monitor_BFER<B>(this->size, this->n_frame_errors, this->n_frames);
+	auto ci = module::Monitor_BFER<B>::CI_NO;
+	     if (this->ci_method == "WILSON"         ) ci = module::Monitor_BFER<B>::CI_WILSON;
+	else if (this->ci_method == "CLOPPER_PEARSON") ci = module::Monitor_BFER<B>::CI_CLOPPER_PEARSON;
+	else if (this->ci_method != "NO"             ) throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+
+	if (this->type == "STD") return new module::Monitor_BFER<B>(this->size, this->n_frame_errors, this->n_frames, ci,
+	                                                            this->ci_precision, this->ci_confidence);
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -26,6 +26,9 @@ struct Monitor_BFER : public Factory
 		std::string type           = "STD";
 		int         n_frame_errors = 100;
 		int         n_frames       = 1;
+		std::string ci_method      = "NO";
+		float       ci_precision   = 0.1f;
+		float       ci_confidence  = 0.95f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Monitor_BFER_prefix);
@@ -46,6 +46,20 @@ void Monitor_EXIT::parameters
 	opt_args[{p+"-trials", "n"}] =
 		{"strictly_positive_int",
 		 "number of frames to simulate per sigma A value."};
+
+	opt_args[{p+"-mi"}] =
+		{"string",
+		 "estimator of the extrinsic mutual information (histogram of the LLRs or average of 1-log2(1+e^-x), the "
+		 "latter requires consistent LLRs).",
+		 "HISTO, AVG"};
+
+	opt_args[{p+"-mi-bins"}] =
+		{"strictly_positive_int",
+		 "number of bins of the LLR histogram."};
+
+	opt_args[{p+"-mi-max"}] =
+		{"strictly_positive_float",
+		 "range of the LLR histogram (the values out of [-max, max] are counted in two extra bins)."};
 }
 
 void Monitor_EXIT::parameters
@@ -55,9 +69,12 @@ void Monitor_EXIT::parameters
 
 	auto p = this->get_prefix();
 
-	if(exist(vals, {p+"-size",   "K"})) this->size     = std::stoi(vals.at({p+"-size",   "K"}));
-	if(exist(vals, {p+"-fra",    "F"})) this->n_frames = std::stoi(vals.at({p+"-fra",    "F"}));
-	if(exist(vals, {p+"-trials", "n"})) this->n_trials = std::stoi(vals.at({p+"-trials", "n"}));
+	if(exist(vals, {p+"-size",   "K"})) this->size       = std::stoi(vals.at({p+"-size",   "K"}));
+	if(exist(vals, {p+"-fra",    "F"})) this->n_frames   = std::stoi(vals.at({p+"-fra",    "F"}));
+	if(exist(vals, {p+"-trials", "n"})) this->n_trials   = std::stoi(vals.at({p+"-trials", "n"}));
+	if(exist(vals, {p+"-mi"         })) this->mi_method  =           vals.at({p+"-mi"         });
+	if(exist(vals, {p+"-mi-bins"    })) this->mi_bins    = std::stoi(vals.at({p+"-mi-bins"    }));
+	if(exist(vals, {p+"-mi-max"     })) this->mi_llr_max = std::stof(vals.at({p+"-mi-max"     }));
 }
 
 void Monitor_EXIT::parameters
@@ -68,6 +85,10 @@ void Monitor_EXIT::parameters
 	auto p = this->get_prefix();
 
 	headers[p].push_back(std::make_pair("Number of trials", std::to_string(this->n_trials)));
+	headers[p].push_back(std::make_pair("Mutual information", this->mi_method));
+	if (this->mi_method == "HISTO")
+		headers[p].push_back(std::make_pair("Histogram bins", std::to_string(this->mi_bins)));
+	if (full) headers[p].push_back(std::make_pair("LLR max", std::to_string(this->mi_llr_max)));
 	if (full) headers[p].push_back(std::make_pair("Size (K)", std::to_string(this->size)));
 	if (full) headers[p].push_back(std::make_pair("Inter frame level", std::to_string(this->n_frames)));
 }
@@ -76,7 +97,18 @@ template <typename B, typename R>
 module::Monitor_EXIT<B,R>* Monitor_EXIT::parameters
 ::build() const
 {
-	if (this->type == "STD") return new module::Monitor_EXIT<B,R>(this->size, this->n_trials, this->n_frames);
+	if (this->mi_method != "HISTO" && this->mi_method != "AVG")
+	{
+		std::stringstream message;
+		message << "Unknown mutual information estimator ('mi_method' = " << this->mi_method << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	using M = module::Monitor_EXIT<B,R>;
+	const auto method = this->mi_method == "HISTO" ? M::HISTOGRAM : M::AVERAGE;
+
+	if (this->type == "STD") return new M(this->size, this->n_trials, this->n_frames, method, this->mi_bins,
+	                                      (R)this->mi_llr_max);
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -23,9 +23,12 @@ struct Monitor_EXIT : public Factory
 		int         size     = 0;
 
 		// optional parameters
-		std::string type     = "STD";
-		int         n_trials = 200;
-		int         n_frames = 1;
+		std::string type       = "STD";
+		std::string mi_method  = "HISTO";
+		int         n_trials   = 200;
+		int         n_frames   = 1;
+		int         mi_bins    = 2048;
+		float       mi_llr_max = 64.f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Monitor_EXIT_prefix);
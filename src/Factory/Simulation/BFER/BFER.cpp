@@ -121,9 +121,25 @@ void BFER::parameters
 		{"positive_int",
 		 "dump only frames with a bit error count above or equal to this threshold."};
 
+	opt_args[{p+"-err-trk-half"}] =
+		{"",
+		 "store the noise of the bad frames in half precision (smaller files but the replayed noise is rounded)."};
+
 	opt_args[{p+"-coded"}] =
 		{"",
 		 "enable the coded monitoring (extends the monitored bits to the entire codeword)."};
+
+	opt_args[{p+"-chkpt-path"}] =
+		{"string",
+		 "path of the file where the state of the simulation is periodically saved (disabled if empty)."};
+
+	opt_args[{p+"-chkpt-freq"}] =
+		{"strictly_positive_int",
+		 "time in sec between two checkpoints."};
+
+	opt_args[{p+"-resume"}] =
+		{"",
+		 "resume the simulation from the file given by \"--sim-chkpt-path\" (if it exists)."};
 }
 
 void BFER::parameters
@@ -142,14 +158,15 @@ void BFER::parameters
 	if(exist(vals, {p+"-err-trk-thold"  })) this->err_track_threshold = std::stoi(vals.at({p+"-err-trk-thold"}));
 	if(exist(vals, {p+"-err-trk-rev"    })) this->err_track_revert    = true;
 	if(exist(vals, {p+"-err-trk"        })) this->err_track_enable    = true;
+	if(exist(vals, {p+"-err-trk-half"   })) this->err_track_half      = true;
 	if(exist(vals, {p+"-coset",      "c"})) this->coset               = true;
 	if(exist(vals, {p+"-coded",         })) this->coded_monitoring    = true;
+	if(exist(vals, {p+"-chkpt-path"     })) this->chkpt_path          =           vals.at({p+"-chkpt-path"   });
+	if(exist(vals, {p+"-resume"         })) this->chkpt_resume        = true;
+	if(exist(vals, {p+"-chkpt-freq"     })) this->chkpt_freq = std::chrono::seconds(std::stoi(vals.at({p+"-chkpt-freq"})));
 
 	if (this->err_track_revert)
-	{
 		this->err_track_enable = false;
-		this->n_threads = 1;
-	}
 }
 
 void BFER::parameters
@@ -172,12 +189,22 @@ void BFER::parameters
 	if (this->err_track_threshold)
 		headers[p].push_back(std::make_pair("Bad frames threshold", std::to_string(this->err_track_threshold)));
 
+	if (this->err_track_enable)
+		headers[p].push_back(std::make_pair("Bad frames noise precision", this->err_track_half ? "half" : "full"));
+
 	if (this->err_track_enable || this->err_track_revert)
 	{
 		std::string path = this->err_track_path + std::string("_$snr.[src,enc,chn]");
 		headers[p].push_back(std::make_pair("Bad frames base path", path));
 	}
 
+	if (!this->chkpt_path.empty())
+	{
+		headers[p].push_back(std::make_pair("Checkpoint path", this->chkpt_path));
+		headers[p].push_back(std::make_pair("Checkpoint frequency (s)", std::to_string(this->chkpt_freq.count())));
+		headers[p].push_back(std::make_pair("Resume", this->chkpt_resume ? "on" : "off"));
+	}
+
 	if (this->src != nullptr && this->cdc != nullptr)
 	{
 		const auto bit_rate = (float)this->src->K / (float)this->cdc->N;
@@ -2,6 +2,7 @@
 #define FACTORY_SIMULATION_BFER_HPP_
 
 #include <string>
+#include <chrono>
 
 #include "Factory/Module/Channel/Channel.hpp"
 #include "Factory/Module/CRC/CRC.hpp"
@@ -32,8 +33,13 @@ struct BFER : Simulation
 		int         err_track_threshold = 0;
 		bool        err_track_revert    = false;
 		bool        err_track_enable    = false;
+		bool        err_track_half      = false;
 		bool        coset               = false;
 		bool        coded_monitoring    = false;
+		std::string chkpt_path          = "";
+		bool        chkpt_resume        = false;
+
+		std::chrono::seconds chkpt_freq = std::chrono::seconds(600);
 
 		// module parameters
 		Source       ::parameters *src = nullptr;
@@ -1,3 +1,6 @@
+#include <iomanip>
+#include <sstream>
+
 #include "Simulation/BFER/Standard/SystemC/SC_BFER_std.hpp"
 #include "Simulation/BFER/Standard/Threads/BFER_std_threads.hpp"
 
@@ -43,18 +46,107 @@ void BFER_std::parameters
 ::get_description(arg_map &req_args, arg_map &opt_args) const
 {
 	BFER::parameters::get_description(req_args, opt_args);
+
+	auto p = this->get_prefix();
+
+	opt_args[{p+"-pipeline"}] =
+		{"positive_int",
+		 "enable the pipeline mode with this number of threads dedicated to the frames generation (source, encoder, "
+		 "modem and channel), the other threads (--sim-threads) only decode."};
+
+	opt_args[{p+"-snr-groups"}] =
+		{"positive_int",
+		 "simulate this number of SNR points at the same time on groups of threads, the threads of a finished point "
+		 "move to the next point or help the slowest ones."};
+
+	opt_args[{p+"-crn"}] =
+		{"",
+		 "simulate all the SNR points in a single pass with common random numbers: each frame is generated once with "
+		 "a unit-variance noise which is scaled and decoded for each SNR point (AWGN channel only)."};
+
+	opt_args[{p+"-cbrng"}] =
+		{"",
+		 "use counter-based random generators (Threefry) for the source, the channel and the uniform interleaver: "
+		 "the frames only depend on the seed and on their index, the results do not depend on the number of threads "
+		 "anymore."};
+
+	opt_args[{p+"-fused"}] =
+		{"",
+		 "replace the modulation, the channel, the demodulation and the quantization by a single fused module which "
+		 "generates the noise in the SIMD registers and writes the (quantized) LLRs directly from the encoded bits "
+		 "(BPSK modulation and AWGN channel only)."};
+
+	opt_args[{p+"-bench"}] =
+		{"positive_int",
+		 "decoder benchmark mode: pre-generate this number of noisy frames per SNR point, then only decode them in "
+		 "loop on all the threads and report the decoding throughput, latency and iterations."};
+
+	opt_args[{p+"-autotune"}] =
+		{"",
+		 "before the simulation, run a short calibration of the inter frame level (multiples of the default one, "
+		 "unless --src-fra is given) and of the number of threads (all the hardware threads or half of them, unless "
+		 "--sim-threads is given) and keep the configuration with the most frames per second."};
+
+	opt_args[{p+"-autotune-time"}] =
+		{"positive_int",
+		 "duration of each calibration run of the autotuning (in millisecond)."};
 }
 
 void BFER_std::parameters
 ::store(const arg_val_map &vals)
 {
 	BFER::parameters::store(vals);
+
+	auto p = this->get_prefix();
+
+	if(exist(vals, {p+"-pipeline"  })) this->n_threads_gen  = std::stoi(vals.at({p+"-pipeline"  }));
+	if(exist(vals, {p+"-snr-groups"})) this->n_snr_groups   = std::stoi(vals.at({p+"-snr-groups"}));
+	if(exist(vals, {p+"-crn"       })) this->crn            = true;
+	if(exist(vals, {p+"-cbrng"     })) this->cbrng          = true;
+	if(exist(vals, {p+"-fused"     })) this->fused          = true;
+	if(exist(vals, {p+"-bench"     })) this->n_bench_frames = std::stoi(vals.at({p+"-bench"     }));
+	if(exist(vals, {p+"-autotune"  })) this->autotune       = true;
+	if(exist(vals, {p+"-autotune-time"}))
+	{
+		this->autotune      = true;
+		this->autotune_time = std::chrono::milliseconds(std::stoi(vals.at({p+"-autotune-time"})));
+	}
 }
 
 void BFER_std::parameters
 ::get_headers(std::map<std::string,header_list>& headers, const bool full) const
 {
 	BFER::parameters::get_headers(headers, full);
+
+	auto p = this->get_prefix();
+
+	if (this->n_threads_gen)
+		headers[p].push_back(std::make_pair("Pipeline (gen. threads)", std::to_string(this->n_threads_gen)));
+
+	if (this->n_snr_groups > 1)
+		headers[p].push_back(std::make_pair("SNR groups", std::to_string(this->n_snr_groups)));
+
+	if (this->crn)
+		headers[p].push_back(std::make_pair("Common random numbers", "on"));
+
+	if (this->cbrng)
+		headers[p].push_back(std::make_pair("Counter-based PRNG", "on (Threefry)"));
+
+	if (this->fused)
+		headers[p].push_back(std::make_pair("Fused BPSK/AWGN/quantizer", "on"));
+
+	if (this->n_bench_frames)
+		headers[p].push_back(std::make_pair("Decoder benchmark (frames)", std::to_string(this->n_bench_frames)));
+
+	if (this->autotune)
+	{
+		std::stringstream autotune;
+		autotune << "on (" << this->autotune_time.count() << " ms per run";
+		if (this->autotune_fps > 0.f)
+			autotune << ", best: " << std::setprecision(3) << std::scientific << this->autotune_fps << " frames/s";
+		autotune << ")";
+		headers[p].push_back(std::make_pair("Autotuning", autotune.str()));
+	}
 }
 
 template <typename B, typename R, typename Q>
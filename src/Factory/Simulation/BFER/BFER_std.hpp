@@ -2,6 +2,7 @@
 #define FACTORY_SIMULATION_BFER_STD_HPP_
 
 #include <string>
+#include <chrono>
 
 #include "Factory/Module/Codec/Codec_SIHO.hpp"
 
@@ -28,6 +29,17 @@ struct BFER_std : BFER
 	{
 	public:
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
+		// optional parameters
+		int  n_threads_gen  = 0;     // pipeline mode: number of threads dedicated to the frames generation
+		int  n_snr_groups   = 0;     // parallel SNR sweep: number of SNR points simulated at the same time
+		bool crn            = false; // single pass over the SNR range: the frames and the noise are shared by the points
+		bool cbrng          = false; // counter-based PRNGs: a frame only depends on the seed and on its index
+		bool fused          = false; // a single module computes the (quantized) LLRs from the encoded bits (BPSK/AWGN)
+		int  n_bench_frames = 0;     // decoder benchmark: number of pre-generated frames decoded in loop per SNR point
+		bool autotune       = false; // calibrate the inter frame level and the number of threads before the simulation
+		std::chrono::milliseconds autotune_time = std::chrono::milliseconds(300); // duration of a calibration run
+		float                     autotune_fps  = 0.f; // the frames/s of the selected configuration (set by the launcher)
+
 		// module parameters
 		Codec_SIHO::parameters *cdc = nullptr;
 
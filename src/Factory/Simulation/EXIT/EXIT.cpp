@@ -111,6 +111,10 @@ void EXIT::parameters
 void EXIT::parameters
 ::store(const arg_val_map &vals)
 {
+#if !defined(SYSTEMC)
+	this->n_threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+#endif
+
 	Simulation::parameters::store(vals);
 
 	auto p = this->get_prefix();
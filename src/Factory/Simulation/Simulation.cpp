@@ -72,10 +72,29 @@ void Simulation::parameters
 		{"",
 		 "display statistics module by module."};
 
+	opt_args[{p+"-stats-hw"}] =
+		{"",
+		 "add the hardware performance counters to the statistics (cycles, instructions, L1D/LLC and branch misses, "
+		 "Linux only)."};
+
+	opt_args[{p+"-trace"}] =
+		{"string",
+		 "base path of the timeline files (one per SNR, trace-event JSON format) recording all the task executions."};
+
 	opt_args[{p+"-threads", "t"}] =
 		{"positive_int",
 		 "specify the number of threads used (0 or default is the number of CPU cores)."};
 
+	opt_args[{p+"-pin-threads"}] =
+		{"",
+		 "pin each thread on its own core (Linux only), its modules and its buffers stay on the local NUMA node."};
+
+	opt_args[{p+"-huge-pages"}] =
+		{"string",
+		 "allocate the task buffers of 2 MB and more on transparent (THP) or reserved (EXPLICIT) huge pages (Linux "
+		 "only).",
+		 "NO, THP, EXPLICIT"};
+
 	opt_args[{p+"-seed", "S"}] =
 		{"positive_int",
 		 "seed used in the simulation to initialize the pseudo random generators in general."};
@@ -105,10 +124,18 @@ void Simulation::parameters
 	if(exist(vals, {p+"-snr-min",  "m"})) this->snr_min     =         std::stof(vals.at({p+"-snr-min",  "m"}));
 	if(exist(vals, {p+"-snr-max",  "M"})) this->snr_max     =         std::stof(vals.at({p+"-snr-max",  "M"}));
 	if(exist(vals, {p+"-pyber"        })) this->pyber       =                   vals.at({p+"-pyber"        });
+	if(exist(vals, {p+"-trace"        })) this->trace_path  =                   vals.at({p+"-trace"        });
+	if(exist(vals, {p+"-huge-pages"   })) this->huge_pages  =                   vals.at({p+"-huge-pages"   });
 	if(exist(vals, {p+"-snr-step", "s"})) this->snr_step    =         std::stof(vals.at({p+"-snr-step", "s"}));
 	if(exist(vals, {p+"-stop-time"    })) this->stop_time   = seconds(std::stoi(vals.at({p+"-stop-time"    })));
 	if(exist(vals, {p+"-seed",     "S"})) this->global_seed =         std::stoi(vals.at({p+"-seed",     "S"}));
 	if(exist(vals, {p+"-stats"        })) this->statistics  = true;
+	if(exist(vals, {p+"-pin-threads"  })) this->pin_threads = true;
+	if(exist(vals, {p+"-stats-hw"     }))
+	{
+		this->statistics    = true;
+		this->statistics_hw = true;
+	}
 	if(exist(vals, {p+"-debug",    "d"})) this->debug       = true;
 	if(exist(vals, {p+"-debug-limit"}))
 	{
@@ -184,8 +211,10 @@ void Simulation::parameters
 	headers[p].push_back(std::make_pair("SNR max (M)",  std::to_string(this->snr_max)  + " dB"));
 	headers[p].push_back(std::make_pair("SNR step (s)", std::to_string(this->snr_step) + " dB"));
 	headers[p].push_back(std::make_pair("Seed", std::to_string(this->global_seed)));
-	headers[p].push_back(std::make_pair("Statistics", this->statistics ? "on" : "off"));
+	headers[p].push_back(std::make_pair("Statistics", this->statistics ? (this->statistics_hw ? "on (hardware counters)" : "on") : "off"));
 	headers[p].push_back(std::make_pair("Debug mode", this->debug ? "on" : "off"));
+	if (!this->trace_path.empty())
+		headers[p].push_back(std::make_pair("Timeline path", this->trace_path + std::string("_$snr.json")));
 	if (this->debug)
 	{
 		headers[p].push_back(std::make_pair("Debug precision", std::to_string(this->debug_precision)));
@@ -203,4 +232,6 @@ void Simulation::parameters
 		threads = std::to_string(this->n_threads) + " thread(s)";
 
 	headers[p].push_back(std::make_pair("Multi-threading (t)", threads));
+	headers[p].push_back(std::make_pair("Threads pinning", this->pin_threads ? "on" : "off"));
+	headers[p].push_back(std::make_pair("Huge pages", this->huge_pages));
 }
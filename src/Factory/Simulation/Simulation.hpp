@@ -36,10 +36,14 @@ struct Simulation : Launcher
 #endif
 		std::chrono::seconds      stop_time       = std::chrono::seconds(0);
 		std::string               pyber           = "";
+		std::string               trace_path      = "";
+		std::string               huge_pages      = "NO";
 		float                     snr_step        = 0.1f;
 		bool                      debug           = false;
 		bool                      debug_hex       = false;
 		bool                      statistics      = false;
+		bool                      statistics_hw   = false;
+		bool                      pin_threads     = false;
 		int                       n_threads       = 1;
 		int                       local_seed      = 0;
 		int                       global_seed     = 0;
@@ -59,6 +59,10 @@ void Launcher::store_args()
 {
 }
 
+void Launcher::autotune()
+{
+}
+
 int Launcher::read_arguments()
 {
 	this->get_description_args();
@@ -142,6 +146,16 @@ int Launcher::launch()
 		return EXIT_FAILURE;
 	}
 
+	try
+	{
+		this->autotune();
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << tools::apply_on_each_line(tools::addr2line(e.what()), &tools::format_error) << std::endl;
+		return EXIT_FAILURE;
+	}
+
 	// write the command and he curve name in the PyBER format
 #ifdef ENABLE_MPI
 	if (!this->params_common.pyber.empty() && this->params_common.mpi_rank == 0)
@@ -86,6 +86,14 @@ protected:
 	 */
 	virtual void store_args();
 
+	/*!
+	 * \brief Tunes the parameters after they have been stored and before the header is displayed (does nothing by
+	 *        default).
+	 *
+	 * This method can be overloaded to be extended.
+	 */
+	virtual void autotune();
+
 	/*!
 	 * \brief Allocates a specific simulation.
 	 *
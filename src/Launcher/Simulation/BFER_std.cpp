@@ -2,8 +2,15 @@
 
 #include <thread>
 #include <string>
+#include <vector>
+#include <sstream>
 #include <iostream>
 
+#include "Tools/Display/bash_tools.h"
+#include "Tools/Exception/exception.hpp"
+#include "Module/Monitor/Monitor.hpp"
+#include "Simulation/BFER/Standard/Threads/BFER_std_threads.hpp"
+
 #include "Factory/Module/Monitor/BFER/Monitor_BFER.hpp"
 #include "Factory/Module/Interleaver/Interleaver.hpp"
 
@@ -115,6 +122,13 @@ void BFER_std<B,R,Q>
 
 	params.chn->store(this->ar.get_args());
 
+	if (params.cbrng)
+	{
+		if (params.src->type == "RAND" || params.src->type == "RAND_FAST")
+			params.src->type = "RAND_THREEFRY";
+		params.chn->implem = "THREEFRY";
+	}
+
 	params.qnt->size = params.mdm->N;
 
 	if (std::is_integral<Q>())
@@ -167,6 +181,105 @@ void BFER_std<B,R,Q>
 	params.mnt->n_frames = params.src->n_frames;
 }
 
+template <typename B, typename R, typename Q>
+void BFER_std<B,R,Q>
+::autotune()
+{
+	if (!params.autotune)
+		return;
+
+#if defined(SYSTEMC) || defined(ENABLE_MPI)
+	const auto systemc_mpi = true;
+#else
+	const auto systemc_mpi = false;
+#endif
+	const auto pipeline  = params.n_threads_gen > 0;
+	const auto err_track = params.err_track_enable || params.err_track_revert;
+
+	simulation::BFER_std_threads<B,R,Q>::check_compatibility("The autotuning",
+	                                                         {{systemc_mpi,  "SystemC and MPI"},
+	                                                          {pipeline,     "the pipeline mode"},
+	                                                          {params.crn,   "the common random numbers"},
+	                                                          {err_track,    "the bad frames tracking"},
+	                                                          {params.debug, "the debug mode"}});
+
+	// the candidates are stored through the command line arguments, the codes launchers propagate them to the modules
+	const std::vector<std::string> tag_fra     = {params.src->get_prefix() + "-fra",     "F"};
+	const std::vector<std::string> tag_threads = {params.get_prefix()      + "-threads", "t"};
+
+	// the inter frame levels are multiples of the default one (the SIMD width for the inter frame decoders), unless
+	// the user has chosen
+	std::vector<int> cand_fra = {params.src->n_frames};
+	if (this->ar.exist_arg(tag_fra))
+	{
+		std::stringstream message;
+		message << "The autotuning keeps the inter frame level given by the user ('--" << tag_fra[0] << "' = "
+		        << params.src->n_frames << ").";
+		std::clog << tools::format_warning(message.str()) << std::endl;
+	}
+	else
+		for (auto f = 2; f <= 16; f *= 2)
+			cand_fra.push_back(params.src->n_frames * f);
+
+	// all the hardware threads or one per core with the hyperthreading, unless the user has chosen
+	std::vector<int> cand_threads = {params.n_threads};
+	const auto n_hw = (int)std::thread::hardware_concurrency();
+	if (!(this->ar.exist_arg(tag_threads) && this->ar.get_arg_int(tag_threads) > 0) && n_hw > 1)
+		cand_threads = {n_hw / 2, n_hw};
+
+	auto best_fps     = 0.;
+	auto best_fra     = cand_fra    [0];
+	auto best_threads = cand_threads[0];
+	for (auto t : cand_threads)
+		for (auto f : cand_fra)
+		{
+			if (module::Monitor::is_interrupt())
+				break;
+
+			this->ar.set_argument(tag_fra,     std::to_string(f));
+			this->ar.set_argument(tag_threads, std::to_string(t));
+
+			simulation::BFER_std<B,R,Q> *simu = nullptr;
+			try
+			{
+				this->store_args();
+				simu = factory::BFER_std::build<B,R,Q>(params);
+			}
+			catch (std::exception const&)
+			{
+				continue; // a module does not support this inter frame level
+			}
+
+			auto simu_threads = dynamic_cast<simulation::BFER_std_threads<B,R,Q>*>(simu);
+
+			auto fps = 0.;
+			try
+			{
+				if (simu_threads != nullptr)
+					fps = simu_threads->calibrate(params.autotune_time);
+			}
+			catch (std::exception const&)
+			{
+				delete simu;
+				throw;
+			}
+			delete simu;
+
+			if (fps > best_fps)
+			{
+				best_fps     = fps;
+				best_fra     = f;
+				best_threads = t;
+			}
+		}
+
+	this->ar.set_argument(tag_fra,     std::to_string(best_fra    ));
+	this->ar.set_argument(tag_threads, std::to_string(best_threads));
+	this->store_args();
+
+	params.autotune_fps = (float)best_fps;
+}
+
 template <typename B, typename R, typename Q>
 simulation::Simulation* BFER_std<B,R,Q>
 ::build_simu()
@@ -22,6 +22,7 @@ public:
 protected:
 	virtual void get_description_args();
 	virtual void store_args();
+	virtual void autotune();
 
 	virtual simulation::Simulation* build_simu();
 };
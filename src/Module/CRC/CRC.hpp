@@ -103,6 +103,14 @@ public:
 		});
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new CRC (see Module::clone).
+	 */
+	CRC(const CRC &c)
+	: CRC(c.K, c.size, c.n_frames)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
@@ -17,6 +17,13 @@ CRC_NO<B>
 {
 }
 
+template <typename B>
+CRC_NO<B>* CRC_NO<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &CRC_NO::deep_copy);
+}
+
 template <typename B>
 int CRC_NO<B>
 ::get_size() const
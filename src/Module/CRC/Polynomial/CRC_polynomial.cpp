@@ -45,6 +45,13 @@ CRC_polynomial<B>
 	buff_crc.resize((this->K + this->size) * this->n_frames);
 }
 
+template <typename B>
+CRC_polynomial<B>* CRC_polynomial<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &CRC_polynomial::deep_copy);
+}
+
 template <typename B>
 int CRC_polynomial<B>
 ::get_size(std::string poly_key)
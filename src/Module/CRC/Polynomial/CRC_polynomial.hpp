@@ -21,6 +21,7 @@ protected:
 public:
 	CRC_polynomial(const int K, std::string poly_key, const int size = 0, const int n_frames = 1);
 	virtual ~CRC_polynomial(){};
+	virtual CRC_polynomial<B>* clone() const;
 
 	static int         get_size (std::string poly_key);
 	static std::string get_name (std::string poly_key);
@@ -42,6 +42,13 @@ CRC_polynomial_fast<B>
 	}
 }
 
+template <typename B>
+CRC_polynomial_fast<B>* CRC_polynomial_fast<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &CRC_polynomial_fast::deep_copy);
+}
+
 template <typename B>
 void CRC_polynomial_fast<B>
 ::_build(const B *U_K1, B *U_K2, const int frame_id)
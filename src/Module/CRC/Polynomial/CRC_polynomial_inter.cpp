@@ -19,6 +19,13 @@ CRC_polynomial_inter<B>
 	this->buff_crc.resize((this->K + this->size) * mipp::nElReg<B>());
 }
 
+template <typename B>
+CRC_polynomial_inter<B>* CRC_polynomial_inter<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &CRC_polynomial_inter::deep_copy);
+}
+
 template <typename B>
 bool CRC_polynomial_inter<B>
 ::check(const B *V_K, const int n_frames, const int frame_id)
@@ -15,6 +15,7 @@ class CRC_polynomial_inter : public CRC_polynomial<B>
 public:
 	CRC_polynomial_inter(const int K, std::string poly_key, const int size, const int n_frames);
 	virtual ~CRC_polynomial_inter(){};
+	virtual CRC_polynomial_inter<B>* clone() const;
 
 	virtual bool check(const B *V_K, const int n_frames = -1, const int frame_id = -1); using CRC<B>::check;
 
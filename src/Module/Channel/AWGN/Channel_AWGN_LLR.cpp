@@ -40,6 +40,37 @@ Channel_AWGN_LLR<R>
 	delete noise_generator;
 }
 
+template <typename R>
+Channel_AWGN_LLR<R>* Channel_AWGN_LLR<R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Channel_AWGN_LLR::deep_copy);
+}
+
+template <typename R>
+void Channel_AWGN_LLR<R>
+::deep_copy(const Channel_AWGN_LLR<R> &m)
+{
+	if (m.noise_generator != nullptr)
+		this->noise_generator = m.noise_generator->clone();
+
+	Module::deep_copy(m);
+}
+
+template <typename R>
+void Channel_AWGN_LLR<R>
+::set_seed(const int seed)
+{
+	this->noise_generator->set_seed(seed);
+}
+
+template <typename R>
+void Channel_AWGN_LLR<R>
+::set_counter(const uint64_t counter)
+{
+	this->noise_generator->set_counter(counter);
+}
+
 template <typename R>
 void Channel_AWGN_LLR<R>
 ::add_noise(const R *X_N, R *Y_N, const int frame_id)
@@ -79,6 +110,20 @@ void Channel_AWGN_LLR<R>
 	}
 }
 
+template <typename R>
+void Channel_AWGN_LLR<R>
+::save_state(std::ostream &os) const
+{
+	noise_generator->save_state(os);
+}
+
+template <typename R>
+void Channel_AWGN_LLR<R>
+::load_state(std::istream &is)
+{
+	noise_generator->load_state(is);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
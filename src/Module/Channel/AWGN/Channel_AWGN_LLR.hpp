@@ -25,8 +25,17 @@ public:
 	                 const int n_frames = 1);
 
 	virtual ~Channel_AWGN_LLR();
+	virtual Channel_AWGN_LLR<R>* clone() const;
+
+	void set_seed(const int seed);
+	void set_counter(const uint64_t counter);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
 
 	void add_noise(const R *X_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise;
+
+protected:
+	void deep_copy(const Channel_AWGN_LLR<R> &m);
 };
 }
 }
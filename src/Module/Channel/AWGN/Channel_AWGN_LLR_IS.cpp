@@ -0,0 +1,151 @@
+#include <cmath>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Channel_AWGN_LLR_IS.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename R>
+Channel_AWGN_LLR_IS<R>
+::Channel_AWGN_LLR_IS(const int N, const is_method_t method, const R bias, tools::Gaussian_gen<R> *noise_generator,
+                      const R sigma, const int n_frames)
+: Channel<R>(N, sigma, n_frames),
+  method(method),
+  bias(bias),
+  noise_generator(noise_generator),
+  log_weights(n_frames, 0.)
+{
+	const std::string name = "Channel_AWGN_LLR_IS";
+	this->set_name(name);
+
+	if (noise_generator == nullptr)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'noise_generator' can't be NULL.");
+
+	if (bias <= (R)0)
+	{
+		std::stringstream message;
+		message << "'bias' has to be greater than 0 ('bias' = " << bias << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename R>
+Channel_AWGN_LLR_IS<R>
+::~Channel_AWGN_LLR_IS()
+{
+	delete noise_generator;
+}
+
+template <typename R>
+Channel_AWGN_LLR_IS<R>* Channel_AWGN_LLR_IS<R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Channel_AWGN_LLR_IS::deep_copy);
+}
+
+template <typename R>
+void Channel_AWGN_LLR_IS<R>
+::deep_copy(const Channel_AWGN_LLR_IS<R> &m)
+{
+	if (m.noise_generator != nullptr)
+		this->noise_generator = m.noise_generator->clone();
+
+	Module::deep_copy(m);
+}
+
+template <typename R>
+void Channel_AWGN_LLR_IS<R>
+::set_seed(const int seed)
+{
+	this->noise_generator->set_seed(seed);
+}
+
+template <typename R>
+void Channel_AWGN_LLR_IS<R>
+::set_counter(const uint64_t counter)
+{
+	this->noise_generator->set_counter(counter);
+}
+
+template <typename R>
+const std::vector<double>& Channel_AWGN_LLR_IS<R>
+::get_log_weights() const
+{
+	return this->log_weights;
+}
+
+template <typename R>
+void Channel_AWGN_LLR_IS<R>
+::add_noise(const R *X_N, R *Y_N, const int frame_id)
+{
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	const auto sigma_b = (method == VARIANCE_SCALING) ? this->sigma * bias : this->sigma;
+	if (frame_id < 0)
+		noise_generator->generate(this->noise, sigma_b);
+	else
+		noise_generator->generate(this->noise.data() + f_start * this->N, this->N, sigma_b);
+
+	// log(f(z) / g(z)) with f the true density of the noise z and g the biased one
+	const auto inv_2s2 = 1. / (2. * (double)this->sigma * (double)this->sigma);
+	for (auto f = f_start; f < f_stop; f++)
+	{
+		const auto X = X_N                + f * this->N;
+		      auto Y = Y_N                + f * this->N;
+		      auto Z = this->noise.data() + f * this->N;
+
+		auto lw = 0.;
+		if (method == MEAN_SHIFT)
+		{
+			const auto shift = bias * this->sigma;
+			for (auto n = 0; n < this->N; n++)
+			{
+				// the noise is moved towards the decision threshold
+				const auto mu = (X[n] > (R)0) ? -shift : ((X[n] < (R)0) ? shift : (R)0);
+				Z[n] += mu;
+				lw += ((double)mu * (double)mu - 2. * (double)mu * (double)Z[n]) * inv_2s2;
+			}
+		}
+		else // if (method == VARIANCE_SCALING)
+		{
+			auto energy = 0.;
+			for (auto n = 0; n < this->N; n++)
+				energy += (double)Z[n] * (double)Z[n];
+
+			const auto c = (double)bias;
+			lw = (double)this->N * std::log(c) - (1. - 1. / (c * c)) * inv_2s2 * energy;
+		}
+		log_weights[f] = lw;
+
+		for (auto n = 0; n < this->N; n++)
+			Y[n] = X[n] + Z[n];
+	}
+}
+
+template <typename R>
+void Channel_AWGN_LLR_IS<R>
+::save_state(std::ostream &os) const
+{
+	noise_generator->save_state(os);
+}
+
+template <typename R>
+void Channel_AWGN_LLR_IS<R>
+::load_state(std::istream &is)
+{
+	noise_generator->load_state(is);
+}
+
+// ==================================================================================== explicit template instantiation 
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Channel_AWGN_LLR_IS<R_32>;
+template class aff3ct::module::Channel_AWGN_LLR_IS<R_64>;
+#else
+template class aff3ct::module::Channel_AWGN_LLR_IS<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,64 @@
+#ifndef CHANNEL_AWGN_LLR_IS_HPP_
+#define CHANNEL_AWGN_LLR_IS_HPP_
+
+#include <vector>
+
+#include "Tools/Algo/Gaussian_noise_generator/Gaussian_noise_generator.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp"
+
+#include "../Channel.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Channel_AWGN_LLR_IS
+ *
+ * \brief AWGN channel for the importance sampling: the noise is drawn from a biased distribution and the likelihood
+ *        ratio of each frame (true density / biased density of its noise) is given to the Monitor_BFER.
+ *
+ * With the MEAN_SHIFT method, the mean of the noise is moved towards the decision threshold of each symbol ("bias"
+ * times sigma). With the VARIANCE_SCALING method, the standard deviation of the noise is multiplied by "bias". The
+ * weights are kept in the log domain (see "get_log_weights"). The variance of the estimator grows quickly with the
+ * frame size and the bias, a small bias is usually preferable.
+ */
+template <typename R = float>
+class Channel_AWGN_LLR_IS : public Channel<R>
+{
+public:
+	enum is_method_t { MEAN_SHIFT = 0, VARIANCE_SCALING };
+
+private:
+	const is_method_t method;
+	const R bias;
+	tools::Gaussian_noise_generator<R> *noise_generator;
+	std::vector<double> log_weights; // one per frame
+
+public:
+	Channel_AWGN_LLR_IS(const int N, const is_method_t method, const R bias,
+	                    tools::Gaussian_gen<R> *noise_generator = new tools::Gaussian_gen_std<R>(),
+	                    const R sigma = (R)1, const int n_frames = 1);
+
+	virtual ~Channel_AWGN_LLR_IS();
+	virtual Channel_AWGN_LLR_IS<R>* clone() const;
+
+	void set_seed(const int seed);
+	void set_counter(const uint64_t counter);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+
+	/*!
+	 * \brief The log-likelihood ratios of the last frames, to weight their errors.
+	 */
+	const std::vector<double>& get_log_weights() const;
+
+	void add_noise(const R *X_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise;
+
+protected:
+	void deep_copy(const Channel_AWGN_LLR_IS<R> &m);
+};
+}
+}
+
+#endif /* CHANNEL_AWGN_LLR_IS_HPP_ */
@@ -10,6 +10,7 @@
 
 #include <string>
 #include <vector>
+#include <cstdint>
 #include <sstream>
 #include <algorithm>
 
@@ -100,6 +101,14 @@ public:
 		});
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Channel (see Module::clone).
+	 */
+	Channel(const Channel &c)
+	: Channel(c.N, c.sigma, c.n_frames)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
@@ -122,6 +131,25 @@ public:
 		return noise;
 	}
 
+	/*!
+	 * \brief Re-initializes the noise generator of the Channel (does nothing for the deterministic Channels).
+	 *
+	 * \param seed: the new seed.
+	 */
+	virtual void set_seed(const int seed)
+	{
+	}
+
+	/*!
+	 * \brief Sets the global index of the first frame of the next call to "add_noise", for the Channels based on a
+	 *        counter-based random generator (does nothing for the other Channels).
+	 *
+	 * \param counter: the index of the frame.
+	 */
+	virtual void set_counter(const uint64_t counter)
+	{
+	}
+
 	virtual void set_sigma(const R sigma)
 	{
 		if (sigma <= 0)
@@ -11,6 +11,13 @@ Channel_NO<R>
 	this->set_name(name);
 }
 
+template <typename R>
+Channel_NO<R>* Channel_NO<R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Channel_NO::deep_copy);
+}
+
 template <typename R>
 Channel_NO<R>
 ::~Channel_NO() 
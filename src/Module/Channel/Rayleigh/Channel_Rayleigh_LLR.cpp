@@ -1,5 +1,6 @@
 #include <cmath>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -11,22 +12,19 @@ using namespace aff3ct::module;
 template <typename R>
 Channel_Rayleigh_LLR<R>
 ::Channel_Rayleigh_LLR(const int N, const bool complex, tools::Gaussian_gen<R> *noise_generator, const bool add_users,
-                       const R sigma, const int n_frames)
+                       const R sigma, const int n_frames, const int gain_occurrences)
 : Channel<R>(N, sigma, n_frames),
   complex(complex),
   add_users(add_users),
-  gains(complex ? N * n_frames : 2 * N * n_frames),
+  gain_occur(gain_occurrences),
+  n_gains(gain_occurrences > 0 ? ((complex ? N / 2 : N) + gain_occurrences -1) / gain_occurrences : 0),
+  gains(2 * n_gains * n_frames),
   noise_generator(noise_generator)
 {
 	const std::string name = "Channel_Rayleigh_LLR";
 	this->set_name(name);
 
-	if (complex && N % 2)
-	{
-		std::stringstream message;
-		message << "'N' has to be divisible by 2 ('N' = " << N << ").";
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
+	this->check_parameters();
 
 	if (noise_generator == nullptr)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'noise_generator' can't be NULL.");
@@ -35,35 +33,182 @@ Channel_Rayleigh_LLR<R>
 template <typename R>
 Channel_Rayleigh_LLR<R>
 ::Channel_Rayleigh_LLR(const int N, const bool complex, const int seed, const bool add_users, const R sigma,
-                       const int n_frames)
+                       const int n_frames, const int gain_occurrences)
 : Channel<R>(N, sigma, n_frames),
   complex(complex),
   add_users(add_users),
-  gains(complex ? N * n_frames : 2 * N * n_frames),
-  noise_generator(new tools::Gaussian_noise_generator_std<R>(seed))
+  gain_occur(gain_occurrences),
+  n_gains(gain_occurrences > 0 ? ((complex ? N / 2 : N) + gain_occurrences -1) / gain_occurrences : 0),
+  gains(2 * n_gains * n_frames),
+  noise_generator(new tools::Gaussian_noise_generator_fast<R>(seed))
 {
 	const std::string name = "Channel_Rayleigh_LLR";
 	this->set_name(name);
 
-	if (complex && N % 2)
+	this->check_parameters();
+}
+
+template <typename R>
+Channel_Rayleigh_LLR<R>
+::~Channel_Rayleigh_LLR()
+{
+	delete noise_generator;
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::check_parameters() const
+{
+	if (complex && this->N % 2)
+	{
+		std::stringstream message;
+		message << "'N' has to be divisible by 2 ('N' = " << this->N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (gain_occur <= 0)
 	{
 		std::stringstream message;
-		message << "'N' has to be divisible by 2 ('N' = " << N << ").";
+		message << "'gain_occur' has to be greater than 0 ('gain_occur' = " << gain_occur << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 }
 
 template <typename R>
-Channel_Rayleigh_LLR<R>
-::~Channel_Rayleigh_LLR()
+Channel_Rayleigh_LLR<R>* Channel_Rayleigh_LLR<R>
+::clone() const
 {
-	delete noise_generator;
+	return Module::clone_impl(*this, &Channel_Rayleigh_LLR::deep_copy);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::deep_copy(const Channel_Rayleigh_LLR<R> &m)
+{
+	if (m.noise_generator != nullptr)
+		this->noise_generator = m.noise_generator->clone();
+
+	Module::deep_copy(m);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::set_seed(const int seed)
+{
+	this->noise_generator->set_seed(seed);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::set_counter(const uint64_t counter)
+{
+	this->noise_generator->set_counter(counter);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::compute_gains(const R *gains, R *H_N) const
+{
+	const auto *g_re = gains;
+	const auto *g_im = gains + this->n_gains;
+
+	if (this->complex)
+	{
+		// H_N = [re_0, im_0, re_1, im_1, ...], one gain per block of "gain_occur" symbols
+		const auto n_symbs = this->N / 2;
+		for (auto g = 0; g < this->n_gains; g++)
+		{
+			const auto s_stop = std::min((g +1) * this->gain_occur, n_symbs);
+			for (auto s = g * this->gain_occur; s < s_stop; s++)
+			{
+				H_N[2*s   ] = g_re[g];
+				H_N[2*s +1] = g_im[g];
+			}
+		}
+	}
+	else if (this->gain_occur == 1)
+	{
+		// fast fading: one magnitude per symbol
+		const auto vec_loop_size = (this->N / mipp::nElReg<R>()) * mipp::nElReg<R>();
+		for (auto n = 0; n < vec_loop_size; n += mipp::nElReg<R>())
+		{
+			const auto h_re = mipp::loadu<R>(&g_re[n]);
+			const auto h_im = mipp::loadu<R>(&g_im[n]);
+			mipp::storeu<R>(&H_N[n], mipp::sqrt(h_re * h_re + h_im * h_im));
+		}
+
+		for (auto n = vec_loop_size; n < this->N; n++)
+			H_N[n] = std::sqrt(g_re[n] * g_re[n] + g_im[n] * g_im[n]);
+	}
+	else
+	{
+		// block fading: the magnitude is computed once per block
+		for (auto g = 0; g < this->n_gains; g++)
+		{
+			const auto h = std::sqrt(g_re[g] * g_re[g] + g_im[g] * g_im[g]);
+			std::fill(H_N + g * this->gain_occur, H_N + std::min((g +1) * this->gain_occur, this->N), h);
+		}
+	}
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::apply_gains(const R *X_N, const R *H_N, const R *noise, R *Y_N) const
+{
+	// "noise" and "Y_N" can be the same buffer
+	if (this->complex)
+	{
+		// the real and imaginary parts are deinterleaved in registers for the complex multiplication
+		const auto n_elmts = mipp::nElReg<R>();
+		const auto vec_loop_size = (this->N / (2 * n_elmts)) * 2 * n_elmts;
+		for (auto n = 0; n < vec_loop_size; n += 2 * n_elmts)
+		{
+			const auto x = mipp::deinterleave<R>(mipp::loadu<R>(&X_N  [n]), mipp::loadu<R>(&X_N  [n + n_elmts]));
+			const auto h = mipp::deinterleave<R>(mipp::loadu<R>(&H_N  [n]), mipp::loadu<R>(&H_N  [n + n_elmts]));
+			const auto z = mipp::deinterleave<R>(mipp::loadu<R>(&noise[n]), mipp::loadu<R>(&noise[n + n_elmts]));
+
+			const auto y_re = (x.val[0] * h.val[0] - x.val[1] * h.val[1]) + z.val[0];
+			const auto y_im = (x.val[1] * h.val[0] + x.val[0] * h.val[1]) + z.val[1];
+
+			const auto y = mipp::interleave<R>(y_re, y_im);
+			mipp::storeu<R>(&Y_N[n          ], y.val[0]);
+			mipp::storeu<R>(&Y_N[n + n_elmts], y.val[1]);
+		}
+
+		for (auto n = vec_loop_size; n < this->N; n += 2)
+		{
+			const auto h_re = H_N[n   ];
+			const auto h_im = H_N[n +1];
+
+			const auto n_re = noise[n   ];
+			const auto n_im = noise[n +1];
+
+			Y_N[n   ] = (X_N[n   ] * h_re - X_N[n +1] * h_im) + n_re;
+			Y_N[n +1] = (X_N[n +1] * h_re + X_N[n   ] * h_im) + n_im;
+		}
+	}
+	else
+	{
+		const auto vec_loop_size = (this->N / mipp::nElReg<R>()) * mipp::nElReg<R>();
+		for (auto n = 0; n < vec_loop_size; n += mipp::nElReg<R>())
+		{
+			const auto x = mipp::loadu<R>(&X_N  [n]);
+			const auto h = mipp::loadu<R>(&H_N  [n]);
+			const auto z = mipp::loadu<R>(&noise[n]);
+			mipp::storeu<R>(&Y_N[n], x * h + z);
+		}
+
+		for (auto n = vec_loop_size; n < this->N; n++)
+			Y_N[n] = X_N[n] * H_N[n] + noise[n];
+	}
 }
 
 template <typename R>
 void Channel_Rayleigh_LLR<R>
 ::add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id)
 {
+	const auto frame_gains = 2 * this->n_gains;
+
 	if (add_users && this->n_frames > 1)
 	{
 		if (frame_id != -1)
@@ -76,38 +221,13 @@ void Channel_Rayleigh_LLR<R>
 		noise_generator->generate(this->gains, (R)1 / (R)std::sqrt((R)2));
 		noise_generator->generate(this->noise.data(), this->N, this->sigma);
 
-		std::fill(Y_N, Y_N + this->N, (R)0);
+		std::copy(this->noise.begin(), this->noise.begin() + this->N, Y_N);
 
-		if (this->complex)
+		for (auto f = 0; f < this->n_frames; f++)
 		{
-			for (auto f = 0; f < this->n_frames; f++)
-			{
-				for (auto i = 0; i < this->N; i += 2)
-				{
-					const auto h_re = H_N[f * this->N +i   ] = this->gains[f * this->N +i   ];
-					const auto h_im = H_N[f * this->N +i +1] = this->gains[f * this->N +i +1];
-
-					Y_N[i   ] += X_N[f * this->N +i   ] * h_re - X_N[f * this->N +i +1] * h_im;
-					Y_N[i +1] += X_N[f * this->N +i +1] * h_re + X_N[f * this->N +i   ] * h_im;
-				}
-			}
-		}
-		else
-		{
-			for (auto f = 0; f < this->n_frames; f++)
-			{
-				for (auto i = 0; i < this->N; i++)
-				{
-					const auto h_re = this->gains[f * this->N * 2 + 2*i   ];
-					const auto h_im = this->gains[f * this->N * 2 + 2*i +1];
-
-					H_N[f * this->N +i] = std::sqrt(h_re * h_re + h_im * h_im);
-					Y_N[i] += X_N[f * this->N +i] * H_N[f * this->N +i];
-				}
-			}
+			this->compute_gains(this->gains.data() + f * frame_gains, H_N + f * this->N);
+			this->apply_gains(X_N + f * this->N, H_N + f * this->N, Y_N, Y_N);
 		}
-		for (auto i = 0; i < this->N; i++)
-			Y_N[i] += this->noise[i];
 	}
 	else
 	{
@@ -121,44 +241,34 @@ void Channel_Rayleigh_LLR<R>
 		}
 		else
 		{
-			noise_generator->generate(this->gains.data() + f_start * this->N, this->N, (R)1 / (R)std::sqrt((R)2));
+			noise_generator->generate(this->gains.data() + f_start * frame_gains, frame_gains,
+			                          (R)1 / (R)std::sqrt((R)2));
 			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->sigma);
 		}
 
-		if (this->complex)
+		for (auto f = f_start; f < f_stop; f++)
 		{
-			for (auto f = f_start; f < f_stop; f++)
-			{
-				for (auto n = 0; n < this->N; n += 2)
-				{
-					const auto h_re = H_N[f * this->N + n   ] = this->gains[f * this->N + n   ];
-					const auto h_im = H_N[f * this->N + n +1] = this->gains[f * this->N + n +1];
-
-					const auto n_re = this->noise[f * this->N + n   ];
-					const auto n_im = this->noise[f * this->N + n +1];
-
-					Y_N[f * this->N + n   ] = (X_N[f * this->N + n   ] * h_re - X_N[f * this->N + n +1] * h_im) + n_re;
-					Y_N[f * this->N + n +1] = (X_N[f * this->N + n +1] * h_re + X_N[f * this->N + n   ] * h_im) + n_im;
-				}
-			}
-		}
-		else
-		{
-			for (auto f = f_start; f < f_stop; f++)
-			{
-				for (auto n = 0; n < this->N; n++)
-				{
-					const auto h_re = this->gains[f * this->N + 2*n   ];
-					const auto h_im = this->gains[f * this->N + 2*n +1];
-
-					H_N[f * this->N + n] = std::sqrt(h_re * h_re + h_im * h_im);
-					Y_N[f * this->N + n] = X_N[f * this->N + n] * H_N[f * this->N + n] + this->noise[f * this->N + n];
-				}
-			}
+			this->compute_gains(this->gains.data() + f * frame_gains, H_N + f * this->N);
+			this->apply_gains(X_N + f * this->N, H_N + f * this->N, this->noise.data() + f * this->N,
+			                  Y_N + f * this->N);
 		}
 	}
 }
 
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::save_state(std::ostream &os) const
+{
+	noise_generator->save_state(os);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR<R>
+::load_state(std::istream &is)
+{
+	noise_generator->load_state(is);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -2,9 +2,10 @@
 #define CHANNEL_RAYLEIGH_LLR_HPP_
 
 #include <vector>
+#include <mipp.h>
 
 #include "Tools/Algo/Gaussian_noise_generator/Gaussian_noise_generator.hpp"
-#include "Tools/Algo/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp"
+#include "Tools/Algo/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp"
 
 #include "../Channel.hpp"
 
@@ -18,18 +19,39 @@ class Channel_Rayleigh_LLR : public Channel<R> // flat Rayleigh fading channel
 private:
 	const bool complex;
 	const bool add_users;
-	std::vector<R> gains;
+	const int  gain_occur; // number of consecutive symbols sharing the same gain (block fading)
+	const int  n_gains;    // number of complex gains per frame
+	mipp::vector<R> gains; // per frame: the real parts of the gains, then their imaginary parts
 	tools::Gaussian_noise_generator<R> *noise_generator;
 
 public:
+	/*!
+	 * \param gain_occurrences: the number of consecutive symbols of a frame sharing the same gain (1 for a fast fading,
+	 *                          the number of symbols of a frame for a quasi-static fading).
+	 */
 	Channel_Rayleigh_LLR(const int N, const bool complex,
-	                     tools::Gaussian_gen<R> *noise_generator = new tools::Gaussian_gen_std<R>(),
-	                     const bool add_users = false, const R sigma = (R)1, const int n_frames = 1);
+	                     tools::Gaussian_gen<R> *noise_generator = new tools::Gaussian_gen_fast<R>(),
+	                     const bool add_users = false, const R sigma = (R)1, const int n_frames = 1,
+	                     const int gain_occurrences = 1);
 	Channel_Rayleigh_LLR(const int N, const bool complex, const int seed, const bool add_users = false,
-	                     const R sigma = (R)1, const int n_frames = 1);
+	                     const R sigma = (R)1, const int n_frames = 1, const int gain_occurrences = 1);
 	virtual ~Channel_Rayleigh_LLR();
+	virtual Channel_Rayleigh_LLR<R>* clone() const;
+
+	void set_seed(const int seed);
+	void set_counter(const uint64_t counter);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
 
 	virtual void add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise_wg;
+
+protected:
+	void deep_copy(const Channel_Rayleigh_LLR<R> &m);
+
+private:
+	void check_parameters() const;
+	void compute_gains(const R *gains, R *H_N) const;
+	void apply_gains(const R *X_N, const R *H_N, const R *noise, R *Y_N) const;
 };
 }
 }
@@ -69,6 +69,37 @@ Channel_Rayleigh_LLR_user<R>
 	delete noise_generator;
 }
 
+template <typename R>
+Channel_Rayleigh_LLR_user<R>* Channel_Rayleigh_LLR_user<R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Channel_Rayleigh_LLR_user::deep_copy);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_user<R>
+::deep_copy(const Channel_Rayleigh_LLR_user<R> &m)
+{
+	if (m.noise_generator != nullptr)
+		this->noise_generator = m.noise_generator->clone();
+
+	Module::deep_copy(m);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_user<R>
+::set_seed(const int seed)
+{
+	this->noise_generator->set_seed(seed);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_user<R>
+::set_counter(const uint64_t counter)
+{
+	this->noise_generator->set_counter(counter);
+}
+
 template <typename R>
 void Channel_Rayleigh_LLR_user<R>
 ::read_gains(const std::string& gains_filename)
@@ -137,6 +168,22 @@ void Channel_Rayleigh_LLR_user<R>
 	}
 }
 
+template <typename R>
+void Channel_Rayleigh_LLR_user<R>
+::save_state(std::ostream &os) const
+{
+	noise_generator->save_state(os);
+	os << current_gain_occur << " " << gain_index << " ";
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_user<R>
+::load_state(std::istream &is)
+{
+	noise_generator->load_state(is);
+	is >> current_gain_occur >> gain_index;
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
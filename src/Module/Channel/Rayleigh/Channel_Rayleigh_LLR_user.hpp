@@ -36,10 +36,17 @@ public:
 	                          const int gain_occurrences = 1, const bool add_users = false, const R sigma = (R)1,
 	                          const int n_frames = 1);
 	virtual ~Channel_Rayleigh_LLR_user();
+	virtual Channel_Rayleigh_LLR_user<R>* clone() const;
+
+	void set_seed(const int seed);
+	void set_counter(const uint64_t counter);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
 
 	virtual void add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise_wg;
 
 protected:
+	void deep_copy(const Channel_Rayleigh_LLR_user<R> &m);
 	void read_gains(const std::string& gains_filename);
 };
 }
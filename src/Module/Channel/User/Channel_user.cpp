@@ -1,7 +1,9 @@
-#include <fstream>
+#include <cstdint>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
 
 #include "Channel_user.hpp"
 
@@ -11,7 +13,8 @@ using namespace aff3ct::module;
 template <typename R>
 Channel_user<R>
 ::Channel_user(const int N, const std::string &filename, const bool add_users, const int n_frames)
-: Channel<R>(N, (R)1, n_frames), add_users(add_users), noise_buff(), noise_counter(0)
+: Channel<R>(N, (R)1, n_frames), add_users(add_users), file(nullptr), frames(nullptr), n_fra(0), sizeof_float(0),
+  partition()
 {
 	const std::string name = "Channel_user";
 	this->set_name(name);
@@ -19,89 +22,48 @@ Channel_user<R>
 	if (filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
-	std::ifstream file(filename.c_str(), std::ios::binary);
+	// the frames are read from the mapping of the file when they are played (the file is not loaded in memory)
+	this->file = tools::File_mapping::open(filename);
 
-	if (file.is_open())
-	{
-		unsigned n_fra = 0;
-		int fra_size = 0;
-
-		file.read((char*)&n_fra,    sizeof(n_fra));
-		file.read((char*)&fra_size, sizeof(fra_size));
-
-		file.ignore(std::numeric_limits<std::streamsize>::max());
-		std::streamsize length = file.gcount();
-		file.clear(); // since ignore will have set eof.
-		file.seekg(8, std::ios_base::beg);
-
-		if (n_fra <= 0 || fra_size <= 0)
-		{
-			std::stringstream message;
-			message << "'n_fra' and 'fra_size' have to be bigger than 0 ('n_fra' = "
-			        << n_fra << ", 'fra_size' = " << fra_size << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	unsigned n_fra = 0;
+	int fra_size = 0;
 
-		const unsigned sizeof_float = (unsigned)length / (n_fra * fra_size);
+	const auto header_size = sizeof(n_fra) + sizeof(fra_size);
+	if (this->file->size() >= header_size)
+	{
+		std::copy(this->file->data(),                 this->file->data() + sizeof(n_fra), (char*)&n_fra   );
+		std::copy(this->file->data() + sizeof(n_fra), this->file->data() + header_size,   (char*)&fra_size);
+	}
 
-		this->noise_buff.resize(n_fra);
-		for (unsigned i = 0; i < (unsigned)n_fra; i++)
-			this->noise_buff[i].resize(fra_size);
+	if (n_fra <= 0 || fra_size <= 0)
+	{
+		std::stringstream message;
+		message << "'n_fra' and 'fra_size' have to be bigger than 0 ('n_fra' = "
+		        << n_fra << ", 'fra_size' = " << fra_size << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-		if (fra_size == this->N)
-		{
-			if (sizeof_float == sizeof(R))
-			{
-				for (unsigned i = 0; i < n_fra; i++)
-					file.read(reinterpret_cast<char*>(&this->noise_buff[i][0]), fra_size * sizeof(R));
-			}
-			else
-			{
-				if (sizeof_float == sizeof(double))
-				{
-					std::vector<double> tmp(fra_size);
-					for (unsigned i = 0; i < n_fra; i++)
-					{
-						file.read(reinterpret_cast<char*>(tmp.data()), fra_size * sizeof(double));
-						for (auto j = 0; j < fra_size; j++)
-							this->noise_buff[i][j] = (R)tmp[j];
-					}
-				}
-				else if (sizeof_float == sizeof(float))
-				{
-					std::vector<float> tmp(fra_size);
-					for (unsigned i = 0; i < n_fra; i++)
-					{
-						file.read(reinterpret_cast<char*>(tmp.data()), fra_size * sizeof(float));
-						for (auto j = 0; j < fra_size; j++)
-							this->noise_buff[i][j] = (R)tmp[j];
-					}
-				}
-				else
-				{
-					file.close();
-
-					std::stringstream message;
-					message << "Something went wrong ('sizeof_float' = " << sizeof_float << ").";
-					throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-				}
-			}
-		}
-		else
-		{
-			file.close();
+	if (fra_size != this->N)
+	{
+		std::stringstream message;
+		message << "The frame size is wrong (read: " << fra_size << ", expected: " << this->N << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-			std::stringstream message;
-			message << "The frame size is wrong (read: " << fra_size << ", expected: " << this->N << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	const auto length = this->file->size() - header_size;
+	this->sizeof_float = (unsigned)(length / ((size_t)n_fra * fra_size));
 
-		file.close();
-	}
-	else
+	if (this->sizeof_float != sizeof(R)        && this->sizeof_float != sizeof(double) &&
+	    this->sizeof_float != sizeof(uint16_t) && this->sizeof_float != sizeof(float))
 	{
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file");
+		std::stringstream message;
+		message << "Something went wrong ('sizeof_float' = " << this->sizeof_float << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->frames = this->file->data() + header_size;
+	this->n_fra  = (int)n_fra;
+	this->partition.set_n_fra(this->n_fra);
 }
 
 template <typename R>
@@ -110,6 +72,43 @@ Channel_user<R>
 {
 }
 
+template <typename R>
+Channel_user<R>* Channel_user<R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Channel_user::deep_copy);
+}
+
+template <typename R>
+void Channel_user<R>
+::read_frame(const int i, R *noise) const
+{
+	const auto frame = this->frames + (size_t)i * this->N * this->sizeof_float;
+
+	if (this->sizeof_float == sizeof(R))
+	{
+		std::copy((const R*)frame, (const R*)frame + this->N, noise);
+	}
+	else if (this->sizeof_float == sizeof(double))
+	{
+		const auto values = (const double*)frame;
+		for (auto j = 0; j < this->N; j++)
+			noise[j] = (R)values[j];
+	}
+	else if (this->sizeof_float == sizeof(uint16_t)) // half precision (see Dumper::packing_t::HALF)
+	{
+		const auto values = (const uint16_t*)frame;
+		for (auto j = 0; j < this->N; j++)
+			noise[j] = (R)tools::half_to_float(values[j]);
+	}
+	else // if (this->sizeof_float == sizeof(float))
+	{
+		const auto values = (const float*)frame;
+		for (auto j = 0; j < this->N; j++)
+			noise[j] = (R)values[j];
+	}
+}
+
 template <typename R>
 void Channel_user<R>
 ::add_noise(const R *X_N, R *Y_N, const int frame_id)
@@ -129,13 +128,7 @@ void Channel_user<R>
 				Y_N[i] += X_N[f * this->N +i];
 
 		for (auto f = 0; f < this->n_frames; f++)
-		{
-			std::copy(this->noise_buff[this->noise_counter].begin(),
-			          this->noise_buff[this->noise_counter].end  (),
-			          this->noise.data() + f * this->N);
-
-			this->noise_counter = (this->noise_counter +1) % (int)this->noise_buff.size();
-		}
+			this->read_frame(this->partition.next(), this->noise.data() + f * this->N);
 
 		for (auto i = 0; i < this->N; i++)
 			Y_N[i] += this->noise[i];
@@ -147,18 +140,35 @@ void Channel_user<R>
 
 		for (auto f = f_start; f < f_stop; f++)
 		{
-			std::copy(this->noise_buff[this->noise_counter].begin(),
-			          this->noise_buff[this->noise_counter].end  (),
-			          this->noise.data() + f * this->N);
+			this->read_frame(this->partition.next(), this->noise.data() + f * this->N);
 
 			for (auto i = 0; i < this->N; i++)
 				Y_N[f * this->N +i] = X_N[f * this->N +i] + this->noise[f * this->N +i];
-
-			this->noise_counter = (this->noise_counter +1) % (int)this->noise_buff.size();
 		}
 	}
 }
 
+template <typename R>
+void Channel_user<R>
+::set_partition(const int part_id, const int n_parts)
+{
+	this->partition.set_partition(part_id, n_parts);
+}
+
+template <typename R>
+void Channel_user<R>
+::save_state(std::ostream &os) const
+{
+	this->partition.save_state(os);
+}
+
+template <typename R>
+void Channel_user<R>
+::load_state(std::istream &is)
+{
+	this->partition.load_state(is);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -1,8 +1,11 @@
 #ifndef CHANNELS_USER_HPP_
 #define CHANNELS_USER_HPP_
 
+#include <memory>
 #include <vector>
-#include <mipp.h>
+
+#include "Tools/Algo/Frame_partition.hpp"
+#include "Tools/Perf/File_mapping/File_mapping.hpp"
 
 #include "../Channel.hpp"
 
@@ -15,14 +18,30 @@ class Channel_user : public Channel<R>
 {
 private:
 	const bool add_users;
-	mipp::vector<mipp::vector<R>> noise_buff;
-	int noise_counter;
+	std::shared_ptr<const tools::File_mapping> file; // shared by all the copies of the channel
+	const char *frames;       // the first noise frame in the file
+	int         n_fra;        // the number of noise frames in the file
+	unsigned    sizeof_float; // the size of a noise value in the file
+	tools::Frame_partition partition; // the frames played by this instance
 
 public:
 	Channel_user(const int N, const std::string &filename, const bool add_users = false, const int n_frames = 1);
 	virtual ~Channel_user();
+	virtual Channel_user<R>* clone() const;
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+
+	/*!
+	 * \brief Replays only the frames "part_id", "part_id + n_parts", "part_id + 2 * n_parts", ... of the file (to
+	 *        share the frames between several instances), a part without frame can't be played (see
+	 *        tools::Frame_partition).
+	 */
+	void set_partition(const int part_id, const int n_parts);
 
 	void add_noise(const R *X_N, R *Y_N, const int frame_id = -1);  using Channel<R>::add_noise;
+
+private:
+	void read_frame(const int i, R *noise) const;
 };
 }
 }
@@ -73,6 +73,13 @@ Codec_BCH<B,Q>
 {
 }
 
+template <typename B, typename Q>
+Codec_BCH<B,Q>* Codec_BCH<B,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Codec_BCH::deep_copy);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
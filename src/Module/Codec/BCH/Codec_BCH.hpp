@@ -22,6 +22,7 @@ public:
 	Codec_BCH(const factory::Encoder_BCH::parameters &enc_params,
 	          const factory::Decoder_BCH::parameters &dec_params);
 	virtual ~Codec_BCH();
+	virtual Codec_BCH<B,Q>* clone() const;
 };
 }
 }
@@ -150,6 +150,13 @@ public:
 		});
 	}
 
+	// copy constructor, the sub-modules are not copied here (see Codec::deep_copy)
+	Codec(const Codec &c)
+	: Codec(c.K, c.N_cw, c.N, c.tail_length, c.n_frames)
+	{
+		this->sigma = c.sigma;
+	}
+
 	virtual ~Codec()
 	{
 		if (encoder          != nullptr) { delete encoder;          encoder          = nullptr; }
@@ -431,6 +438,24 @@ protected:
 		this->puncturer = pct;
 	}
 
+	// clones the encoder and the puncturer of "c", the Codecs with an interleaver (turbo, turbo DB and RA)
+	// are not supported: the interleaver core is not a Module, it is regenerated for each frame when it is random and
+	// it is referenced by the sub-encoders and the sub-decoders, the simulations build them with the factory instead
+	void deep_copy(const Codec &c)
+	{
+		Module::deep_copy(c);
+
+		if (c.interleaver_core != nullptr)
+		{
+			std::stringstream message;
+			message << "The interleaver of the Codec can't be cloned ('name' = " << c.get_name() << ").";
+			throw tools::unimplemented_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (c.encoder   != nullptr) this->encoder   = dynamic_cast<Encoder  <B  >*>(c.encoder  ->clone());
+		if (c.puncturer != nullptr) this->puncturer = dynamic_cast<Puncturer<B,Q>*>(c.puncturer->clone());
+	}
+
 	virtual const Interleaver<B>& get_interleaver_bit()
 	{
 		return *this->interleaver_bit;
@@ -12,7 +12,7 @@ namespace module
 template <typename B = int, typename Q = float>
 class Codec_SIHO : virtual public Codec<B,Q>
 {
-private:
+protected:
 	Decoder_SIHO<B,Q>* decoder_siho;
 
 public:
@@ -23,6 +23,12 @@ public:
 		this->set_name(name);
 	}
 
+	// copy constructor, the decoder is not copied here (see Codec_SIHO::deep_copy)
+	Codec_SIHO(const Codec_SIHO &c)
+	: Codec<B,Q>(c), decoder_siho(nullptr)
+	{
+	}
+
 	virtual ~Codec_SIHO()
 	{
 		if (decoder_siho != nullptr) { delete decoder_siho; decoder_siho = nullptr; }
@@ -53,6 +59,15 @@ public:
 	}
 
 protected:
+	// clones the decoder, the encoder and the puncturer of "c"
+	void deep_copy(const Codec_SIHO &c)
+	{
+		Codec<B,Q>::deep_copy(c);
+
+		if (c.decoder_siho != nullptr)
+			this->decoder_siho = dynamic_cast<Decoder_SIHO<B,Q>*>(c.decoder_siho->clone());
+	}
+
 	void set_decoder_siho(Decoder_SIHO<B,Q>* dec)
 	{
 		this->decoder_siho = dec;
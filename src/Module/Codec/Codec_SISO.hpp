@@ -12,7 +12,7 @@ namespace module
 template <typename B = int, typename Q = float>
 class Codec_SISO : virtual public Codec<B,Q>
 {
-private:
+protected:
 	Decoder_SISO<Q> *decoder_siso;
 
 public:
@@ -23,6 +23,12 @@ public:
 		this->set_name(name);
 	}
 
+	// copy constructor, the decoder is not copied here (see Codec_SISO::deep_copy)
+	Codec_SISO(const Codec_SISO &c)
+	: Codec<B,Q>(c), decoder_siso(nullptr)
+	{
+	}
+
 	virtual ~Codec_SISO()
 	{
 		if (decoder_siso != nullptr) { delete decoder_siso; decoder_siso = nullptr; }
@@ -53,6 +59,15 @@ public:
 	}
 
 protected:
+	// clones the decoder, the encoder and the puncturer of "c"
+	void deep_copy(const Codec_SISO &c)
+	{
+		Codec<B,Q>::deep_copy(c);
+
+		if (c.decoder_siso != nullptr)
+			this->decoder_siso = dynamic_cast<Decoder_SISO<Q>*>(c.decoder_siso->clone());
+	}
+
 	void set_decoder_siso(Decoder_SISO<Q>* dec)
 	{
 		this->decoder_siso = dec;
@@ -59,6 +59,25 @@ public:
 	{
 		this->get_decoder_siho()->reset();
 	}
+
+protected:
+	// clones the decoders, the encoder and the puncturer of "c" (a decoder shared by the SISO and the SIHO parts is
+	// cloned only once)
+	void deep_copy(const Codec_SISO_SIHO &c)
+	{
+		Codec<B,Q>::deep_copy(c);
+
+		if (c.decoder_siho != nullptr)
+			this->decoder_siho = dynamic_cast<Decoder_SIHO<B,Q>*>(c.decoder_siho->clone());
+
+		if (c.decoder_siso != nullptr)
+		{
+			if (dynamic_cast<const Decoder*>(c.decoder_siso) == dynamic_cast<const Decoder*>(c.decoder_siho))
+				this->decoder_siso = dynamic_cast<Decoder_SISO<Q>*>(this->decoder_siho);
+			else
+				this->decoder_siso = dynamic_cast<Decoder_SISO<Q>*>(c.decoder_siso->clone());
+		}
+	}
 };
 }
 }
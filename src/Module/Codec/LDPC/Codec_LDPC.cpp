@@ -52,7 +52,7 @@ Codec_LDPC<B,Q>
                    factory::Puncturer_LDPC::parameters *pct_params)
 : Codec          <B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   Codec_SISO_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
-  info_bits_pos(enc_params.K), dvbs2(nullptr)
+  dvbs2(nullptr)
 {
 	const std::string name = "Codec_LDPC";
 	this->set_name(name);
@@ -83,6 +83,14 @@ Codec_LDPC<B,Q>
 	}
 
 	// ---------------------------------------------------------------------------------------------------------- tools
+	// the tables are only written here, then they are shared (read-only) with the clones of the Codec
+	auto H             = std::make_shared<tools::Sparse_matrix >();
+	auto G             = std::make_shared<tools::Sparse_matrix >();
+	auto info_bits_pos = std::make_shared<std::vector<uint32_t>>(enc_params.K);
+	this->H             = H;
+	this->G             = G;
+	this->info_bits_pos = info_bits_pos;
+
 	bool is_info_bits_pos = false;
 	if (enc_params.type == "LDPC")
 	{
@@ -98,15 +106,15 @@ Codec_LDPC<B,Q>
 		}
 		else if (G_format == "QC")
 		{
-			G = tools::QC::read(file_G);
+			*G = tools::QC::read(file_G);
 		}
 		else if (G_format == "ALIST")
 		{
-			G = tools::AList::read(file_G);
+			*G = tools::AList::read(file_G);
 
 			try
 			{
-				info_bits_pos = tools::AList::read_info_bits_pos(file_G, this->K, this->N_cw);
+				*info_bits_pos = tools::AList::read_info_bits_pos(file_G, this->K, this->N_cw);
 				is_info_bits_pos = true;
 			}
 			catch (std::exception const&)
@@ -119,9 +127,9 @@ Codec_LDPC<B,Q>
 
 	if (enc_params.type == "LDPC_DVBS2")
 	{
-		dvbs2 = tools::build_dvbs2(this->K, this->N);
+		dvbs2.reset(tools::build_dvbs2(this->K, this->N));
 
-		H = tools::build_H(*dvbs2);
+		*H = tools::build_H(*dvbs2);
 	}
 	else
 	{
@@ -144,17 +152,17 @@ Codec_LDPC<B,Q>
 		}
 		else if (H_format == "QC")
 		{
-			H = tools::QC::read(file_H);
+			*H = tools::QC::read(file_H);
 			if (pct_params && pct_params->pattern.empty())
 				pct_params->pattern = tools::QC::read_pct_pattern(file_H);
 		}
 		else if (H_format == "ALIST")
 		{
-			H = tools::AList::read(file_H);
+			*H = tools::AList::read(file_H);
 
 			try
 			{
-				info_bits_pos = tools::AList::read_info_bits_pos(file_H, enc_params.K, enc_params.N_cw);
+				*info_bits_pos = tools::AList::read_info_bits_pos(file_H, enc_params.K, enc_params.N_cw);
 				is_info_bits_pos = true;
 			}
 			catch (std::exception const&) { }
@@ -164,20 +172,20 @@ Codec_LDPC<B,Q>
 	if (dec_params.H_reorder != "NONE")
 	{
 		// reorder the H matrix following the check node degrees
-		H.sort_cols_per_density(dec_params.H_reorder);
+		H->sort_cols_per_density(dec_params.H_reorder);
 	}
 
 	if (!is_info_bits_pos)
 	{
 		if (enc_params.type == "LDPC_H")
 		{
-			auto encoder_LDPC = factory::Encoder_LDPC::build<B>(enc_params, G, H);
-			info_bits_pos = encoder_LDPC->get_info_bits_pos();
+			auto encoder_LDPC = factory::Encoder_LDPC::build<B>(enc_params, *G, *H);
+			*info_bits_pos = encoder_LDPC->get_info_bits_pos();
 			delete encoder_LDPC;
 		}
 		else
 		{
-			std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
+			std::iota(info_bits_pos->begin(), info_bits_pos->end(), 0);
 		}
 	}
 
@@ -207,7 +215,7 @@ Codec_LDPC<B,Q>
 
 	try
 	{
-		this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H, dvbs2));
+		this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, *G, *H, dvbs2.get()));
 	}
 	catch (tools::cannot_allocate const&)
 	{
@@ -216,22 +224,44 @@ Codec_LDPC<B,Q>
 
 	try
 	{
-		auto decoder_siso_siho = factory::Decoder_LDPC::build_siso<B,Q>(dec_params, H, info_bits_pos, this->get_encoder());
+		auto decoder_siso_siho = factory::Decoder_LDPC::build_siso<B,Q>(dec_params, *H, *info_bits_pos, this->get_encoder());
 		this->set_decoder_siso(decoder_siso_siho);
 		this->set_decoder_siho(decoder_siso_siho);
 	}
 	catch (const std::exception&)
 	{
-		this->set_decoder_siho(factory::Decoder_LDPC::build<B,Q>(dec_params, H, info_bits_pos, this->get_encoder()));
+		this->set_decoder_siho(factory::Decoder_LDPC::build<B,Q>(dec_params, *H, *info_bits_pos, this->get_encoder()));
 	}
 }
 
+template <typename B, typename Q>
+Codec_LDPC<B,Q>
+::Codec_LDPC(const Codec_LDPC &c)
+: Codec          <B,Q>(c),
+  Codec_SISO_SIHO<B,Q>(c),
+  H(c.H), G(c.G), info_bits_pos(c.info_bits_pos), pctPattern(c.pctPattern), dvbs2(c.dvbs2)
+{
+}
+
 template <typename B, typename Q>
 Codec_LDPC<B,Q>
 ::~Codec_LDPC()
 {
-	if (dvbs2 != nullptr)
-		delete dvbs2;
+}
+
+template <typename B, typename Q>
+Codec_LDPC<B,Q>* Codec_LDPC<B,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Codec_LDPC::deep_copy);
+}
+
+template <typename B, typename Q>
+void Codec_LDPC<B,Q>
+::deep_copy(const Codec_LDPC &c)
+{
+	// the cloned encoder and decoders reference the tables shared by "c" and by this Codec (read only)
+	Codec_SISO_SIHO<B,Q>::deep_copy(c);
 }
 
 template <typename B, typename Q>
@@ -240,6 +270,7 @@ void Codec_LDPC<B,Q>
 {
 	const auto K    = this->K;
 	const auto N_cw = this->N_cw;
+	const auto &info_bits_pos = *this->info_bits_pos;
 
 	for (auto i = 0; i < K; i++)
 		sys[i] = Y_N[info_bits_pos[i]];
@@ -257,6 +288,7 @@ template <typename B, typename Q>
 void Codec_LDPC<B,Q>
 ::_extract_sys_llr(const Q *Y_N, Q *Y_K, const int frame_id)
 {
+	const auto &info_bits_pos = *this->info_bits_pos;
 	for (auto i = 0; i < this->K; i++)
 		Y_K[i] = Y_N[info_bits_pos[i]];
 }
@@ -265,6 +297,7 @@ template <typename B, typename Q>
 void Codec_LDPC<B,Q>
 ::_extract_sys_bit(const Q *Y_N, B *V_K, const int frame_id)
 {
+	const auto &info_bits_pos = *this->info_bits_pos;
 	for (auto i = 0; i < this->K; i++)
 		V_K[i] = Y_N[info_bits_pos[i]] >= 0 ? (B)0 : (B)1;
 }
@@ -1,6 +1,7 @@
 #ifndef CODEC_LDPC_HPP_
 #define CODEC_LDPC_HPP_
 
+#include <memory>
 #include <cstdint>
 
 #include "Factory/Module/Encoder/LDPC/Encoder_LDPC.hpp"
@@ -20,19 +21,24 @@ template <typename B = int, typename Q = float>
 class Codec_LDPC : public Codec_SISO_SIHO<B,Q>
 {
 protected:
-	tools::Sparse_matrix H;
-	tools::Sparse_matrix G;
-	std::vector<uint32_t> info_bits_pos;
+	// read-only tables, shared by the clones of the Codec
+	std::shared_ptr<const tools::Sparse_matrix > H;
+	std::shared_ptr<const tools::Sparse_matrix > G;
+	std::shared_ptr<const std::vector<uint32_t>> info_bits_pos;
 	std::vector<bool> pctPattern;
-	const tools::dvbs2_values* dvbs2;
+	std::shared_ptr<const tools::dvbs2_values  > dvbs2;
 
 public:
 	Codec_LDPC(const factory::Encoder_LDPC::parameters   &enc_params,
 	           const factory::Decoder_LDPC::parameters   &dec_params,
 	                 factory::Puncturer_LDPC::parameters *pct_params);
+	Codec_LDPC(const Codec_LDPC &c);
 	virtual ~Codec_LDPC();
+	virtual Codec_LDPC<B,Q>* clone() const;
 
 protected:
+	void deep_copy(const Codec_LDPC &c);
+
 	void _extract_sys_par(const Q *Y_N, Q *sys, Q *par, const int frame_id);
 	void _extract_sys_llr(const Q *Y_N, Q *Y_K,         const int frame_id);
 	void _extract_sys_bit(const Q *Y_N, B *V_K,         const int frame_id);
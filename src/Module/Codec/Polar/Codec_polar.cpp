@@ -17,7 +17,8 @@ Codec_polar<B,Q>
 : Codec          <B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   Codec_SISO_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
   adaptive_fb(fb_params.sigma == -1.f),
-  frozen_bits(fb_params.N_cw, true),
+  frozen_bits_ptr(std::make_shared<std::vector<bool>>(fb_params.N_cw, true)),
+  frozen_bits(*frozen_bits_ptr),
   generated_decoder((dec_params.implem.find("_SNR") != std::string::npos)),
   fb_generator     (nullptr),
   puncturer_wangliu(nullptr),
@@ -143,6 +144,24 @@ Codec_polar<B,Q>
 	}
 }
 
+// the frozen bits are shared but the generator is not: the clones can't adapt their frozen bits (see deep_copy)
+template <typename B, typename Q>
+Codec_polar<B,Q>
+::Codec_polar(const Codec_polar &c)
+: Codec          <B,Q>(c),
+  Codec_SISO_SIHO<B,Q>(c),
+  tools::Frozenbits_notifier(),
+  adaptive_fb      (c.adaptive_fb),
+  frozen_bits_ptr  (c.frozen_bits_ptr),
+  frozen_bits      (*frozen_bits_ptr),
+  generated_decoder(c.generated_decoder),
+  fb_generator     (nullptr),
+  puncturer_wangliu(nullptr),
+  fb_decoder       (nullptr),
+  fb_encoder       (nullptr)
+{
+}
+
 template <typename B, typename Q>
 Codec_polar<B,Q>
 ::~Codec_polar()
@@ -150,6 +169,36 @@ Codec_polar<B,Q>
 	if (fb_generator != nullptr) { delete fb_generator; fb_generator = nullptr; }
 }
 
+template <typename B, typename Q>
+Codec_polar<B,Q>* Codec_polar<B,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Codec_polar::deep_copy);
+}
+
+template <typename B, typename Q>
+void Codec_polar<B,Q>
+::deep_copy(const Codec_polar &c)
+{
+	// the cloned encoder and decoder reference the frozen bits shared with "c", they can't be updated by the clones
+	if (c.adaptive_fb || c.generated_decoder)
+	{
+		std::stringstream message;
+		message << "A Codec_polar with adaptive frozen bits or with a generated decoder can't be cloned "
+		        << "('adaptive_fb' = " << c.adaptive_fb << ", 'generated_decoder' = " << c.generated_decoder << ").";
+		throw tools::unimplemented_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	Codec_SISO_SIHO<B,Q>::deep_copy(c);
+
+	if (c.puncturer_wangliu != nullptr)
+		this->puncturer_wangliu = dynamic_cast<Puncturer_polar_wangliu<B,Q>*>(this->get_puncturer());
+	if (c.fb_encoder != nullptr)
+		this->fb_encoder = dynamic_cast<tools::Frozenbits_notifier*>(this->get_encoder());
+	if (c.fb_decoder != nullptr)
+		this->fb_decoder = dynamic_cast<tools::Frozenbits_notifier*>(this->get_decoder_siho());
+}
+
 template <typename B, typename Q>
 void Codec_polar<B,Q>
 ::notify_frozenbits_update()
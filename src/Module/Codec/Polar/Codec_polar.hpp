@@ -1,6 +1,8 @@
 #ifndef CODEC_POLAR_HPP_
 #define CODEC_POLAR_HPP_
 
+#include <memory>
+
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator.hpp"
 #include "Tools/Code/Polar/Frozenbits_notifier.hpp"
 
@@ -22,7 +24,8 @@ class Codec_polar : public Codec_SISO_SIHO<B,Q>, public tools::Frozenbits_notifi
 {
 protected:
 	const bool adaptive_fb;
-	std::vector<bool> frozen_bits; // known bits (alias frozen bits) are set to true
+	std::shared_ptr<std::vector<bool>> frozen_bits_ptr; // shared with the clones (read-only if not adaptive)
+	std::vector<bool> &frozen_bits; // known bits (alias frozen bits) are set to true
 	const bool generated_decoder;
 	tools::Frozenbits_generator *fb_generator;
 	Puncturer_polar_wangliu<B,Q> *puncturer_wangliu;
@@ -35,7 +38,9 @@ public:
 	            const factory::Decoder_polar       ::parameters &dec_par,
 	            const factory::Puncturer_polar     ::parameters *pct_par = nullptr,
 	            CRC<B>* crc = nullptr);
+	Codec_polar(const Codec_polar &c);
 	virtual ~Codec_polar();
+	virtual Codec_polar<B,Q>* clone() const;
 
 	void set_sigma(const float sigma);
 
@@ -44,6 +49,8 @@ public:
 	virtual void notify_frozenbits_update();
 
 protected:
+	void deep_copy(const Codec_polar &c);
+
 	void _extract_sys_par(const Q *Y_N, Q *sys, Q *par, const int frame_id);
 	void _extract_sys_llr(const Q *Y_N, Q *sys,         const int frame_id);
 	void _add_sys_ext    (const Q *ext, Q *Y_N,         const int frame_id);
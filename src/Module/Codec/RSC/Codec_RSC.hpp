@@ -1,6 +1,8 @@
 #ifndef CODEC_RSC_HPP_
 #define CODEC_RSC_HPP_
 
+#include <memory>
+
 #include "Factory/Module/Encoder/RSC/Encoder_RSC.hpp"
 #include "Factory/Module/Decoder/RSC/Decoder_RSC.hpp"
 
@@ -15,12 +17,13 @@ class Codec_RSC : public Codec_SISO_SIHO<B,Q>
 {
 protected:
 	const bool buffered_encoding;
-	std::vector<std::vector<int>> trellis;
+	std::shared_ptr<const std::vector<std::vector<int>>> trellis; // read-only, shared by the clones
 
 public:
 	Codec_RSC(const factory::Encoder_RSC::parameters &enc_params,
 	          const factory::Decoder_RSC::parameters &dec_params);
 	virtual ~Codec_RSC();
+	virtual Codec_RSC<B,Q>* clone() const;
 
 protected:
 	void _extract_sys_par(const Q *Y_N, Q *sys, Q *par, const int frame_id);
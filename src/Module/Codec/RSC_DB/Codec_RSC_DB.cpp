@@ -50,7 +50,7 @@ Codec_RSC_DB<B,Q>
 	enc_cpy.type = "RSC_DB";
 
 	auto encoder_RSC = factory::Encoder_RSC_DB::build<B>(enc_cpy);
-	trellis = encoder_RSC->get_trellis();
+	trellis = std::make_shared<std::vector<std::vector<int>>>(encoder_RSC->get_trellis());
 	delete encoder_RSC;
 
 	// ---------------------------------------------------------------------------------------------------- allocations
@@ -74,13 +74,13 @@ Codec_RSC_DB<B,Q>
 
 	try
 	{
-		auto decoder_siso_siho = factory::Decoder_RSC_DB::build_siso<B,Q>(dec_params, trellis, this->get_encoder());
+		auto decoder_siso_siho = factory::Decoder_RSC_DB::build_siso<B,Q>(dec_params, *trellis, this->get_encoder());
 		this->set_decoder_siso(decoder_siso_siho);
 		this->set_decoder_siho(decoder_siso_siho);
 	}
 	catch (tools::cannot_allocate const&)
 	{
-		this->set_decoder_siho(factory::Decoder_RSC_DB::build<B,Q>(dec_params, trellis, this->get_encoder()));
+		this->set_decoder_siho(factory::Decoder_RSC_DB::build<B,Q>(dec_params, *trellis, this->get_encoder()));
 	}
 }
 
@@ -90,6 +90,13 @@ Codec_RSC_DB<B,Q>
 {
 }
 
+template <typename B, typename Q>
+Codec_RSC_DB<B,Q>* Codec_RSC_DB<B,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Codec_RSC_DB::deep_copy);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -1,6 +1,8 @@
 #ifndef CODEC_RSC_DB_HPP_
 #define CODEC_RSC_DB_HPP_
 
+#include <memory>
+
 #include "Factory/Module/Encoder/RSC_DB/Encoder_RSC_DB.hpp"
 #include "Factory/Module/Decoder/RSC_DB/Decoder_RSC_DB.hpp"
 
@@ -15,12 +17,13 @@ class Codec_RSC_DB : public Codec_SISO_SIHO<B,Q>
 {
 protected:
 	const bool buffered_encoding;
-	std::vector<std::vector<int>> trellis;
+	std::shared_ptr<const std::vector<std::vector<int>>> trellis; // read-only, shared by the clones
 
 public:
 	Codec_RSC_DB(const factory::Encoder_RSC_DB::parameters &enc_params,
 	             const factory::Decoder_RSC_DB::parameters &dec_params);
 	virtual ~Codec_RSC_DB();
+	virtual Codec_RSC_DB<B,Q>* clone() const;
 };
 }
 }
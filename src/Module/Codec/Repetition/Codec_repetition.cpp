@@ -70,6 +70,13 @@ Codec_repetition<B,Q>
 {
 }
 
+template <typename B, typename Q>
+Codec_repetition<B,Q>* Codec_repetition<B,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Codec_repetition::deep_copy);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
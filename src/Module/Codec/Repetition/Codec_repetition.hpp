@@ -17,6 +17,7 @@ public:
 	Codec_repetition(const factory::Encoder_repetition::parameters &enc_params,
 	                 const factory::Decoder_repetition::parameters &dec_params);
 	virtual ~Codec_repetition();
+	virtual Codec_repetition<B,Q>* clone() const;
 };
 }
 }
@@ -82,6 +82,13 @@ Codec_uncoded<B,Q>
 {
 }
 
+template <typename B, typename Q>
+Codec_uncoded<B,Q>* Codec_uncoded<B,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Codec_uncoded::deep_copy);
+}
+
 template <typename B, typename Q>
 void Codec_uncoded<B,Q>
 ::_extract_sys_par(const Q *Y_N, Q *sys, Q *par, const int frame_id)
@@ -17,6 +17,7 @@ public:
 	Codec_uncoded(const factory::Encoder   ::parameters &enc_params,
 	              const factory::Decoder_NO::parameters &dec_params);
 	virtual ~Codec_uncoded();
+	virtual Codec_uncoded<B,Q>* clone() const;
 
 protected:
 	void _extract_sys_par(const Q *Y_N, Q *sys, Q *par, const int frame_id);
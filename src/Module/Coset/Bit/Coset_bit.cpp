@@ -15,6 +15,12 @@ Coset_bit<B,D>::~Coset_bit()
 {
 }
 
+template <typename B, typename D>
+Coset_bit<B,D>* Coset_bit<B,D>::clone() const
+{
+	return Module::clone_impl(*this, &Coset_bit::deep_copy);
+}
+
 template <typename B, typename D>
 void Coset_bit<B,D>::_apply(const B *ref, const D *in, D *out, const int frame_id)
 {
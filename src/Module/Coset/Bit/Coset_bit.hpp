@@ -18,6 +18,7 @@ public:
 	Coset_bit(const int size, const int n_frames = 1);
 
 	virtual ~Coset_bit();
+	virtual Coset_bit<B,D>* clone() const;
 
 protected:
 	void _apply(const B *ref, const D *in, D *out, const int frame_id);
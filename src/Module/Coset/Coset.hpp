@@ -85,6 +85,14 @@ public:
 		});
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Coset (see Module::clone).
+	 */
+	Coset(const Coset &c)
+	: Coset(c.size, c.n_frames)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
@@ -15,6 +15,12 @@ Coset_real<B,D>::~Coset_real()
 {
 }
 
+template <typename B, typename D>
+Coset_real<B,D>* Coset_real<B,D>::clone() const
+{
+	return Module::clone_impl(*this, &Coset_real::deep_copy);
+}
+
 template <typename B, typename D>
 void Coset_real<B,D>::_apply(const B *ref, const D *in, D *out, const int frame_id)
 {
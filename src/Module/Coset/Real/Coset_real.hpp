@@ -18,6 +18,7 @@ public:
 	Coset_real(const int size, const int n_frames = 1);
 
 	virtual ~Coset_real();
+	virtual Coset_real<B,D>* clone() const;
 
 protected:
 	void _apply(const B *ref, const D *in, D *out, const int frame_id);
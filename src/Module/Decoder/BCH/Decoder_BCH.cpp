@@ -35,6 +35,13 @@ Decoder_BCH<B, R>
 {
 }
 
+template <typename B, typename R>
+Decoder_BCH<B, R>* Decoder_BCH<B, R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_BCH::deep_copy);
+}
+
 template <typename B, typename R>
 void Decoder_BCH<B, R>
 ::_decode(B *Y_N)
@@ -203,84 +210,68 @@ template <typename B, typename R>
 void Decoder_BCH<B, R>
 ::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_hiho], dec::tm::decode_hiho::load); // ---------------------------- LOAD
 	std::copy(Y_N, Y_N + this->N, YH_N.begin());
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_hiho], dec::tm::decode_hiho::decode); // ----------------------- DECODE
 	this->_decode(YH_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_hiho], dec::tm::decode_hiho::store); // ------------------------- STORE
 	std::copy(YH_N.data() + this->N - this->K, YH_N.data() + this->N, V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::load,   d_load);
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::decode, d_decod);
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_BCH<B, R>
 ::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_hiho_cw], dec::tm::decode_hiho_cw::load); // ---------------------- LOAD
 	std::copy(Y_N, Y_N + this->N, YH_N.begin());
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_hiho_cw], dec::tm::decode_hiho_cw::decode); // ----------------- DECODE
 	this->_decode(YH_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_hiho_cw], dec::tm::decode_hiho_cw::store); // ------------------- STORE
 	std::copy(YH_N.data(), YH_N.data() + this->N, V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_BCH<B, R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::load); // ---------------------------- LOAD
 	tools::hard_decide(Y_N, YH_N.data(), this->N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode); // ----------------------- DECODE
 	this->_decode(YH_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	std::copy(YH_N.data() + this->N - this->K, YH_N.data() + this->N, V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_BCH<B, R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::load); // ---------------------- LOAD
 	tools::hard_decide(Y_N, YH_N.data(), this->N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::decode); // ----------------- DECODE
 	this->_decode(YH_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::store); // ------------------- STORE
 	std::copy(YH_N.data(), YH_N.data() + this->N, V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	t_store.stop();
 }
 
 // ==================================================================================== explicit template instantiation
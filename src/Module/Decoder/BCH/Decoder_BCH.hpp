@@ -36,6 +36,7 @@ protected:
 public:
 	Decoder_BCH(const int& K, const int& N, const tools::BCH_polynomial_generator &GF, const int n_frames = 1);
 	virtual ~Decoder_BCH();
+	virtual Decoder_BCH<B,R>* clone() const;
 
 protected:
 	void _decode        (      B *Y_N                            );
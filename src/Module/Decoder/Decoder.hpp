@@ -10,6 +10,7 @@
 #include "Tools/Exception/exception.hpp"
 
 #include "Module/Module.hpp"
+#include "Module/Task_timer.hpp"
 
 namespace aff3ct
 {
@@ -37,6 +38,9 @@ namespace module
 			namespace decode_hiho_cw{ enum list { load, decode, store       , SIZE }; }
 			namespace decode_siho   { enum list { load, decode, store, total, SIZE }; }
 			namespace decode_siho_cw{ enum list { load, decode, store, total, SIZE }; }
+
+			// extra timers of the "decode_siho" task registered by the turbo decoders (one per half-iteration)
+			namespace decode_siho_turbo{ enum list { siso_n = decode_siho::SIZE, siso_i, SIZE }; }
 		}
 	}
 
@@ -50,6 +54,8 @@ protected:
 	const int simd_inter_frame_level; /*!< Number of frames absorbed by the SIMD instructions. */
 	const int n_dec_waves;
 
+	unsigned long long n_ite_done; /*!< Number of iterations performed by an iterative decoder (summed over the frames). */
+
 public:
 	Decoder(const int K, const int N, const int n_frames = 1, const int simd_inter_frame_level = 1)
 	: Module(n_frames),
@@ -57,7 +63,8 @@ public:
 	  K(K),
 	  N(N),
 	  simd_inter_frame_level(simd_inter_frame_level),
-	  n_dec_waves((int)std::ceil((float)this->n_frames / (float)simd_inter_frame_level))
+	  n_dec_waves((int)std::ceil((float)this->n_frames / (float)simd_inter_frame_level)),
+	  n_ite_done(0)
 	{
 		const std::string name = "Decoder";
 		this->set_name(name);
@@ -97,6 +104,14 @@ public:
 			this->tasks_with_nullptr[t] = nullptr;
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Decoder (see Module::clone).
+	 */
+	Decoder(const Decoder &d)
+	: Decoder(d.K, d.N, d.n_frames, d.simd_inter_frame_level)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
@@ -129,6 +144,24 @@ public:
 		return this->n_dec_waves;
 	}
 
+	/*!
+	 * \brief Gets the number of iterations performed since the last call to "reset_n_ite_done".
+	 *
+	 * The iterations are summed over the decoded frames (the frames of an incomplete SIMD wave included), the
+	 * non-iterative decoders always return 0.
+	 *
+	 * \return the number of iterations performed.
+	 */
+	unsigned long long get_n_ite_done() const
+	{
+		return this->n_ite_done;
+	}
+
+	void reset_n_ite_done()
+	{
+		this->n_ite_done = 0;
+	}
+
 	virtual void reset() {};
 };
 }
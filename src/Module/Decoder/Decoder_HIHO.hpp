@@ -85,6 +85,14 @@ public:
 		this->register_timer(p2, "store");
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Decoder_HIHO (see Module::clone).
+	 */
+	Decoder_HIHO(const Decoder_HIHO &d)
+	: Decoder_HIHO(d.K, d.N, d.n_frames, d.simd_inter_frame_level)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
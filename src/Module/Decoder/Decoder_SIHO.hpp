@@ -89,6 +89,14 @@ public:
 		this->register_timer(p2, "total");
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Decoder_SIHO (see Module::clone).
+	 */
+	Decoder_SIHO(const Decoder_SIHO &d)
+	: Decoder_SIHO(d.K, d.N, d.n_frames, d.simd_inter_frame_level)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
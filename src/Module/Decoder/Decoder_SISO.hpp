@@ -67,6 +67,14 @@ public:
 		});
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Decoder_SISO (see Module::clone).
+	 */
+	Decoder_SISO(const Decoder_SISO &d)
+	: Decoder_SISO(d.K, d.N, d.n_frames, d.simd_inter_frame_level)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
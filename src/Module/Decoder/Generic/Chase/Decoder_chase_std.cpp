@@ -24,7 +24,8 @@ Decoder_chase_std<B,R>
   hamming(hamming),
   min_euclidean_dist(std::numeric_limits<float>::max()),
   min_hamming_dist(std::numeric_limits<uint32_t>::max()),
-  best_test(0)
+  best_test(0),
+  encoder_clone(nullptr)
 {
 	const std::string name = "Decoder_chase_std";
 	this->set_name(name);
@@ -45,10 +46,36 @@ Decoder_chase_std<B,R>
 	}
 }
 
+template <typename B, typename R>
+Decoder_chase_std<B,R>
+::Decoder_chase_std(const Decoder_chase_std &d)
+: Decoder          (d),
+  Decoder_SIHO<B,R>(d),
+  encoder(*dynamic_cast<Encoder<B>*>(d.encoder.clone())),
+  best_X_N(d.best_X_N),
+  less_reliable_llrs(d.less_reliable_llrs),
+  max_flips(d.max_flips),
+  hamming(d.hamming),
+  min_euclidean_dist(d.min_euclidean_dist),
+  min_hamming_dist(d.min_hamming_dist),
+  best_test(d.best_test),
+  encoder_clone(&this->encoder)
+{
+}
+
 template <typename B, typename R>
 Decoder_chase_std<B,R>
 ::~Decoder_chase_std()
 {
+	if (encoder_clone != nullptr)
+		delete encoder_clone;
+}
+
+template <typename B, typename R>
+Decoder_chase_std<B,R>* Decoder_chase_std<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_chase_std::deep_copy);
 }
 
 template <typename B, typename R>
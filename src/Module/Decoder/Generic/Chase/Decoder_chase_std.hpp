@@ -22,10 +22,20 @@ protected:
 	uint32_t min_hamming_dist;
 	uint32_t best_test;
 
+private:
+	Encoder<B>* encoder_clone; // the encoder owned by the cloned decoders (nullptr otherwise)
+
 public:
 	Decoder_chase_std(const int K, const int N, Encoder<B> &encoder, const uint32_t max_flips = 3, 
 	                  const bool hamming = false, const int n_frames = 1);
+
+	/*!
+	 * \brief Copy constructor, the encoder is cloned to be used by the new decoder only (see Module::clone).
+	 */
+	Decoder_chase_std(const Decoder_chase_std &d);
+
 	virtual ~Decoder_chase_std();
+	virtual Decoder_chase_std<B,R>* clone() const;
 
 protected:
 	void _decode_siho   (const R *Y_N,  B *V_K, const int frame_id);
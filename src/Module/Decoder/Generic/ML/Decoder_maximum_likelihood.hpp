@@ -20,12 +20,20 @@ protected:
 	std::vector<B> best_X_N;
 	std::vector<B> hard_Y_N;
 
+private:
+	Encoder<B>* encoder_clone; // the encoder owned by the cloned decoders (nullptr otherwise)
+
 public:
 	virtual ~Decoder_maximum_likelihood();
 
 protected:
 	Decoder_maximum_likelihood(const int K, const int N, Encoder<B> &encoder, const int n_frames = 1);
 
+	/*!
+	 * \brief Copy constructor, the encoder is cloned to be used by the new decoder only (see Module::clone).
+	 */
+	Decoder_maximum_likelihood(const Decoder_maximum_likelihood &d);
+
 	inline float    compute_euclidean_dist(const B *X_N, const R *Y_N) const;
 	inline uint32_t compute_hamming_dist  (const B *X_N, const B *Y_N) const;
 };
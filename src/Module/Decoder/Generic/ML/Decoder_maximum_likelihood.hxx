@@ -21,7 +21,8 @@ Decoder_maximum_likelihood<B,R>
   X_N(N+7), // +7 to avoid segmentation fault when casting B to uint64_t
   best_U_K(K),
   best_X_N(N),
-  hard_Y_N(N)
+  hard_Y_N(N),
+  encoder_clone(nullptr)
 {
 	const std::string name = "Decoder_maximum_likelihood";
 	this->set_name(name);
@@ -43,10 +44,27 @@ Decoder_maximum_likelihood<B,R>
 	}
 }
 
+template <typename B, typename R>
+Decoder_maximum_likelihood<B,R>
+::Decoder_maximum_likelihood(const Decoder_maximum_likelihood &d)
+: Decoder               (d),
+  Decoder_SIHO_HIHO<B,R>(d),
+  encoder(*dynamic_cast<Encoder<B>*>(d.encoder.clone())),
+  U_K(d.U_K),
+  X_N(d.X_N),
+  best_U_K(d.best_U_K),
+  best_X_N(d.best_X_N),
+  hard_Y_N(d.hard_Y_N),
+  encoder_clone(&this->encoder)
+{
+}
+
 template <typename B, typename R>
 Decoder_maximum_likelihood<B,R>
 ::~Decoder_maximum_likelihood()
 {
+	if (encoder_clone != nullptr)
+		delete encoder_clone;
 }
 
 template <typename B, typename R>
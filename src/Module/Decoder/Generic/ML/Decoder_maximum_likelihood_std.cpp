@@ -43,6 +43,13 @@ Decoder_maximum_likelihood_std<B,R>
 {
 }
 
+template <typename B, typename R>
+Decoder_maximum_likelihood_std<B,R>* Decoder_maximum_likelihood_std<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_maximum_likelihood_std::deep_copy);
+}
+
 template <typename B, typename R>
 void Decoder_maximum_likelihood_std<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
@@ -20,6 +20,7 @@ public:
 	Decoder_maximum_likelihood_std(const int K, const int N, Encoder<B> &encoder, const bool hamming = false,
 	                               const int n_frames = 1);
 	virtual ~Decoder_maximum_likelihood_std();
+	virtual Decoder_maximum_likelihood_std<B,R>* clone() const;
 
 protected:
 	void _decode_siho   (const R *Y_N,  B *V_K, const int frame_id);
@@ -20,6 +20,7 @@ public:
 	                                              const int syndrome_depth = 1,
 	                                              const int n_frames = 1);
 	virtual ~Decoder_LDPC_BP_flooding_approximate_min_star();
+	virtual Decoder_LDPC_BP_flooding_approximate_min_star<B,R,MIN>* clone() const;
 
 protected:
 	// BP functions for decoding
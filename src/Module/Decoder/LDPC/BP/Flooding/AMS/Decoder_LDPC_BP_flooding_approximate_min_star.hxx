@@ -35,6 +35,13 @@ Decoder_LDPC_BP_flooding_approximate_min_star<B,R,MIN>
 {
 }
 
+template <typename B, typename R, tools::proto_min<R> MIN>
+Decoder_LDPC_BP_flooding_approximate_min_star<B,R,MIN>* Decoder_LDPC_BP_flooding_approximate_min_star<B,R,MIN>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_LDPC_BP_flooding_approximate_min_star::deep_copy);
+}
+
 // normalized offest min-sum implementation
 template <typename B, typename R, tools::proto_min<R> MIN>
 void Decoder_LDPC_BP_flooding_approximate_min_star<B,R,MIN>
@@ -64,7 +71,7 @@ void Decoder_LDPC_BP_flooding_approximate_min_star<B,R,MIN>
 		V_to_C_ptr += length; // jump to the next node
 	}
 
-	auto transpose_ptr = this->transpose.data();
+	auto transpose_ptr = this->transpose->data();
 
 	for (auto i = 0; i < this->n_C_nodes; i++)
 	{
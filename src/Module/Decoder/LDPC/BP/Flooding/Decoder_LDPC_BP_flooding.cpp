@@ -35,7 +35,7 @@ Decoder_LDPC_BP_flooding<B,R>
 	const std::string name = "Decoder_LDPC_BP_flooding";
 	this->set_name(name);
 	
-	transpose.resize(this->n_branches);
+	auto transpose = std::make_shared<std::vector<unsigned int>>(this->n_branches);
 	mipp::vector<unsigned char> connections(H.get_n_rows(), 0);
 
 	const auto &CN_to_VN = H.get_col_to_rows();
@@ -63,10 +63,11 @@ Decoder_LDPC_BP_flooding<B,R>
 				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 			}
 
-			transpose[k] = branch_id;
+			(*transpose)[k] = branch_id;
 			k++;
 		}
 	}
+	this->transpose = transpose;
 
 	n_variables_per_parity.resize(H.get_n_cols());
 	for (auto i = 0; i < (int)H.get_n_cols(); i++)
@@ -117,7 +118,7 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_flooding<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::load); // ---------------------------- LOAD
 	// memory zones initialization
 	if (this->init_flag)
 	{
@@ -126,32 +127,28 @@ void Decoder_LDPC_BP_flooding<B,R>
 		if (frame_id == Decoder_SIHO<B,R>::n_frames -1)
 			this->init_flag = false;
 	}
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode); // ----------------------- DECODE
 	// actual decoding
 	this->BP_decode(Y_N, frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	// take the hard decision
 	for (auto i = 0; i < this->K; i++)
 	{
 		const auto k = this->info_bits_pos[i];
 		V_K[i] = !(this->Lp_N[k] >= 0);
 	}
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::load); // ---------------------- LOAD
 	// memory zones initialization
 	if (this->init_flag)
 	{
@@ -160,20 +157,16 @@ void Decoder_LDPC_BP_flooding<B,R>
 		if (frame_id == Decoder_SIHO<B,R>::n_frames -1)
 			this->init_flag = false;
 	}
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::decode); // ----------------- DECODE
 	// actual decoding
 	this->BP_decode(Y_N, frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::store); // ------------------- STORE
 	tools::hard_decide(this->Lp_N.data(), V_N, this->N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	t_store.stop();
 }
 
 // BP algorithm
@@ -186,6 +179,7 @@ void Decoder_LDPC_BP_flooding<B,R>
 	{
 		// specific inner code depending on the selected implementation (min-sum or sum-product for example)
 		this->BP_process(Y_N, this->V_to_C[frame_id], this->C_to_V[frame_id]);
+		this->n_ite_done++;
 
 		// make a saturation
 		// saturate<R>(this->C_to_V, (R)-C_to_V_max, (R)C_to_V_max);
@@ -1,6 +1,8 @@
 #ifndef DECODER_LDPC_BP_FLOODING_HPP_
 #define DECODER_LDPC_BP_FLOODING_HPP_
 
+#include <memory>
+
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
 
 #include "../Decoder_LDPC_BP.hpp"
@@ -27,7 +29,7 @@ protected:
 
 	std::vector<unsigned char> n_variables_per_parity;
 	std::vector<unsigned char> n_parities_per_variable;
-	std::vector<unsigned int > transpose;
+	std::shared_ptr<const std::vector<unsigned int>> transpose; // read-only, shared by the clones of the decoder
 
 	// data structures for iterative decoding
 	            std::vector<R>  Lp_N;   // a posteriori information
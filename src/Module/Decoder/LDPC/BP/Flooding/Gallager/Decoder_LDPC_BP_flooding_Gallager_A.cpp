@@ -27,7 +27,7 @@ Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_A";
 	this->set_name(name);
 	
-	transpose.resize(H.get_n_connections());
+	auto transpose = std::make_shared<std::vector<unsigned>>(H.get_n_connections());
 	std::vector<unsigned char> connections(H.get_n_rows(), 0);
 
 	const auto &CN_to_VN = H.get_col_to_rows();
@@ -55,10 +55,11 @@ Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 			}
 
-			transpose[k] = branch_id;
+			(*transpose)[k] = branch_id;
 			k++;
 		}
 	}
+	this->transpose = transpose;
 }
 
 template <typename B, typename R>
@@ -67,6 +68,13 @@ Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 {
 }
 
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_A<B,R>* Decoder_LDPC_BP_flooding_Gallager_A<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_LDPC_BP_flooding_Gallager_A::deep_copy);
+}
+
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode(const B *Y_N)
@@ -102,7 +110,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 		}
 
 		// C -> V (for each check nodes)
-		auto transpose_ptr = this->transpose.data();
+		auto transpose_ptr = this->transpose->data();
 		for (auto i = 0; i < (int)this->H.get_n_cols(); i++)
 		{
 			const auto node_degree = (int)this->H.get_col_to_rows()[i].size();
@@ -118,6 +126,7 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 
 			transpose_ptr += node_degree; // jump to the next node
 		}
+		this->n_ite_done++;
 
 		if (this->enable_syndrome && ite != this->n_ite -1)
 		{
@@ -169,76 +178,62 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_hiho], dec::tm::decode_hiho::decode); // ----------------------- DECODE
 	this->_decode(Y_N);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_hiho], dec::tm::decode_hiho::store); // ------------------------- STORE
 	for (auto i = 0; i < this->K; i++)
 		V_K[i] = (B)this->V_N[this->info_bits_pos[i]];
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::decode, d_decod);
-//	(*this)[dec::tsk::decode_hiho].update_timer(dec::tm::decode_hiho::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_hiho_cw], dec::tm::decode_hiho_cw::decode); // ----------------- DECODE
 	this->_decode(Y_N);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_hiho_cw], dec::tm::decode_hiho_cw::store); // ------------------- STORE
 	std::copy(this->V_N.begin(), this->V_N.begin() + this->N, V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_hiho_cw].update_timer(dec::tm::decode_hiho_cw::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::load); // ---------------------------- LOAD
 	hard_decision.decode_siho(Y_N, HY_N.data());
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode); // ----------------------- DECODE
 	this->_decode(HY_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	for (auto i = 0; i < this->K; i++)
 		V_K[i] = (B)this->V_N[this->info_bits_pos[i]];
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::load); // ---------------------- LOAD
 	hard_decision.decode_siho(Y_N, HY_N.data());
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::decode); // ----------------- DECODE
 	this->_decode(HY_N.data());
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::store); // ------------------- STORE
 	std::copy(this->V_N.begin(), this->V_N.begin() + this->N, V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	t_store.stop();
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -1,6 +1,7 @@
 #ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_A_HPP_
 #define DECODER_LDPC_BP_FLOODING_GALLAGER_A_HPP_
 
+#include <memory>
 #include <cstdint>
 
 #include "Module/Decoder/NO/Decoder_NO.hpp"
@@ -25,7 +26,7 @@ protected:
 	std::vector<int8_t>          V_N;             // decoded bits
 	std::vector<int8_t>          C_to_V_messages; // check    nodes to variable nodes messages
 	std::vector<int8_t>          V_to_C_messages; // variable nodes to check    nodes messages
-	std::vector<unsigned>        transpose;
+	std::shared_ptr<const std::vector<unsigned>> transpose; // read-only, shared by the clones of the decoder
 
 public:
 	Decoder_LDPC_BP_flooding_Gallager_A(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
@@ -34,6 +35,7 @@ public:
 	                                    const int syndrome_depth = 1,
 	                                    const int n_frames = 1);
 	virtual ~Decoder_LDPC_BP_flooding_Gallager_A();
+	virtual Decoder_LDPC_BP_flooding_Gallager_A<B,R>* clone() const;
 
 protected:
 	void _decode        (const B *Y_N                            );
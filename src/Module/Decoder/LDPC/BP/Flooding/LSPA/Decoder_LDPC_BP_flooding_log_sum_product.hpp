@@ -21,6 +21,7 @@ public:
 	                                         const int syndrome_depth = 1,
 	                                         const int n_frames = 1);
 	virtual ~Decoder_LDPC_BP_flooding_log_sum_product();
+	virtual Decoder_LDPC_BP_flooding_log_sum_product<B,R>* clone() const;
 
 protected:
 	// BP functions for decoding
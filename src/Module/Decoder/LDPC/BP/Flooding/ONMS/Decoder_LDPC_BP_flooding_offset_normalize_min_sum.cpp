@@ -73,6 +73,13 @@ Decoder_LDPC_BP_flooding_offset_normalize_min_sum<B,R>
 {
 }
 
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_offset_normalize_min_sum<B,R>* Decoder_LDPC_BP_flooding_offset_normalize_min_sum<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_LDPC_BP_flooding_offset_normalize_min_sum::deep_copy);
+}
+
 // normalized offest min-sum implementation
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_offset_normalize_min_sum<B,R>
@@ -102,7 +109,7 @@ void Decoder_LDPC_BP_flooding_offset_normalize_min_sum<B,R>
 		V_to_C_ptr += length; // jump to the next node
 	}
 
-	auto transpose_ptr = this->transpose.data();
+	auto transpose_ptr = this->transpose->data();
 
 	for (auto i = 0; i < this->n_C_nodes; i++)
 	{
@@ -24,6 +24,7 @@ public:
 	                                                  const int syndrome_depth = 1,
 	                                                  const int n_frames = 1);
 	virtual ~Decoder_LDPC_BP_flooding_offset_normalize_min_sum();
+	virtual Decoder_LDPC_BP_flooding_offset_normalize_min_sum<B,R>* clone() const;
 
 protected:
 	// BP functions for decoding
@@ -34,6 +34,13 @@ Decoder_LDPC_BP_flooding_sum_product<B,R>
 {
 }
 
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_sum_product<B,R>* Decoder_LDPC_BP_flooding_sum_product<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_LDPC_BP_flooding_sum_product::deep_copy);
+}
+
 // log sum-product implementation
 template <typename B, typename R>
 void Decoder_LDPC_BP_flooding_sum_product<B,R>
@@ -63,7 +70,7 @@ void Decoder_LDPC_BP_flooding_sum_product<B,R>
 		V_to_C_ptr += length; // jump to the next node
 	}
 
-	auto transpose_ptr = this->transpose.data();
+	auto transpose_ptr = this->transpose->data();
 	for (auto i = 0; i < this->n_C_nodes; i++)
 	{
 		const auto length = this->n_variables_per_parity[i];
@@ -84,49 +84,41 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_layered<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::load); // ---------------------------- LOAD
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode); // ----------------------- DECODE
 	// actual decoding
 	this->BP_decode(frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	// take the hard decision
 	for (auto i = 0; i < this->K; i++)
 	{
 		const auto k = this->info_bits_pos[i];
 		V_K[i] = !(this->var_nodes[frame_id][k] >= 0);
 	}
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_layered<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::load); // ---------------------- LOAD
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::decode); // ----------------- DECODE
 	// actual decoding
 	this->BP_decode(frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::store); // ------------------- STORE
 	tools::hard_decide(this->var_nodes[frame_id].data(), V_N, this->N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	t_store.stop();
 }
 
 // BP algorithm
@@ -137,6 +129,7 @@ void Decoder_LDPC_BP_layered<B,R>
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
 		this->BP_process(this->var_nodes[frame_id], this->branches[frame_id]);
+		this->n_ite_done++;
 
 		if (this->check_syndrome_soft(this->var_nodes[frame_id].data()))
 			break;
@@ -22,6 +22,7 @@ public:
 	                                        const int syndrome_depth = 1,
 	                                        const int n_frames = 1);
 	virtual ~Decoder_LDPC_BP_layered_log_sum_product();
+	virtual Decoder_LDPC_BP_layered_log_sum_product<B,R>* clone() const;
 
 protected:
 	void BP_process(std::vector<R> &var_nodes, std::vector<R> &branches);
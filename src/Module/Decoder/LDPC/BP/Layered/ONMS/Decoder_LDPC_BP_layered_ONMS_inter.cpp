@@ -57,6 +57,13 @@ Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 {
 }
 
+template <typename B, typename R>
+Decoder_LDPC_BP_layered_ONMS_inter<B,R>* Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_LDPC_BP_layered_ONMS_inter::deep_copy);
+}
+
 template <typename B, typename R>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::reset()
@@ -134,11 +141,11 @@ template <typename B, typename R>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::load); // ---------------------------- LOAD
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode); // ----------------------- DECODE
 	// actual decoding
 	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
 	{
@@ -163,9 +170,9 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		if (normalize_factor == 1.000f) this->BP_decode<8>(frame_id);
 		else                            this->BP_decode<0>(frame_id);
 	}
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	// take the hard decision
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
 	const auto zero = mipp::Reg<R>((R)0);
@@ -178,22 +185,18 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	std::vector<B*> frames(mipp::nElReg<R>());
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_K + f * this->K;
 	tools::Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)V_reorderered.data(), frames, this->K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::load); // ---------------------- LOAD
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::decode); // ----------------- DECODE
 	// actual decoding
 	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
 	{
@@ -218,9 +221,9 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		if (normalize_factor == 1.000f) this->BP_decode<8>(frame_id);
 		else                            this->BP_decode<0>(frame_id);
 	}
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::store); // ------------------- STORE
 	// take the hard decision
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
 	const auto zero = mipp::Reg<R>((R)0);
@@ -230,11 +233,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	std::vector<B*> frames(mipp::nElReg<R>());
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_N + f * this->N;
 	tools::Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)V_reorderered.data(), frames, this->N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	t_store.stop();
 }
 
 // BP algorithm
@@ -250,6 +249,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
 		this->BP_process<F>(this->var_nodes[cur_wave], this->branches[cur_wave]);
+		this->n_ite_done += this->simd_inter_frame_level; // all the frames of the wave are decoded together
 
 		// stop criterion
 		if (this->enable_syndrome && this->check_syndrome(frame_id))
@@ -45,6 +45,7 @@ public:
 	                                   const int syndrome_depth = 1,
 	                                   const int n_frames = 1);
 	virtual ~Decoder_LDPC_BP_layered_ONMS_inter();
+	virtual Decoder_LDPC_BP_layered_ONMS_inter<B,R>* clone() const;
 
 	void reset();
 
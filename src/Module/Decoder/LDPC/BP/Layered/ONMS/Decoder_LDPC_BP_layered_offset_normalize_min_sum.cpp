@@ -74,6 +74,13 @@ Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>
 {
 }
 
+template <typename B, typename R>
+Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>* Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_LDPC_BP_layered_offset_normalize_min_sum::deep_copy);
+}
+
 // BP algorithm
 template <typename B, typename R>
 void Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>
@@ -25,6 +25,7 @@ public:
 	                                                 const int syndrome_depth = 1,
 	                                                 const int n_frames = 1);
 	virtual ~Decoder_LDPC_BP_layered_offset_normalize_min_sum();
+	virtual Decoder_LDPC_BP_layered_offset_normalize_min_sum<B,R>* clone() const;
 
 protected:
 	void BP_process(std::vector<R> &var_nodes, std::vector<R> &branches);
@@ -35,6 +35,13 @@ Decoder_LDPC_BP_layered_sum_product<B,R>
 {
 }
 
+template <typename B, typename R>
+Decoder_LDPC_BP_layered_sum_product<B,R>* Decoder_LDPC_BP_layered_sum_product<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_LDPC_BP_layered_sum_product::deep_copy);
+}
+
 // BP algorithm
 template <typename B, typename R>
 void Decoder_LDPC_BP_layered_sum_product<B,R>
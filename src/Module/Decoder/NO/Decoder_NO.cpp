@@ -23,6 +23,13 @@ Decoder_NO<B,R>
 {
 }
 
+template <typename B, typename R>
+Decoder_NO<B,R>* Decoder_NO<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_NO::deep_copy);
+}
+
 template <typename B, typename R>
 void Decoder_NO<B,R>
 ::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
@@ -41,22 +48,18 @@ template <typename B, typename R>
 void Decoder_NO<B,R>
 ::_decode_siho(const R *Y_K, B *V_K, const int frame_id)
 {
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	tools::hard_decide(Y_K, V_K, this->K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store, d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
 void Decoder_NO<B,R>
 ::_decode_siho_cw(const R *Y_K, B *V_K, const int frame_id)
 {
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::store); // ------------------- STORE
 	tools::hard_decide(Y_K, V_K, this->K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store, d_store);
+	t_store.stop();
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -36,6 +36,7 @@ public:
 	                               CRC<B>& crc, const bool is_full_adaptive = true, const int n_frames = 1);
 
 	virtual ~Decoder_polar_ASCL_fast_CA_sys(){};
+	virtual Decoder_polar_ASCL_fast_CA_sys<B,R,API_polar>* clone() const;
 
 	virtual void notify_frozenbits_update();
 
@@ -19,6 +19,13 @@ Decoder_polar_ASCL_fast_CA_sys<B,R,API_polar>
 	this->set_name(name);
 }
 
+template <typename B, typename R, class API_polar>
+Decoder_polar_ASCL_fast_CA_sys<B,R,API_polar>* Decoder_polar_ASCL_fast_CA_sys<B,R,API_polar>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_polar_ASCL_fast_CA_sys::deep_copy);
+}
+
 template <typename B, typename R, class API_polar>
 Decoder_polar_ASCL_fast_CA_sys<B,R,API_polar>
 ::Decoder_polar_ASCL_fast_CA_sys(const int& K, const int& N, const int& L_max, const std::vector<bool>& frozen_bits,
@@ -82,36 +89,30 @@ template <typename B, typename R, class API_polar>
 void Decoder_polar_ASCL_fast_CA_sys<B,R,API_polar>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_decod = std::chrono::steady_clock::now();
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode);
 	this->_decode(Y_N, V_K, frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now();
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store);
 	if (this->L > 1)
 		Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>::_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R, class API_polar>
 void Decoder_polar_ASCL_fast_CA_sys<B,R,API_polar>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_decod = std::chrono::steady_clock::now();
+	Task_timer t_decod((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::decode);
 	this->_decode(Y_N, V_N, frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now();
+	Task_timer t_store((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::store);
 	if (this->L > 1)
 		Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>::_store_cw(V_N);
 	else
 		sc_decoder._store_cw(V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	t_store.stop();
 }
 }
 }
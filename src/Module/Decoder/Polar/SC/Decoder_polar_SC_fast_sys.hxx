@@ -223,6 +223,13 @@ Decoder_polar_SC_fast_sys<B,R,API_polar>
 	polar_patterns.release_patterns();
 }
 
+template <typename B, typename R, class API_polar>
+Decoder_polar_SC_fast_sys<B,R,API_polar>* Decoder_polar_SC_fast_sys<B,R,API_polar>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_polar_SC_fast_sys::deep_copy);
+}
+
 template <typename B, typename R, class API_polar>
 void Decoder_polar_SC_fast_sys<B,R,API_polar>
 ::notify_frozenbits_update()
@@ -280,22 +287,20 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 	if (!API_polar::isAligned(V_K))
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
 
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_total((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::total);
+	Task_timer t_load((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::load); // ---------------------------- LOAD
 	this->_load(Y_N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode); // ----------------------- DECODE
 	this->_decode();
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	this->_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
+	t_store.stop();
 
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::total,  d_load + d_decod + d_store);
+	t_total.stop();
 }
 
 template <typename B, typename R, class API_polar>
@@ -308,22 +313,20 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 	if (!API_polar::isAligned(V_N))
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
 
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_total((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::total);
+	Task_timer t_load((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::load); // ---------------------- LOAD
 	this->_load(Y_N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::decode); // ----------------- DECODE
 	this->_decode();
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho_cw], dec::tm::decode_siho_cw::store); // ------------------- STORE
 	this->_store_cw(V_N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
+	t_store.stop();
 
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::total,  d_load + d_decod + d_store);
+	t_total.stop();
 }
 
 template <typename B, typename R, class API_polar>
@@ -38,7 +38,14 @@ protected:
 
 public:
 	Decoder_polar_SC_naive(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames = 1);
+
+	/*!
+	 * \brief Copy constructor, the tree is reallocated for the new decoder (see Module::clone).
+	 */
+	Decoder_polar_SC_naive(const Decoder_polar_SC_naive &d);
+
 	virtual ~Decoder_polar_SC_naive();
+	virtual Decoder_polar_SC_naive<B,R,F,G,H>* clone() const;
 
 	virtual void notify_frozenbits_update();
 
@@ -21,6 +21,7 @@ public:
 	Decoder_polar_SC_naive_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
 	                           const int n_frames = 1);
 	virtual ~Decoder_polar_SC_naive_sys();
+	virtual Decoder_polar_SC_naive_sys<B,R,F,G,H>* clone() const;
 
 protected:
 	void _store(B *V, bool coded = false) const;
@@ -20,6 +20,13 @@ Decoder_polar_SC_naive_sys<B,R,F,G,H>
 {
 }
 
+template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
+Decoder_polar_SC_naive_sys<B,R,F,G,H>* Decoder_polar_SC_naive_sys<B,R,F,G,H>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_polar_SC_naive_sys::deep_copy);
+}
+
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G, tools::proto_h<B,R> H>
 void Decoder_polar_SC_naive_sys<B,R,F,G,H>
 ::_store(B *V, bool coded) const
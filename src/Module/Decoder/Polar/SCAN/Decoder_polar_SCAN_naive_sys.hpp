@@ -22,6 +22,7 @@ public:
 	Decoder_polar_SCAN_naive_sys(const int &K, const int &N, const int &max_iter, const std::vector<bool> &frozen_bits,
 	                             const int n_frames = 1);
 	virtual ~Decoder_polar_SCAN_naive_sys();
+	virtual Decoder_polar_SCAN_naive_sys<B,R,F,V,H,I,S>* clone() const;
 
 protected:
 	void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
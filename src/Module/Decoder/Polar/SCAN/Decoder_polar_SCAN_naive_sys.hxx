@@ -23,6 +23,14 @@ Decoder_polar_SCAN_naive_sys<B,R,F,V,H,I,S>
 {
 }
 
+template <typename B, typename R,
+          tools::proto_f<R> F, tools::proto_v<R> V, tools::proto_h<B,R> H, tools::proto_i<R> I, tools::proto_s<R> S>
+Decoder_polar_SCAN_naive_sys<B,R,F,V,H,I,S>* Decoder_polar_SCAN_naive_sys<B,R,F,V,H,I,S>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_polar_SCAN_naive_sys::deep_copy);
+}
+
 template <typename B, typename R,
           tools::proto_f<R> F, tools::proto_v<R> V, tools::proto_h<B,R> H, tools::proto_i<R> I, tools::proto_s<R> S>
 void Decoder_polar_SCAN_naive_sys<B,R,F,V,H,I,S>
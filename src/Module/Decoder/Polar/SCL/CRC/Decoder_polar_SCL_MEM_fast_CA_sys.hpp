@@ -26,6 +26,9 @@ protected:
 	CRC<B>& crc;
 	mipp::vector<B> U_test;
 
+private:
+	CRC<B>* crc_clone; // the CRC owned by the cloned decoders (nullptr otherwise)
+
 public:
 	Decoder_polar_SCL_MEM_fast_CA_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
 	                                  CRC<B>& crc, const int n_frames = 1);
@@ -34,7 +37,13 @@ public:
 	                                  const std::vector<tools::Pattern_polar_i*>& polar_patterns,
 	                                  const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_frames = 1);
 
-	virtual ~Decoder_polar_SCL_MEM_fast_CA_sys(){};
+	/*!
+	 * \brief Copy constructor, the CRC is cloned to be used by the new decoder only (see Module::clone).
+	 */
+	Decoder_polar_SCL_MEM_fast_CA_sys(const Decoder_polar_SCL_MEM_fast_CA_sys &d);
+
+	virtual ~Decoder_polar_SCL_MEM_fast_CA_sys();
+	virtual Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>* clone() const;
 
 protected:
 	        bool crc_check       (mipp::vector<B> &s);
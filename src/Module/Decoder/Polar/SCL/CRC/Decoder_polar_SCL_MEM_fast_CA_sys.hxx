@@ -15,7 +15,7 @@ Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>
                                     CRC<B>& crc, const int n_frames)
 : Decoder(K, N, n_frames, API_polar::get_n_frames()),
   Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>(K, N, L, frozen_bits, n_frames),
-  fast_store(false), crc(crc), U_test(K)
+  fast_store(false), crc(crc), U_test(K), crc_clone(nullptr)
 {
 	const std::string name = "Decoder_polar_SCL_MEM_fast_CA_sys";
 	this->set_name(name);
@@ -37,7 +37,7 @@ Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>
                                     CRC<B>& crc, const int n_frames)
 : Decoder(K, N, n_frames, API_polar::get_n_frames()),
   Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>(K, N, L, frozen_bits, polar_patterns, idx_r0, idx_r1, n_frames),
-  fast_store(false), crc(crc), U_test(K)
+  fast_store(false), crc(crc), U_test(K), crc_clone(nullptr)
 {
 	const std::string name = "Decoder_polar_SCL_MEM_fast_CA_sys";
 	this->set_name(name);
@@ -51,6 +51,30 @@ Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>
 	}
 }
 
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>
+::Decoder_polar_SCL_MEM_fast_CA_sys(const Decoder_polar_SCL_MEM_fast_CA_sys &d)
+: Decoder(d),
+  Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>(d),
+  fast_store(d.fast_store), crc(*dynamic_cast<CRC<B>*>(d.crc.clone())), U_test(d.U_test), crc_clone(&this->crc)
+{
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>
+::~Decoder_polar_SCL_MEM_fast_CA_sys()
+{
+	if (crc_clone != nullptr)
+		delete crc_clone;
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>* Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_polar_SCL_MEM_fast_CA_sys::deep_copy);
+}
+
 template <typename B, typename R, class API_polar>
 bool Decoder_polar_SCL_MEM_fast_CA_sys<B,R,API_polar>
 ::crc_check(mipp::vector<B> &s)
@@ -16,11 +16,20 @@ class Decoder_polar_SCL_naive_CA : public Decoder_polar_SCL_naive<B,R,F,G>
 protected:
 	CRC<B>& crc;
 
+private:
+	CRC<B>* crc_clone; // the CRC owned by the cloned decoders (nullptr otherwise)
+
 public:
 	Decoder_polar_SCL_naive_CA(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
 	                           CRC<B>& crc, const int n_frames = 1);
 
-	virtual ~Decoder_polar_SCL_naive_CA() {}
+	/*!
+	 * \brief Copy constructor, the CRC is cloned to be used by the new decoder only (see Module::clone).
+	 */
+	Decoder_polar_SCL_naive_CA(const Decoder_polar_SCL_naive_CA &d);
+
+	virtual ~Decoder_polar_SCL_naive_CA();
+	virtual Decoder_polar_SCL_naive_CA<B,R,F,G>* clone() const;
 
 protected:
 	virtual void select_best_path();
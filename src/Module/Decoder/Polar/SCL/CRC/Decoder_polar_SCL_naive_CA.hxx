@@ -12,7 +12,7 @@ Decoder_polar_SCL_naive_CA<B,R,F,G>
 ::Decoder_polar_SCL_naive_CA(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
                              CRC<B>& crc, const int n_frames)
 : Decoder(K, N, n_frames, 1),
-  Decoder_polar_SCL_naive<B,R,F,G>(K, N, L, frozen_bits, n_frames), crc(crc)
+  Decoder_polar_SCL_naive<B,R,F,G>(K, N, L, frozen_bits, n_frames), crc(crc), crc_clone(nullptr)
 {
 	const std::string name = "Decoder_polar_SCL_naive_CA";
 	this->set_name(name);
@@ -26,6 +26,29 @@ Decoder_polar_SCL_naive_CA<B,R,F,G>
 	}
 }
 
+template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
+Decoder_polar_SCL_naive_CA<B,R,F,G>
+::Decoder_polar_SCL_naive_CA(const Decoder_polar_SCL_naive_CA &d)
+: Decoder(d),
+  Decoder_polar_SCL_naive<B,R,F,G>(d), crc(*dynamic_cast<CRC<B>*>(d.crc.clone())), crc_clone(&this->crc)
+{
+}
+
+template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
+Decoder_polar_SCL_naive_CA<B,R,F,G>
+::~Decoder_polar_SCL_naive_CA()
+{
+	if (crc_clone != nullptr)
+		delete crc_clone;
+}
+
+template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
+Decoder_polar_SCL_naive_CA<B,R,F,G>* Decoder_polar_SCL_naive_CA<B,R,F,G>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_polar_SCL_naive_CA::deep_copy);
+}
+
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
 void Decoder_polar_SCL_naive_CA<B,R,F,G>
 ::select_best_path() 
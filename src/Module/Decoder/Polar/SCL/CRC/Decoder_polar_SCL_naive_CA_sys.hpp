@@ -18,6 +18,7 @@ public:
 	                               CRC<B>& crc, const int n_frames = 1);
 
 	virtual ~Decoder_polar_SCL_naive_CA_sys() {}
+	virtual Decoder_polar_SCL_naive_CA_sys<B,R,F,G>* clone() const;
 
 protected:
 	virtual void select_best_path();
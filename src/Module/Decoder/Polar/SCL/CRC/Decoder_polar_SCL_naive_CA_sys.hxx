@@ -15,6 +15,13 @@ Decoder_polar_SCL_naive_CA_sys<B,R,F,G>
 	this->set_name(name);
 }
 
+template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
+Decoder_polar_SCL_naive_CA_sys<B,R,F,G>* Decoder_polar_SCL_naive_CA_sys<B,R,F,G>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_polar_SCL_naive_CA_sys::deep_copy);
+}
+
 template <typename B, typename R, tools::proto_f<R> F, tools::proto_g<B,R> G>
 void Decoder_polar_SCL_naive_CA_sys<B,R,F,G>
 ::select_best_path() 
@@ -67,6 +67,7 @@ public:
 	                               const int n_frames = 1);
 
 	virtual ~Decoder_polar_SCL_MEM_fast_sys();
+	virtual Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>* clone() const;
 
 	virtual void notify_frozenbits_update();
 
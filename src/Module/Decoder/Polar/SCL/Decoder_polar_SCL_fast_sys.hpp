@@ -61,6 +61,7 @@ public:
 	                           const int idx_r0, const int idx_r1, const int n_frames = 1);
 
 	virtual ~Decoder_polar_SCL_fast_sys();
+	virtual Decoder_polar_SCL_fast_sys<B,R,API_polar>* clone() const;
 
 	virtual void notify_frozenbits_update();
 
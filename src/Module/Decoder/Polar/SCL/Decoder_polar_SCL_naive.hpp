@@ -44,7 +44,14 @@ protected:
 public:
 	Decoder_polar_SCL_naive(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
 	                        const int n_frames = 1);
+
+	/*!
+	 * \brief Copy constructor, the trees are reallocated for the new decoder (see Module::clone).
+	 */
+	Decoder_polar_SCL_naive(const Decoder_polar_SCL_naive &d);
+
 	virtual ~Decoder_polar_SCL_naive();
+	virtual Decoder_polar_SCL_naive<B,R,F,G>* clone() const;
 
 	virtual void notify_frozenbits_update();
 
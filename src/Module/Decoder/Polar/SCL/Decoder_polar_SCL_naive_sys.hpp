@@ -21,6 +21,7 @@ public:
 	                            const int n_frames = 1);
 
 	virtual ~Decoder_polar_SCL_naive_sys() {}
+	virtual Decoder_polar_SCL_naive_sys<B,R,F,G>* clone() const;
 
 protected:
 	virtual void _store(B *V, bool coded = false) const;
@@ -95,15 +95,16 @@ template <typename B, typename R>
 void Decoder_RSC_BCJR<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_total((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::total);
+	Task_timer t_load((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::load); // ---------------------------- LOAD
 	_load(Y_N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode); // ----------------------- DECODE
 	this->_decode_siso(sys.data(), par.data(), ext.data(), frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	// take the hard decision
 	for (auto i = 0; i < this->K * this->simd_inter_frame_level; i += mipp::nElReg<R>())
 	{
@@ -116,12 +117,9 @@ void Decoder_RSC_BCJR<B,R>
 	}
 
 	_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
+	t_store.stop();
 
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::total,  d_load + d_decod + d_store);
+	t_total.stop();
 }
 
 template <typename B, typename R>
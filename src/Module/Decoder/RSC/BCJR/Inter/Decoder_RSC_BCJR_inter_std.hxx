@@ -25,6 +25,13 @@ Decoder_RSC_BCJR_inter_std<B,R,MAX>
 {
 }
 
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_std<B,R,MAX>* Decoder_RSC_BCJR_inter_std<B,R,MAX>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_RSC_BCJR_inter_std::deep_copy);
+}
+
 template <typename B, typename R, tools::proto_max_i<R> MAX>
 void Decoder_RSC_BCJR_inter_std<B,R,MAX>
 ::compute_gamma(const R *sys, const R *par)
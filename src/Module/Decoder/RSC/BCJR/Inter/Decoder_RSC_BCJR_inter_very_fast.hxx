@@ -26,6 +26,13 @@ Decoder_RSC_BCJR_inter_very_fast<B,R,MAX>
 {
 }
 
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_very_fast<B,R,MAX>* Decoder_RSC_BCJR_inter_very_fast<B,R,MAX>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_RSC_BCJR_inter_very_fast::deep_copy);
+}
+
 // Slower and I don't know why... It should be faster without the loading of the alpha metrics
 //
 // template <typename B, typename R, tools::proto_max_i<R> MAX>
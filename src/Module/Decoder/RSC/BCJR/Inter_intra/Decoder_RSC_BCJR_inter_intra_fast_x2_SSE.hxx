@@ -88,6 +88,13 @@ Decoder_RSC_BCJR_inter_intra_fast_x2_SSE<B,R,MAX>
 {
 }
 
+template <typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_inter_intra_fast_x2_SSE<B,R,MAX>* Decoder_RSC_BCJR_inter_intra_fast_x2_SSE<B,R,MAX>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_RSC_BCJR_inter_intra_fast_x2_SSE::deep_copy);
+}
+
 template <typename B, typename R, tools::proto_max_i<R> MAX>
 void Decoder_RSC_BCJR_inter_intra_fast_x2_SSE<B,R,MAX>
 ::compute_gamma(const R *sys, const R *par)
@@ -21,6 +21,7 @@ public:
 	                                         const bool buffered_encoding = true,
 	                                         const int n_frames = 1);
 	virtual ~Decoder_RSC_BCJR_inter_intra_fast_x4_AVX();
+	virtual Decoder_RSC_BCJR_inter_intra_fast_x4_AVX<B,R,MAX>* clone() const;
 
 protected:
 	void compute_gamma   (const R *sys, const R *par);
@@ -21,6 +21,7 @@ public:
 	                            const bool buffered_encoding = true,
 	                            const int n_frames = 1);
 	virtual ~Decoder_RSC_BCJR_intra_fast();
+	virtual Decoder_RSC_BCJR_intra_fast<B,R,MAX>* clone() const;
 
 protected:
 	void compute_gamma   (const R *sys, const R *par);
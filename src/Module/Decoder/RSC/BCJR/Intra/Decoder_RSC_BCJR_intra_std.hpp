@@ -21,6 +21,7 @@ public:
 	                           const bool buffered_encoding = true,
 	                           const int n_frames = 1);
 	virtual ~Decoder_RSC_BCJR_intra_std();
+	virtual Decoder_RSC_BCJR_intra_std<B,R,MAX>* clone() const;
 
 protected:
 	void compute_gamma   (const R *sys, const R *par);
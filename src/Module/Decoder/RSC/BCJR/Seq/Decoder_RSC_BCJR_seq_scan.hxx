@@ -27,6 +27,13 @@ Decoder_RSC_BCJR_seq_scan<B,R,RD>
 {
 }
 
+template <typename B, typename R, typename RD>
+Decoder_RSC_BCJR_seq_scan<B,R,RD>* Decoder_RSC_BCJR_seq_scan<B,R,RD>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_RSC_BCJR_seq_scan::deep_copy);
+}
+
 template <typename B, typename R, typename RD>
 void Decoder_RSC_BCJR_seq_scan<B,R,RD>
 ::compute_gamma(const R *sys, const R *par)
@@ -30,6 +30,7 @@ public:
 	                                      std::ostream &stream = std::cout,
 	                                      const int n_frames = 1);
 	virtual ~Decoder_RSC_BCJR_seq_generic_std_json();
+	virtual Decoder_RSC_BCJR_seq_generic_std_json<B,R,RD,MAX1,MAX2>* clone() const;
 
 protected:
 	virtual void _decode_siso(const R *sys, const R *par, R *ext, const int frame_id);
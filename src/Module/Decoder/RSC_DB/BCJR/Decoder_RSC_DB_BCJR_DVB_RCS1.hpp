@@ -20,6 +20,7 @@ public:
 	                             const bool buffered_encoding = true,
 	                             const int n_frames = 1);
 	virtual ~Decoder_RSC_DB_BCJR_DVB_RCS1();
+	virtual Decoder_RSC_DB_BCJR_DVB_RCS1<B,R,MAX>* clone() const;
 
 protected:
 	void __fwd_recursion(const R *sys, const R *par        );
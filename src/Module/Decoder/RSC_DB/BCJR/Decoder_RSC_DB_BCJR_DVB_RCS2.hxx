@@ -38,6 +38,13 @@ Decoder_RSC_DB_BCJR_DVB_RCS2<B,R,MAX>
 {
 }
 
+template <typename B, typename R, tools::proto_max<R> MAX>
+Decoder_RSC_DB_BCJR_DVB_RCS2<B,R,MAX>* Decoder_RSC_DB_BCJR_DVB_RCS2<B,R,MAX>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_RSC_DB_BCJR_DVB_RCS2::deep_copy);
+}
+
 template <typename B, typename R, tools::proto_max<R> MAX>
 void Decoder_RSC_DB_BCJR_DVB_RCS2<B,R,MAX>
 ::__fwd_recursion(const R *sys, const R *par)
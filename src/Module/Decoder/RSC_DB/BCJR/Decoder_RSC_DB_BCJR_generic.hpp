@@ -21,6 +21,7 @@ public:
 	                            const bool buffered_encoding = true,
 	                            const int n_frames = 1);
 	virtual ~Decoder_RSC_DB_BCJR_generic();
+	virtual Decoder_RSC_DB_BCJR_generic<B,R,MAX>* clone() const;
 
 protected:
 	virtual void __fwd_recursion(const R *sys, const R *par        );
@@ -31,6 +31,13 @@ Decoder_RSC_DB_BCJR_generic<B,R,MAX>
 {
 }
 
+template <typename B, typename R, tools::proto_max<R> MAX>
+Decoder_RSC_DB_BCJR_generic<B,R,MAX>* Decoder_RSC_DB_BCJR_generic<B,R,MAX>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_RSC_DB_BCJR_generic::deep_copy);
+}
+
 template <typename B, typename R, tools::proto_max<R> MAX>
 void Decoder_RSC_DB_BCJR_generic<B,R,MAX>
 ::__fwd_recursion(const R *sys, const R *par)
@@ -21,6 +21,13 @@ Decoder_repetition_std<B,R>
 {
 }
 
+template <typename B, typename R>
+Decoder_repetition_std<B,R>* Decoder_repetition_std<B,R>
+::clone() const
+{
+	return Module::clone_impl(*this, &Decoder_repetition_std::deep_copy);
+}
+
 template <typename B, typename R>
 void Decoder_repetition_std<B,R>
 ::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
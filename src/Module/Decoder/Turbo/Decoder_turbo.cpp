@@ -100,6 +100,9 @@ Decoder_turbo<B,R>
 		        << ", 'siso_i.get_simd_inter_frame_level()' = " << siso_i.get_simd_inter_frame_level() << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->register_timer((*this)[dec::tsk::decode_siho], "siso_n");
+	this->register_timer((*this)[dec::tsk::decode_siho], "siso_i");
 }
 
 template <typename B, typename R>
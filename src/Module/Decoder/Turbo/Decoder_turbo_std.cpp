@@ -37,11 +37,12 @@ template <typename B, typename R>
 void Decoder_turbo_std<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_total((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::total);
+	Task_timer t_load((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::load); // ---------------------------- LOAD
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode); // ----------------------- DECODE
 	const auto n_frames = this->get_simd_inter_frame_level();
 	const auto tail_n_2 = this->siso_n.tail_length() / 2;
 	const auto tail_i_2 = this->siso_i.tail_length() / 2;
@@ -59,7 +60,9 @@ void Decoder_turbo_std<B,R>
 			this->l_sen[i] = this->l_sn[i];
 	
 		// SISO in the natural domain
+		Task_timer t_siso_n((*this)[dec::tsk::decode_siho], dec::tm::decode_siho_turbo::siso_n);
 		this->siso_n.decode_siso(this->l_sen.data(), this->l_pn.data(), this->l_e2n.data(), n_frames);
+		t_siso_n.stop();
 
 		for (auto cb : this->callbacks_siso_n)
 		{
@@ -80,7 +83,9 @@ void Decoder_turbo_std<B,R>
 				this->l_sei[i] = this->l_si[i];
 
 			// SISO in the interleave domain
+			Task_timer t_siso_i((*this)[dec::tsk::decode_siho], dec::tm::decode_siho_turbo::siso_i);
 			this->siso_i.decode_siso(this->l_sei.data(), this->l_pi.data(), this->l_e2i.data(), n_frames);
+			t_siso_i.stop();
 
 			for (auto cb : this->callbacks_siso_i)
 			{
@@ -104,19 +109,17 @@ void Decoder_turbo_std<B,R>
 		ite++; // increment the number of iteration
 	}
 	while ((ite <= this->n_ite) && !stop);
+	this->n_ite_done += (ite -1) * n_frames;
 
 	for (auto cb : this->callbacks_end)
 		cb(ite -1);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	this->_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
+	t_store.stop();
 
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::total,  d_load + d_decod + d_store);
+	t_total.stop();
 }
 
 // ==================================================================================== explicit template instantiation
@@ -102,6 +102,9 @@ Decoder_turbo_DB<B,R>
 		        << ", 'siso_i.get_simd_inter_frame_level()' = " << siso_i.get_simd_inter_frame_level() << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->register_timer((*this)[dec::tsk::decode_siho], "siso_n");
+	this->register_timer((*this)[dec::tsk::decode_siho], "siso_i");
 }
 
 template <typename B, typename R>
@@ -182,11 +185,11 @@ template <typename B, typename R>
 void Decoder_turbo_DB<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	Task_timer t_load((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::load); // ---------------------------- LOAD
 	this->_load(Y_N);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	t_load.stop();
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	Task_timer t_decod((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::decode); // ----------------------- DECODE
 	const auto n_frames = this->get_simd_inter_frame_level();
 
 	// iterative turbo decoding process
@@ -199,7 +202,9 @@ void Decoder_turbo_DB<B,R>
 			this->l_sen[i] = this->l_sn[i] + this->l_e1n[i];
 
 		// SISO in the natural domain
+		Task_timer t_siso_n((*this)[dec::tsk::decode_siho], dec::tm::decode_siho_turbo::siso_n);
 		this->siso_n.decode_siso(this->l_sen.data(), this->l_pn.data(), this->l_e2n.data(), n_frames);
+		t_siso_n.stop();
 
 		for (auto cb : this->callbacks_siso_n)
 		{
@@ -225,7 +230,9 @@ void Decoder_turbo_DB<B,R>
 				this->l_sei[i] = this->l_si[i] + this->l_e1i[i];
 
 			// SISO in the interleaved domain
+			Task_timer t_siso_i((*this)[dec::tsk::decode_siho], dec::tm::decode_siho_turbo::siso_i);
 			this->siso_i.decode_siso(this->l_sei.data(), this->l_pi.data(), this->l_e2i.data(), n_frames);
+			t_siso_i.stop();
 
 			for (auto cb : this->callbacks_siso_i)
 			{
@@ -263,18 +270,15 @@ void Decoder_turbo_DB<B,R>
 		ite++; // increment the number of iteration
 	}
 	while ((ite <= this->n_ite) && !stop);
+	this->n_ite_done += (ite -1) * n_frames;
 
 	for (auto cb : this->callbacks_end)
 		cb(ite -1);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	t_decod.stop();
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	Task_timer t_store((*this)[dec::tsk::decode_siho], dec::tm::decode_siho::store); // ------------------------- STORE
 	this->_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	t_store.stop();
 }
 
 template <typename B, typename R>
@@ -17,6 +17,13 @@ Encoder_AZCW<B>
 {
 }
 
+template <typename B>
+Encoder_AZCW<B>* Encoder_AZCW<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_AZCW::deep_copy);
+}
+
 template <typename B>
 void Encoder_AZCW<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
@@ -15,6 +15,7 @@ class Encoder_AZCW : public Encoder<B>
 public:
 	Encoder_AZCW(const int K, const int N, const int n_frames = 1);
 	virtual ~Encoder_AZCW();
+	virtual Encoder_AZCW<B>* clone() const;
 
 	const std::vector<uint32_t>& get_info_bits_pos();
 
@@ -32,6 +32,13 @@ Encoder_BCH<B>
 {
 }
 
+template <typename B>
+Encoder_BCH<B>* Encoder_BCH<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_BCH::deep_copy);
+}
+
 template <typename B>
 void Encoder_BCH<B>
 ::__encode(const B *U_K, B *bb)
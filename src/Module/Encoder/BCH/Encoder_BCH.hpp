@@ -22,6 +22,7 @@ public:
 	Encoder_BCH(const int& K, const int& N, const tools::BCH_polynomial_generator& GF, const int n_frames = 1);
 
 	virtual ~Encoder_BCH();
+	virtual Encoder_BCH<B>* clone() const;
 
 	bool is_codeword(const B *X_N);
 
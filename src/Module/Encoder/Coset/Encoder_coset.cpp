@@ -17,6 +17,20 @@ Encoder_coset<B>
 {
 }
 
+template <typename B>
+Encoder_coset<B>* Encoder_coset<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_coset::deep_copy);
+}
+
+template <typename B>
+void Encoder_coset<B>
+::set_seed(const int seed)
+{
+	rd_engine.seed(seed + 1024);
+}
+
 template <typename B>
 void Encoder_coset<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
@@ -41,6 +55,20 @@ bool Encoder_coset<B>
 	throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
 }
 
+template <typename B>
+void Encoder_coset<B>
+::save_state(std::ostream &os) const
+{
+	os << rd_engine << " " << uniform_dist << " ";
+}
+
+template <typename B>
+void Encoder_coset<B>
+::load_state(std::istream &is)
+{
+	is >> rd_engine >> uniform_dist;
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
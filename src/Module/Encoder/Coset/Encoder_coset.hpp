@@ -23,6 +23,11 @@ private:
 public:
 	Encoder_coset(const int K, const int N, const int seed = 0, const int n_frames = 1);
 	virtual ~Encoder_coset();
+	virtual Encoder_coset<B>* clone() const;
+
+	void set_seed(const int seed);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
 
 	const std::vector<uint32_t>& get_info_bits_pos();
 
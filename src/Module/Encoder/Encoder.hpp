@@ -116,6 +116,19 @@ public:
 		std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Encoder (see Module::clone).
+	 */
+	Encoder(const Encoder &e)
+	: Encoder(e.K, e.N, e.n_frames)
+	{
+		this->sys           = e.sys;
+		this->memorizing    = e.memorizing;
+		this->info_bits_pos = e.info_bits_pos;
+		this->U_K_mem       = e.U_K_mem;
+		this->X_N_mem       = e.X_N_mem;
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
@@ -138,6 +151,15 @@ public:
 		return this->sys;
 	}
 
+	/*!
+	 * \brief Re-initializes the random generator of the Encoder (does nothing for the deterministic Encoders).
+	 *
+	 * \param seed: the new seed.
+	 */
+	virtual void set_seed(const int seed)
+	{
+	}
+
 	bool is_memorizing() const
 	{
 		return this->memorizing;
@@ -23,6 +23,13 @@ Encoder_LDPC_DVBS2<B>
 {
 }
 
+template <typename B>
+Encoder_LDPC_DVBS2<B>* Encoder_LDPC_DVBS2<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_LDPC_DVBS2::deep_copy);
+}
+
 template <typename B>
 void Encoder_LDPC_DVBS2<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
@@ -23,7 +23,7 @@ Encoder_LDPC<B>
 template <typename B>
 Encoder_LDPC<B>
 ::Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames)
-: Encoder<B>(K, N, n_frames), tG(N * K, 0)
+: Encoder<B>(K, N, n_frames)
 {
 	const std::string name = "Encoder_LDPC";
 	this->set_name(name);
@@ -51,7 +51,9 @@ Encoder_LDPC<B>
 		for (size_t j = 0; j < CN_to_VN[i].size(); ++j)
 			full_G[i * N + CN_to_VN[i][j]] = 1;
 
-	tools::real_transpose(K, N, full_G, tG); // transposed for computation matter
+	auto tG = std::make_shared<std::vector<B>>(N * K, 0);
+	tools::real_transpose(K, N, full_G, *tG); // transposed for computation matter
+	this->tG = tG;
 }
 
 template <typename B>
@@ -60,12 +62,19 @@ Encoder_LDPC<B>
 {
 }
 
+template <typename B>
+Encoder_LDPC<B>* Encoder_LDPC<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_LDPC::deep_copy);
+}
+
 template <typename B>
 void Encoder_LDPC<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
 	// Real General Matrix Multiplication
-	tools::rgemm(1, this->N, this->K, U_K, tG.data(), X_N);
+	tools::rgemm(1, this->N, this->K, U_K, tG->data(), X_N);
 
 	for (auto j = 0; j < this->N; ++j)
 		X_N[j] %= 2;
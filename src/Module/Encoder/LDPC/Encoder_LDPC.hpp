@@ -1,6 +1,7 @@
 #ifndef ENCODER_LDPC_HPP_
 #define ENCODER_LDPC_HPP_
 
+#include <memory>
 #include <vector>
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
@@ -16,7 +17,7 @@ template <typename B = int>
 class Encoder_LDPC : public Encoder<B>
 {
 protected:
-	std::vector<B> tG; // the generator matrix
+	std::shared_ptr<const std::vector<B>> tG; // the generator matrix (read-only, shared by the clones)
 
 protected:
 	Encoder_LDPC(const int K, const int N, const int n_frames = 1);
@@ -24,6 +25,7 @@ protected:
 public:
 	Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames = 1);
 	virtual ~Encoder_LDPC();
+	virtual Encoder_LDPC<B>* clone() const;
 
 	virtual const std::vector<uint32_t>& get_info_bits_pos();
 	virtual bool is_sys() const;
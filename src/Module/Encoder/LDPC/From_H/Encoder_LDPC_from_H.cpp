@@ -16,25 +16,27 @@ using namespace aff3ct::module;
 template <typename B>
 Encoder_LDPC_from_H<B>
 ::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames)
-: Encoder_LDPC<B>(K, N, n_frames), G(tools::LDPC_matrix_handler::transform_H_to_G(H, this->info_bits_pos)), H(H)
+: Encoder_LDPC<B>(K, N, n_frames),
+  G(std::make_shared<tools::Sparse_matrix>(tools::LDPC_matrix_handler::transform_H_to_G(H, this->info_bits_pos))),
+  H(std::make_shared<tools::Sparse_matrix>(H))
 {
 	const std::string name = "Encoder_LDPC_from_H";
 	this->set_name(name);
 	
 	// warning G is transposed !
-	if (K != (int)G.get_n_cols())
+	if (K != (int)G->get_n_cols())
 	{
 		std::stringstream message;
 		message << "The built G matrix has a dimension 'K' different than the given one ('K' = " << K
-		        << ", 'G.get_n_cols()' = " << G.get_n_cols() << ").";
+		        << ", 'G.get_n_cols()' = " << G->get_n_cols() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (N != (int)G.get_n_rows())
+	if (N != (int)G->get_n_rows())
 	{
 		std::stringstream message;
 		message << "The built G matrix has a dimension 'N' different than the given one ('N' = " << N
-		        << ", 'G.get_n_rows()' = " << G.get_n_rows() << ").";
+		        << ", 'G.get_n_rows()' = " << G->get_n_rows() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 }
@@ -45,10 +47,19 @@ Encoder_LDPC_from_H<B>
 {
 }
 
+template <typename B>
+Encoder_LDPC_from_H<B>* Encoder_LDPC_from_H<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_LDPC_from_H::deep_copy);
+}
+
 template <typename B>
 void Encoder_LDPC_from_H<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
+	const auto &G = *this->G;
+
 	for (unsigned i = 0; i < G.get_n_rows(); i++)
 	{
 		X_N[i] = 0;
@@ -62,18 +73,19 @@ template <typename B>
 bool Encoder_LDPC_from_H<B>
 ::is_codeword(const B *X_N)
 {
+	const auto &H = *this->H;
 	auto syndrome = false;
 
-	const auto n_CN = (int)this->H.get_n_cols();
+	const auto n_CN = (int)H.get_n_cols();
 	auto i = 0;
 	while (i < n_CN && !syndrome)
 	{
 		auto sign = 0;
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto n_VN = (int)H[i].size();
 		for (auto j = 0; j < n_VN; j++)
 		{
-			const auto bit = X_N[this->H[i][j]];
+			const auto bit = X_N[H[i][j]];
 			const auto tmp_sign = bit ? -1 : 0;
 
 			sign ^= tmp_sign;
@@ -1,6 +1,7 @@
 #ifndef ENCODER_LDPC_FROM_H_HPP_
 #define ENCODER_LDPC_FROM_H_HPP_
 
+#include <memory>
 #include <vector>
 
 #include "../Encoder_LDPC.hpp"
@@ -17,12 +18,14 @@ template <typename B = int>
 class Encoder_LDPC_from_H : public Encoder_LDPC<B>
 {
 protected:
-	tools::Sparse_matrix G; // position of ones by column
-	tools::Sparse_matrix H;
+	// read-only tables, shared by the clones of the encoder
+	std::shared_ptr<const tools::Sparse_matrix> G; // position of ones by column
+	std::shared_ptr<const tools::Sparse_matrix> H;
 
 public:
 	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
 	virtual ~Encoder_LDPC_from_H();
+	virtual Encoder_LDPC_from_H<B>* clone() const;
 
 	bool is_codeword(const B *X_N);
 
@@ -17,25 +17,25 @@ template <typename B>
 Encoder_LDPC_from_QC<B>
 ::Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames)
 : Encoder_LDPC<B>(K, N, n_frames),
-  H((_H.get_n_rows() > _H.get_n_cols())?_H.transpose():_H),
-  invH2(tools::LDPC_matrix_handler::invert_H2(_H))
+  H(std::make_shared<tools::Sparse_matrix>((_H.get_n_rows() > _H.get_n_cols())?_H.transpose():_H)),
+  invH2(std::make_shared<tools::LDPC_matrix_handler::QCFull_matrix>(tools::LDPC_matrix_handler::invert_H2(_H)))
 {
 	const std::string name = "Encoder_LDPC_from_QC";
 	this->set_name(name);
 	
-	if ((N-K) != (int)H.get_n_rows())
+	if ((N-K) != (int)H->get_n_rows())
 	{
 		std::stringstream message;
 		message << "The built H matrix has a dimension '(N-K)' different than the given one ('(N-K)' = " << (N-K)
-		        << ", 'H.get_n_rows()' = " << H.get_n_rows() << ").";
+		        << ", 'H.get_n_rows()' = " << H->get_n_rows() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (N != (int)H.get_n_cols())
+	if (N != (int)H->get_n_cols())
 	{
 		std::stringstream message;
 		message << "The built H matrix has a dimension 'N' different than the given one ('N' = " << N
-		        << ", 'H.get_n_cols()' = " << H.get_n_cols() << ").";
+		        << ", 'H.get_n_cols()' = " << H->get_n_cols() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 }
@@ -46,10 +46,19 @@ Encoder_LDPC_from_QC<B>
 {
 }
 
+template <typename B>
+Encoder_LDPC_from_QC<B>* Encoder_LDPC_from_QC<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_LDPC_from_QC::deep_copy);
+}
+
 template <typename B>
 void Encoder_LDPC_from_QC<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
+	const auto &H     = *this->H;
+	const auto &invH2 = *this->invH2;
 	unsigned M = this->N - this->K;
 
 	//Systematic part
@@ -79,18 +88,19 @@ template <typename B>
 bool Encoder_LDPC_from_QC<B>
 ::is_codeword(const B *X_N)
 {
+	const auto &H = *this->H;
 	auto syndrome = false;
 
-	const auto n_CN = (int)this->H.get_n_cols();
+	const auto n_CN = (int)H.get_n_cols();
 	auto i = 0;
 	while (i < n_CN && !syndrome)
 	{
 		auto sign = 0;
 
-		const auto n_VN = (int)this->H[i].size();
+		const auto n_VN = (int)H[i].size();
 		for (auto j = 0; j < n_VN; j++)
 		{
-			const auto bit = X_N[this->H[i][j]];
+			const auto bit = X_N[H[i][j]];
 			const auto tmp_sign = bit ? -1 : 0;
 
 			sign ^= tmp_sign;
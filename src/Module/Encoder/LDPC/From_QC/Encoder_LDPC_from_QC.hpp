@@ -1,6 +1,7 @@
 #ifndef ENCODER_LDPC_FROM_QC_HPP_
 #define ENCODER_LDPC_FROM_QC_HPP_
 
+#include <memory>
 #include <vector>
 
 #include "../Encoder_LDPC.hpp"
@@ -17,12 +18,14 @@ template <typename B = int>
 class Encoder_LDPC_from_QC : public Encoder_LDPC<B>
 {
 protected:
-	tools::Sparse_matrix H;
-	tools::LDPC_matrix_handler::QCFull_matrix invH2;
+	// read-only tables, shared by the clones of the encoder
+	std::shared_ptr<const tools::Sparse_matrix                     > H;
+	std::shared_ptr<const tools::LDPC_matrix_handler::QCFull_matrix> invH2;
 
 public:
 	Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
 	virtual ~Encoder_LDPC_from_QC();
+	virtual Encoder_LDPC_from_QC<B>* clone() const;
 
 	bool is_codeword(const B *X_N);
 
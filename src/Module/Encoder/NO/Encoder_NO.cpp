@@ -19,6 +19,13 @@ Encoder_NO<B>
 {
 }
 
+template <typename B>
+Encoder_NO<B>* Encoder_NO<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_NO::deep_copy);
+}
+
 template <typename B>
 void Encoder_NO<B>
 ::_encode(const B *U_K, B *X_K, const int frame_id)
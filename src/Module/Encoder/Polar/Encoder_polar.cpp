@@ -37,6 +37,13 @@ Encoder_polar<B>
 	this->notify_frozenbits_update();
 }
 
+template <typename B>
+Encoder_polar<B>* Encoder_polar<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_polar::deep_copy);
+}
+
 template <typename B>
 void Encoder_polar<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
@@ -22,6 +22,7 @@ protected:
 public:
 	Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int n_frames = 1);
 	virtual ~Encoder_polar() {}
+	virtual Encoder_polar<B>* clone() const;
 
 	void light_encode(B *bits);
 
@@ -16,6 +16,13 @@ Encoder_polar_sys<B>
 	this->set_sys(true);
 }
 
+template <typename B>
+Encoder_polar_sys<B>* Encoder_polar_sys<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_polar_sys::deep_copy);
+}
+
 template <typename B>
 void Encoder_polar_sys<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
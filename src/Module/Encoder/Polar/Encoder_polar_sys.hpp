@@ -15,6 +15,7 @@ class Encoder_polar_sys : public Encoder_polar<B>
 public:
 	Encoder_polar_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits, const int& n_frames = 1);
 	virtual ~Encoder_polar_sys() {}
+	virtual Encoder_polar_sys<B>* clone() const;
 
 protected:
 	void _encode(const B *U_K, B *X_N, const int frame_id);
@@ -14,6 +14,13 @@ Encoder_RSC3_CPE_sys<B>
 	this->set_name(name);
 }
 
+template <typename B>
+Encoder_RSC3_CPE_sys<B>* Encoder_RSC3_CPE_sys<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_RSC3_CPE_sys::deep_copy);
+}
+
 template <typename B>
 int Encoder_RSC3_CPE_sys<B>
 ::inner_encode(const int bit_sys, int &state)
@@ -55,6 +55,13 @@ Encoder_RSC_generic_sys<B>
 	}
 }
 
+template <typename B>
+Encoder_RSC_generic_sys<B>* Encoder_RSC_generic_sys<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_RSC_generic_sys::deep_copy);
+}
+
 template <typename B>
 int Encoder_RSC_generic_sys<B>
 ::inner_encode(const int bit_sys, int &state)
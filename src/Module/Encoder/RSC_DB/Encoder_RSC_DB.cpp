@@ -156,6 +156,13 @@ Encoder_RSC_DB<B>
 		}
 }
 
+template <typename B>
+Encoder_RSC_DB<B>* Encoder_RSC_DB<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_RSC_DB::deep_copy);
+}
+
 template <typename B>
 int Encoder_RSC_DB<B>
 ::calc_state_trans(const int in_state, const int in, int& par)
@@ -37,6 +37,7 @@ public:
 	               const bool buffered_encoding = true,
 	               const int n_frames = 1);
 	virtual ~Encoder_RSC_DB() {}
+	virtual Encoder_RSC_DB<B>* clone() const;
 
 	int tail_length() const {return 0;}
 	std::vector<std::vector<int>> get_trellis();
@@ -29,6 +29,13 @@ Encoder_repetition_sys<B>
 			this->info_bits_pos[k] = (rep_count +1) * k;
 }
 
+template <typename B>
+Encoder_repetition_sys<B>* Encoder_repetition_sys<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_repetition_sys::deep_copy);
+}
+
 template <typename B>
 void Encoder_repetition_sys<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
@@ -18,6 +18,7 @@ protected:
 public:
 	Encoder_repetition_sys(const int& K, const int& N, const bool buffered_encoding = true, const int n_frames = 1);
 	virtual ~Encoder_repetition_sys() {}
+	virtual Encoder_repetition_sys<B>* clone() const;
 
 	bool is_codeword(const B *X_N);
 
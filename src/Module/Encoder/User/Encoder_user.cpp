@@ -1,7 +1,9 @@
-#include <fstream>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
+#include "Tools/Display/Dumper/Dumper.hpp"
 
 #include "Encoder_user.hpp"
 
@@ -11,7 +13,7 @@ using namespace aff3ct::module;
 template <typename B>
 Encoder_user<B>
 ::Encoder_user(const int K, const int N, const std::string &filename, const int n_frames)
-: Encoder<B>(K, N, n_frames), codewords(), cw_counter(0)
+: Encoder<B>(K, N, n_frames), file(nullptr), frames(nullptr), codewords(nullptr), n_cw(0), partition()
 {
 	const std::string name = "Encoder_user";
 	this->set_name(name);
@@ -19,65 +21,86 @@ Encoder_user<B>
 	if (filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
-	std::ifstream file(filename.c_str(), std::ios::in);
+	this->file = tools::File_mapping::open(filename);
 
-	if (file.is_open())
+	int src_size = 0, cw_size = 0;
+
+	// the bit-packed files are written by the Dumper in binary
+	const auto &magic = tools::Dumper::bits_magic;
+	const auto header_size = magic.size() + sizeof(n_cw) + sizeof(cw_size) + sizeof(src_size);
+	const auto packed = this->file->size() >= header_size &&
+	                    std::equal(magic.begin(), magic.end(), this->file->data());
+
+	std::stringstream text;
+	if (packed)
+	{
+		const auto header = this->file->data() + magic.size();
+		std::copy(header,                    header + 1 * sizeof(int), (char*)&this->n_cw);
+		std::copy(header + 1 * sizeof(int), header + 2 * sizeof(int), (char*)&cw_size   );
+		std::copy(header + 2 * sizeof(int), header + 3 * sizeof(int), (char*)&src_size  );
+	}
+	else
 	{
-		int n_cw = 0, src_size = 0, cw_size = 0;
+		text.str(std::string(this->file->data(), this->file->size()));
 
-		file >> n_cw;
-		file >> cw_size;
-		file >> src_size;
+		text >> this->n_cw;
+		text >> cw_size;
+		text >> src_size;
 
-		if (n_cw <= 0 || src_size <= 0 || cw_size <= 0)
-		{
-			std::stringstream message;
-			message << "'n_cw', 'src_size' and 'cw_size' have to be greater than 0 ('n_cw' = " << n_cw
-			        << ", 'src_size' = " << src_size << ", 'cw_size' = " << cw_size << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+		// the text is parsed once and for all
+		this->file = nullptr;
+	}
 
-		if (cw_size < src_size)
-		{
-			std::stringstream message;
-			message << "'cw_size' has to be equal or greater than 'src_size' ('cw_size' = " << cw_size
-			        << ", 'src_size' = " << src_size << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	if (this->n_cw <= 0 || src_size <= 0 || cw_size <= 0)
+	{
+		std::stringstream message;
+		message << "'n_cw', 'src_size' and 'cw_size' have to be greater than 0 ('n_cw' = " << this->n_cw
+		        << ", 'src_size' = " << src_size << ", 'cw_size' = " << cw_size << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-		this->codewords.resize(n_cw);
-		for (auto i = 0; i < n_cw; i++)
-			this->codewords[i].resize(cw_size);
+	if (cw_size < src_size)
+	{
+		std::stringstream message;
+		message << "'cw_size' has to be equal or greater than 'src_size' ('cw_size' = " << cw_size
+		        << ", 'src_size' = " << src_size << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
-		if ((src_size == this->K) && (cw_size == this->N))
-		{
-			for (auto i = 0; i < n_cw; i++)
-				for (auto j = 0; j < cw_size; j++)
-				{
-					int symbol;
-					file >> symbol;
-					this->codewords[i][j] = (B)symbol;
-				}
-		}
-		else
-		{
-			file.close();
+	if ((src_size != this->K) || (cw_size != this->N))
+	{
+		std::stringstream message;
+		message << "The number of information bits or the codeword size is wrong "
+		        << "(read: {" << src_size << "," << cw_size << "}, "
+		        << "expected: {" << this->K << "," << this->N << "}).";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
+	if (packed)
+	{
+		const auto frame_bytes = (size_t)(cw_size + 7) / 8;
+		if (this->file->size() < header_size + this->n_cw * frame_bytes)
+		{
 			std::stringstream message;
-			message << "The number of information bits or the codeword size is wrong "
-			        << "(read: {" << src_size << "," << cw_size << "}, "
-			        << "expected: {" << this->K << "," << this->N << "}).";
+			message << "The file is truncated ('n_cw' = " << this->n_cw << ", 'cw_size' = " << cw_size << ").";
 			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 		}
 
-		file.close();
+		this->frames = this->file->data() + header_size;
 	}
 	else
 	{
-		std::stringstream message;
-		message << "Can't open '" + filename + "' file.";
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		auto codewords = std::make_shared<std::vector<B>>((size_t)this->n_cw * cw_size);
+		for (auto &s : *codewords)
+		{
+			int symbol;
+			text >> symbol;
+			s = (B)symbol;
+		}
+		this->codewords = codewords;
 	}
+
+	this->partition.set_n_fra(this->n_cw);
 }
 
 template <typename B>
@@ -86,15 +109,35 @@ Encoder_user<B>
 {
 }
 
+template <typename B>
+Encoder_user<B>* Encoder_user<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Encoder_user::deep_copy);
+}
+
 template <typename B>
 void Encoder_user<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
-	std::copy(this->codewords[this->cw_counter].begin(),
-	          this->codewords[this->cw_counter].end  (),
-	          X_N);
+	const auto cw_id = this->partition.next();
 
-	this->cw_counter = (this->cw_counter +1) % (int)this->codewords.size();
+	if (this->frames != nullptr)
+	{
+		const auto frame = this->frames + (size_t)cw_id * ((this->N + 7) / 8);
+		tools::Bit_packer<B>::unpack((const B*)frame, X_N, this->N);
+	}
+	else
+		std::copy(this->codewords->begin() + (size_t)(cw_id    ) * this->N,
+		          this->codewords->begin() + (size_t)(cw_id + 1) * this->N,
+		          X_N);
+}
+
+template <typename B>
+void Encoder_user<B>
+::set_partition(const int part_id, const int n_parts)
+{
+	this->partition.set_partition(part_id, n_parts);
 }
 
 template <typename B>
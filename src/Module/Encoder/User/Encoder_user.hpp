@@ -1,7 +1,12 @@
 #ifndef ENCODER_USER_HPP_
 #define ENCODER_USER_HPP_
 
+#include <memory>
 #include <string>
+#include <vector>
+
+#include "Tools/Algo/Frame_partition.hpp"
+#include "Tools/Perf/File_mapping/File_mapping.hpp"
 
 #include "../Encoder.hpp"
 
@@ -13,12 +18,23 @@ template <typename B = int>
 class Encoder_user : public Encoder<B>
 {
 private:
-	std::vector<std::vector<B>> codewords;
-	int cw_counter;
+	std::shared_ptr<const tools::File_mapping> file; // the bit-packed frames are unpacked from the mapped file
+	const char *frames;                              // the first bit-packed frame in the file
+	std::shared_ptr<const std::vector<B>> codewords; // the frames of a text file (parsed once, shared by the clones)
+	int n_cw;
+	tools::Frame_partition partition;                // the frames played by this instance
 
 public:
 	Encoder_user(const int K, const int N, const std::string &filename, const int n_frames = 1);
 	virtual ~Encoder_user();
+	virtual Encoder_user<B>* clone() const;
+
+	/*!
+	 * \brief Replays only the frames "part_id", "part_id + n_parts", "part_id + 2 * n_parts", ... of the file (to
+	 *        share the frames between several instances), a part without frame can't be played (see
+	 *        tools::Frame_partition).
+	 */
+	void set_partition(const int part_id, const int n_parts);
 
 	const std::vector<uint32_t>& get_info_bits_pos();
 
@@ -0,0 +1,399 @@
+#include <cmath>
+#include <sstream>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+
+#include "Fused_BPSK_AWGN.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename Q>
+static int compute_val_max(const short saturation_pos)
+{
+	return std::is_floating_point<Q>::value ? 0 : ((1 << (saturation_pos -2))) + ((1 << (saturation_pos -2)) -1);
+}
+
+template <typename B, typename R, typename Q>
+Fused_BPSK_AWGN<B,R,Q>
+::Fused_BPSK_AWGN(const int N, const short fixed_point_pos, const short saturation_pos, const bool disable_sig2,
+                  const int seed, const int n_frames)
+: Module(n_frames),
+  N(N),
+  disable_sig2(disable_sig2),
+  val_max(compute_val_max<Q>(saturation_pos)),
+  val_min(-val_max),
+  factor(std::is_floating_point<Q>::value ? 1 : 1 << fixed_point_pos),
+  sigma((R)1),
+  llr_factor((R)1),
+  mt19937(seed),
+  mt19937_simd()
+{
+	const std::string name = "Fused_BPSK_AWGN";
+	this->set_name(name);
+	this->set_short_name(name);
+
+	if (N <= 0)
+	{
+		std::stringstream message;
+		message << "'N' has to be greater than 0 ('N' = " << N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (!std::is_floating_point<Q>::value)
+	{
+		if (fixed_point_pos < 0)
+		{
+			std::stringstream message;
+			message << "'fixed_point_pos' has to be positive ('fixed_point_pos' = " << fixed_point_pos << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (saturation_pos < 2 || saturation_pos > (short)(sizeof(Q) * 8))
+		{
+			std::stringstream message;
+			message << "'saturation_pos' has to be greater than 1 and equal or smaller than 'sizeof(Q)' * 8 "
+			        << "('saturation_pos' = " << saturation_pos << ", 'sizeof(Q)' = " << sizeof(Q) << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (fixed_point_pos > saturation_pos)
+		{
+			std::stringstream message;
+			message << "'saturation_pos' has to be equal or greater than 'fixed_point_pos' ('saturation_pos' = "
+			        << saturation_pos << ", 'fixed_point_pos' = " << fixed_point_pos << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	this->set_seed(seed);
+	this->create_tasks();
+}
+
+template <typename B, typename R, typename Q>
+Fused_BPSK_AWGN<B,R,Q>
+::Fused_BPSK_AWGN(const Fused_BPSK_AWGN &m)
+: Module(m.n_frames),
+  N(m.N),
+  disable_sig2(m.disable_sig2),
+  val_max(m.val_max),
+  val_min(m.val_min),
+  factor(m.factor),
+  sigma(m.sigma),
+  llr_factor(m.llr_factor),
+  mt19937(m.mt19937),
+  mt19937_simd(m.mt19937_simd)
+{
+	this->set_name(m.get_name());
+	this->set_short_name(m.get_short_name());
+	this->create_tasks();
+}
+
+template <typename B, typename R, typename Q>
+Fused_BPSK_AWGN<B,R,Q>
+::~Fused_BPSK_AWGN()
+{
+}
+
+template <typename B, typename R, typename Q>
+Fused_BPSK_AWGN<B,R,Q>* Fused_BPSK_AWGN<B,R,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Fused_BPSK_AWGN::deep_copy);
+}
+
+template <typename B, typename R, typename Q>
+void Fused_BPSK_AWGN<B,R,Q>
+::create_tasks()
+{
+	auto &p = this->create_task("transmit");
+	auto &ps_X_N = this->template create_socket_in <B>(p, "X_N", this->N * this->n_frames);
+	auto &ps_Y_N = this->template create_socket_out<Q>(p, "Y_N", this->N * this->n_frames);
+	this->create_codelet(p, [this, &ps_X_N, &ps_Y_N]() -> int
+	{
+		this->transmit(static_cast<B*>(ps_X_N.get_dataptr()),
+		               static_cast<Q*>(ps_Y_N.get_dataptr()));
+
+		return 0;
+	});
+}
+
+template <typename B, typename R, typename Q>
+int Fused_BPSK_AWGN<B,R,Q>
+::get_N() const
+{
+	return this->N;
+}
+
+template <typename B, typename R, typename Q>
+void Fused_BPSK_AWGN<B,R,Q>
+::set_seed(const int seed)
+{
+	mt19937.seed(seed);
+
+	mipp::vector<int> seeds(mipp::nElReg<int>());
+	for (auto i = 0; i < mipp::nElReg<int>(); i++)
+		seeds[i] = mt19937.rand();
+	mt19937_simd.seed(mipp::Reg<int>(seeds.data()));
+}
+
+template <typename B, typename R, typename Q>
+void Fused_BPSK_AWGN<B,R,Q>
+::set_sigma(const R sigma)
+{
+	if (sigma <= (R)0)
+	{
+		std::stringstream message;
+		message << "'sigma' has to be greater than 0 ('sigma' = " << sigma << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->sigma      = sigma;
+	this->llr_factor = disable_sig2 ? (R)1 : (R)2 / (sigma * sigma);
+}
+
+template <typename B, typename R, typename Q>
+void Fused_BPSK_AWGN<B,R,Q>
+::save_state(std::ostream &os) const
+{
+	mt19937     .save_state(os);
+	mt19937_simd.save_state(os);
+}
+
+template <typename B, typename R, typename Q>
+void Fused_BPSK_AWGN<B,R,Q>
+::load_state(std::istream &is)
+{
+	mt19937     .load_state(is);
+	mt19937_simd.load_state(is);
+}
+
+template <typename B, typename R, typename Q>
+void Fused_BPSK_AWGN<B,R,Q>
+::transmit(const B *X_N, Q *Y_N, const int frame_id)
+{
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	for (auto f = f_start; f < f_stop; f++)
+		this->_transmit(X_N + f * this->N,
+		                Y_N + f * this->N,
+		                f);
+}
+
+template <typename B, typename R, typename Q>
+void Fused_BPSK_AWGN<B,R,Q>
+::_transmit(const B *X_N, Q *Y_N, const int frame_id)
+{
+	this->transmit_seq(X_N, Y_N, 0);
+}
+
+template <typename B, typename R, typename Q>
+void Fused_BPSK_AWGN<B,R,Q>
+::transmit_seq(const B *X_N, Q *Y_N, const int start)
+{
+	const auto twopi = (R)(2.0 * 3.14159265358979323846);
+	const auto scale = llr_factor * (R)factor;
+
+	auto llr = [&](const int i, const R noise) -> Q
+	{
+		const auto y = ((R)1 - (R)(X_N[i] + X_N[i]) + noise) * scale; // (X_N[i] == 1) ? -1 : +1
+		if (std::is_floating_point<Q>::value)
+			return (Q)y;
+		else
+			return (Q)tools::saturate((R)std::round(y), (R)val_min, (R)val_max);
+	};
+
+	// seq version of the Box Muller method in the polar form
+	const auto seq_loop_size = start + ((this->N - start) / 2) * 2;
+	for (auto i = start; i < seq_loop_size; i += 2)
+	{
+		const auto u1 = (R)mt19937.randf_oo();
+		const auto u2 = (R)mt19937.randf_oo();
+
+		const auto radius = (R)std::sqrt(std::log(u1) * (R)-2.0) * sigma;
+		const auto theta  = u2 * twopi;
+
+		Y_N[i +0] = llr(i +0, radius * (R)std::cos(theta));
+		Y_N[i +1] = llr(i +1, radius * (R)std::sin(theta));
+	}
+
+	// distribute the last odd element
+	if (this->N != seq_loop_size)
+	{
+		const auto u1 = (R)mt19937.randf_oo();
+		const auto u2 = (R)mt19937.randf_oo();
+
+		const auto radius = (R)std::sqrt(std::log(u1) * (R)-2.0) * sigma;
+		const auto theta  = u2 * twopi;
+
+		Y_N[this->N -1] = llr(this->N -1, radius * (R)std::sin(theta));
+	}
+}
+
+// ---------------------------------------------------------------------------------------------------- SIMD versions
+
+// loads the next 4 * "mipp::nElReg<float>()" bits and converts them in registers
+static inline void load_bits(const int *X_N, mipp::Reg<float> r_b[4])
+{
+	for (auto r = 0; r < 4; r++)
+	{
+		mipp::Reg<int> r_b32i;
+		r_b32i.loadu(&X_N[r * mipp::nElReg<int>()]);
+		r_b[r] = r_b32i.cvt<float>();
+	}
+}
+
+static inline void load_bits(const short *X_N, mipp::Reg<float> r_b[4])
+{
+	for (auto r = 0; r < 2; r++)
+	{
+		mipp::Reg<short> r_b16i;
+		r_b16i.loadu(&X_N[r * mipp::nElReg<short>()]);
+		r_b[2*r +0] = r_b16i.low ().cvt<int>().cvt<float>();
+		r_b[2*r +1] = r_b16i.high().cvt<int>().cvt<float>();
+	}
+}
+
+static inline void load_bits(const signed char *X_N, mipp::Reg<float> r_b[4])
+{
+	mipp::Reg<signed char> r_b8i;
+	r_b8i.loadu(X_N);
+
+	const mipp::Reg<short> r_b16i[2] = {r_b8i.low().cvt<short>(), r_b8i.high().cvt<short>()};
+	for (auto r = 0; r < 2; r++)
+	{
+		r_b[2*r +0] = r_b16i[r].low ().cvt<int>().cvt<float>();
+		r_b[2*r +1] = r_b16i[r].high().cvt<int>().cvt<float>();
+	}
+}
+
+// stores 4 registers of LLRs (already multiplied by the fixed-point factor)
+static inline void store_llrs(const mipp::Reg<float> r_llr[4], float *Y_N, const int, const int)
+{
+	for (auto r = 0; r < 4; r++)
+		r_llr[r].storeu(&Y_N[r * mipp::nElReg<float>()]);
+}
+
+static inline void store_llrs(const mipp::Reg<float> r_llr[4], short *Y_N, const int val_min, const int val_max)
+{
+	const auto r_q16i_0 = mipp::pack<int,short>(r_llr[0].round().cvt<int>(), r_llr[1].round().cvt<int>());
+	const auto r_q16i_1 = mipp::pack<int,short>(r_llr[2].round().cvt<int>(), r_llr[3].round().cvt<int>());
+
+	r_q16i_0.sat(val_min, val_max).storeu(&Y_N[0 * mipp::nElReg<short>()]);
+	r_q16i_1.sat(val_min, val_max).storeu(&Y_N[1 * mipp::nElReg<short>()]);
+}
+
+static inline void store_llrs(const mipp::Reg<float> r_llr[4], signed char *Y_N, const int val_min,
+                              const int val_max)
+{
+	const auto r_q16i_0 = mipp::pack<int,short>(r_llr[0].round().cvt<int>(), r_llr[1].round().cvt<int>());
+	const auto r_q16i_1 = mipp::pack<int,short>(r_llr[2].round().cvt<int>(), r_llr[3].round().cvt<int>());
+
+	const auto r_q8i = mipp::pack<short,signed char>(r_q16i_0, r_q16i_1);
+	r_q8i.sat(val_min, val_max).storeu(Y_N);
+}
+
+// computes the LLRs of the 4 * "mipp::nElReg<float>()" first bits of each chunk, the noise never leaves the registers,
+// returns the number of processed bits (the remaining ones have to be processed by the sequential version)
+template <typename B, typename Q>
+static int transmit_simd(const B *X_N, Q *Y_N, const int N, tools::PRNG_MT19937_simd &mt19937_simd,
+                         const float sigma, const float scale, const int val_min, const int val_max)
+{
+	const auto chunk = 4 * mipp::nElReg<float>();
+	const auto vec_loop_size = (N / chunk) * chunk;
+
+	const auto r_twopi = mipp::Reg<float>((float)(2.0 * 3.14159265358979323846));
+	const auto r_sigma = mipp::Reg<float>(sigma);
+	const auto r_scale = mipp::Reg<float>(scale);
+	const auto r_one   = mipp::Reg<float>(1.f);
+
+	mipp::Reg<float> r_b[4], r_llr[4];
+	for (auto i = 0; i < vec_loop_size; i += chunk)
+	{
+		load_bits(&X_N[i], r_b);
+
+		// SIMD version of the Box Muller method in the polar form, 2 registers of noise per pair of uniform registers
+		for (auto r = 0; r < 4; r += 2)
+		{
+			const auto u1 = mt19937_simd.randf_oo();
+			const auto u2 = mt19937_simd.randf_oo();
+
+			const auto radius = mipp::sqrt(mipp::log(u1) * -2.f) * r_sigma;
+			const auto theta  = u2 * r_twopi;
+
+			mipp::Reg<float> sintheta, costheta;
+			mipp::sincos(theta, sintheta, costheta);
+
+			// BPSK: (X_N[i] == 1) ? -1 : +1
+			const auto x0 = r_one - (r_b[r +0] + r_b[r +0]);
+			const auto x1 = r_one - (r_b[r +1] + r_b[r +1]);
+
+			r_llr[r +0] = (x0 + radius * costheta) * r_scale;
+			r_llr[r +1] = (x1 + radius * sintheta) * r_scale;
+		}
+
+		store_llrs(r_llr, &Y_N[i], val_min, val_max);
+	}
+
+	return vec_loop_size;
+}
+
+namespace aff3ct
+{
+namespace module
+{
+template <>
+void Fused_BPSK_AWGN<int,float,float>
+::_transmit(const int *X_N, float *Y_N, const int frame_id)
+{
+	const auto vec_loop_size = transmit_simd(X_N, Y_N, this->N, mt19937_simd, sigma,
+	                                         llr_factor, val_min, val_max);
+	this->transmit_seq(X_N, Y_N, vec_loop_size);
+}
+}
+}
+
+namespace aff3ct
+{
+namespace module
+{
+template <>
+void Fused_BPSK_AWGN<short,float,short>
+::_transmit(const short *X_N, short *Y_N, const int frame_id)
+{
+	const auto vec_loop_size = transmit_simd(X_N, Y_N, this->N, mt19937_simd, sigma,
+	                                         llr_factor * (float)factor, val_min, val_max);
+	this->transmit_seq(X_N, Y_N, vec_loop_size);
+}
+}
+}
+
+namespace aff3ct
+{
+namespace module
+{
+template <>
+void Fused_BPSK_AWGN<signed char,float,signed char>
+::_transmit(const signed char *X_N, signed char *Y_N, const int frame_id)
+{
+	const auto vec_loop_size = transmit_simd(X_N, Y_N, this->N, mt19937_simd, sigma,
+	                                         llr_factor * (float)factor, val_min, val_max);
+	this->transmit_seq(X_N, Y_N, vec_loop_size);
+}
+}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Fused_BPSK_AWGN<B_8, R_8, Q_8 >;
+template class aff3ct::module::Fused_BPSK_AWGN<B_16,R_16,Q_16>;
+template class aff3ct::module::Fused_BPSK_AWGN<B_32,R_32,Q_32>;
+template class aff3ct::module::Fused_BPSK_AWGN<B_64,R_64,Q_64>;
+#else
+template class aff3ct::module::Fused_BPSK_AWGN<B,R,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
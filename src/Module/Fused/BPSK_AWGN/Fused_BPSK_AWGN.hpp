@@ -0,0 +1,112 @@
+/*!
+ * \file
+ * \brief BPSK modulation, AWGN channel, LLR computation and quantization in a single pass.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef FUSED_BPSK_AWGN_HPP_
+#define FUSED_BPSK_AWGN_HPP_
+
+#include <mipp.h>
+
+#include "Tools/Algo/PRNG/PRNG_MT19937.hpp"
+#include "Tools/Algo/PRNG/PRNG_MT19937_simd.hpp"
+
+#include "Module/Module.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+	namespace fus
+	{
+		namespace tsk
+		{
+			enum list { transmit, SIZE };
+		}
+
+		namespace sck
+		{
+			namespace transmit { enum list { X_N, Y_N, SIZE }; }
+		}
+	}
+
+/*!
+ * \class Fused_BPSK_AWGN
+ *
+ * \brief BPSK modulation, AWGN channel, LLR computation and quantization in a single pass.
+ *
+ * Replaces the "Modem_BPSK::modulate", "Channel_AWGN_LLR::add_noise", "Modem_BPSK::demodulate" and
+ * "Quantizer_fast::process" sequence: the encoded bits are read once, the noise is generated in the SIMD registers
+ * (Box Muller method on the SIMD Mersenne Twister) and the (quantized) LLRs are written directly, there is no
+ * intermediate buffer.
+ *
+ * \tparam B: type of the encoded bits.
+ * \tparam R: type of the reals used to compute the LLRs.
+ * \tparam Q: type of the LLRs (if Q is a fixed-point representation, the LLRs are quantized as in Quantizer_fast).
+ */
+template <typename B = int, typename R = float, typename Q = R>
+class Fused_BPSK_AWGN : public Module
+{
+protected:
+	const int   N;
+	const bool  disable_sig2;
+	const int   val_max;
+	const int   val_min;
+	const int   factor;
+	R           sigma;
+	R           llr_factor; // 2 / sigma^2 (or 1 if disable_sig2)
+
+	tools::PRNG_MT19937      mt19937;      // Mersenne Twister 19937 (scalar)
+	tools::PRNG_MT19937_simd mt19937_simd; // Mersenne Twister 19937 (SIMD)
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param N:               size of one frame.
+	 * \param fixed_point_pos: position of the fixed point in the quantized LLRs (ignored if Q is floating-point).
+	 * \param saturation_pos:  number of bits of the quantized LLRs (ignored if Q is floating-point).
+	 * \param disable_sig2:    do not multiply the LLRs by 2 / sigma^2.
+	 * \param seed:            the seed of the noise generator.
+	 * \param n_frames:        number of frames to process in the Module.
+	 */
+	Fused_BPSK_AWGN(const int N, const short fixed_point_pos, const short saturation_pos, const bool disable_sig2,
+	                const int seed = 0, const int n_frames = 1);
+
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt (the state of the noise generator is copied).
+	 */
+	Fused_BPSK_AWGN(const Fused_BPSK_AWGN &m);
+
+	virtual ~Fused_BPSK_AWGN();
+	virtual Fused_BPSK_AWGN<B,R,Q>* clone() const;
+
+	int get_N() const;
+
+	void set_seed (const int seed );
+	void set_sigma(const R   sigma);
+
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+
+	/*!
+	 * \brief Computes the (quantized) LLRs of the noisy BPSK symbols of the encoded bits.
+	 *
+	 * \param X_N: the encoded bits.
+	 * \param Y_N: the (quantized) LLRs.
+	 */
+	virtual void transmit(const B *X_N, Q *Y_N, const int frame_id = -1);
+
+protected:
+	virtual void _transmit(const B *X_N, Q *Y_N, const int frame_id);
+
+private:
+	void create_tasks();
+	void transmit_seq(const B *X_N, Q *Y_N, const int start);
+};
+}
+}
+
+#endif /* FUSED_BPSK_AWGN_HPP_ */
@@ -26,6 +26,13 @@ Modem_BPSK<B,R,Q>
 {
 }
 
+template <typename B, typename R, typename Q>
+Modem_BPSK<B,R,Q>* Modem_BPSK<B,R,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Modem_BPSK::deep_copy);
+}
+
 template <typename B, typename R, typename Q>
 void Modem_BPSK<B,R,Q>
 ::set_sigma(const R sigma)
@@ -17,6 +17,7 @@ private:
 public:
 	Modem_BPSK(const int N, const R sigma = (R)1, const bool disable_sig2 = false, const int n_frames = 1);
 	virtual ~Modem_BPSK();
+	virtual Modem_BPSK<B,R,Q>* clone() const;
 
 	void set_sigma(const R sigma);
 
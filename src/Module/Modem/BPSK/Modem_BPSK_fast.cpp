@@ -27,6 +27,13 @@ Modem_BPSK_fast<B,R,Q>
 {
 }
 
+template <typename B, typename R, typename Q>
+Modem_BPSK_fast<B,R,Q>* Modem_BPSK_fast<B,R,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Modem_BPSK_fast::deep_copy);
+}
+
 template <typename B, typename R, typename Q>
 void Modem_BPSK_fast<B,R,Q>
 ::set_sigma(const R sigma)
@@ -249,6 +249,16 @@ public:
 		});
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Modem (see Module::clone).
+	 */
+	Modem(const Modem &m)
+	: Modem(m.N, m.N_mod, m.N_fil, m.sigma, m.n_frames)
+	{
+		this->enable_filter      = m.enable_filter;
+		this->enable_demodulator = m.enable_demodulator;
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
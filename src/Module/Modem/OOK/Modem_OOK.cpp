@@ -28,6 +28,13 @@ Modem_OOK<B,R,Q>
 {
 }
 
+template <typename B, typename R, typename Q>
+Modem_OOK<B,R,Q>* Modem_OOK<B,R,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Modem_OOK::deep_copy);
+}
+
 template <typename B, typename R, typename Q>
 void Modem_OOK<B,R,Q>
 ::set_sigma(const R sigma)
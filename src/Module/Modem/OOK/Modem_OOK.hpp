@@ -17,6 +17,7 @@ protected:
 public:
 	Modem_OOK(const int N, const R sigma = (R)1, const bool disable_sig2 = false, const int n_frames = 1);
 	virtual ~Modem_OOK();
+	virtual Modem_OOK<B,R,Q>* clone() const;
 
 	void set_sigma(const R sigma);
 
@@ -1,6 +1,7 @@
 #ifndef MODEM_PAM_HPP_
 #define MODEM_PAM_HPP_
 
+#include <memory>
 #include <vector>
 
 #include "Tools/Math/max.h"
@@ -19,12 +20,13 @@ private:
 	const int nbr_symbols;
 	const R sqrt_es;
 	const bool disable_sig2;
-	std::vector<R> constellation;
+	std::shared_ptr<const std::vector<R>> constellation; // read-only, shared by the clones
 
 public:
 	Modem_PAM(const int N, const R sigma = (R)1, const int bits_per_symbol = 1, const bool disable_sig2 = false,
 	          const int n_frames = 1);
 	virtual ~Modem_PAM();
+	virtual Modem_PAM<B,R,Q,MAX>* clone() const;
 
 	static int size_mod(const int N, const int bps)
 	{
@@ -23,21 +23,22 @@ Modem_PAM<B,R,Q,MAX>
   bits_per_symbol(bits_per_symbol),
   nbr_symbols    (1 << bits_per_symbol),
   sqrt_es        ((R)std::sqrt((this->nbr_symbols * this->nbr_symbols - 1.0) / 3.0)),
-  disable_sig2   (disable_sig2),
-  constellation  (nbr_symbols)
+  disable_sig2   (disable_sig2)
 {
 	const std::string name = "Modem_PAM";
 	this->set_name(name);
 	
 	std::vector<B> bits(this->bits_per_symbol);
 
+	auto constellation = std::make_shared<std::vector<R>>(this->nbr_symbols);
 	for (auto j = 0; j < this->nbr_symbols; j++)
 	{
 		for (auto l = 0; l < this->bits_per_symbol; l++)
 			bits[l] = (j >> l) & 1;
 
-		this->constellation[j] = this->bits_to_symbol(&bits[0]);
+		(*constellation)[j] = this->bits_to_symbol(&bits[0]);
 	}
+	this->constellation = constellation;
 }
 
 template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
@@ -46,6 +47,13 @@ Modem_PAM<B,R,Q,MAX>
 {
 }
 
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
+Modem_PAM<B,R,Q,MAX>* Modem_PAM<B,R,Q,MAX>
+::clone() const
+{
+	return Module::clone_impl(*this, &Modem_PAM::deep_copy);
+}
+
 /*
  * Mapping function
  */
@@ -83,7 +91,7 @@ void Modem_PAM<B,R,Q,MAX>
 		unsigned idx = 0;
 		for (auto j = 0; j < bps; j++)
 			idx += unsigned(unsigned(1 << j) * X_N1[i * bps +j]);
-		auto symbol = this->constellation[idx];
+		auto symbol = (*this->constellation)[idx];
 
 		X_N2[i] = symbol;
 	}
@@ -94,7 +102,7 @@ void Modem_PAM<B,R,Q,MAX>
 		unsigned idx = 0;
 		for (auto j = 0; j < size_in - (main_loop_size * bps); j++)
 			idx += unsigned(unsigned(1 << j) * X_N1[main_loop_size * bps +j]);
-		auto symbol = this->constellation[idx];
+		auto symbol = (*this->constellation)[idx];
 
 		X_N2[size_out -1] = symbol;
 	}
@@ -135,11 +143,11 @@ void Modem_PAM<B,R,Q,MAX>
 
 		for (auto j = 0; j < this->nbr_symbols; j++)
 			if ((j & (1 << b)) == 0)
-				L0 = MAX(L0, -(Y_N1[k] - (Q)this->constellation[j]) *
-				              (Y_N1[k] - (Q)this->constellation[j]) * inv_sigma2);
+				L0 = MAX(L0, -(Y_N1[k] - (Q)(*this->constellation)[j]) *
+				              (Y_N1[k] - (Q)(*this->constellation)[j]) * inv_sigma2);
 			else
-				L1 = MAX(L1, -(Y_N1[k] - (Q)this->constellation[j]) *
-				              (Y_N1[k] - (Q)this->constellation[j]) * inv_sigma2);
+				L1 = MAX(L1, -(Y_N1[k] - (Q)(*this->constellation)[j]) *
+				              (Y_N1[k] - (Q)(*this->constellation)[j]) * inv_sigma2);
 
 		Y_N2[n] = (L0 - L1);
 	}
@@ -170,11 +178,11 @@ void Modem_PAM<B,R,Q,MAX>
 
 		for (auto j = 0; j < this->nbr_symbols; j++)
 			if ((j & (1 << b)) == 0)
-				L0 = MAX(L0, -(Y_N1[k] - (Q)H_N[k] * (Q)this->constellation[j]) *
-				              (Y_N1[k] - (Q)H_N[k] * (Q)this->constellation[j]) * inv_sigma2);
+				L0 = MAX(L0, -(Y_N1[k] - (Q)H_N[k] * (Q)(*this->constellation)[j]) *
+				              (Y_N1[k] - (Q)H_N[k] * (Q)(*this->constellation)[j]) * inv_sigma2);
 			else
-				L1 = MAX(L1, -(Y_N1[k] - (Q)H_N[k] * (Q)this->constellation[j]) *
-				              (Y_N1[k] - (Q)H_N[k] * (Q)this->constellation[j]) * inv_sigma2);
+				L1 = MAX(L1, -(Y_N1[k] - (Q)H_N[k] * (Q)(*this->constellation)[j]) *
+				              (Y_N1[k] - (Q)H_N[k] * (Q)(*this->constellation)[j]) * inv_sigma2);
 
 		Y_N2[n] = (L0 - L1);
 	}
@@ -202,8 +210,8 @@ void Modem_PAM<B,R,Q,MAX>
 
 		for (auto j = 0; j < this->nbr_symbols; j++)
 		{
-			auto tempL  = (Q)((Y_N1[k] - this->constellation[j]) *
-			                  (Y_N1[k] - this->constellation[j]) * inv_sigma2);
+			auto tempL  = (Q)((Y_N1[k] - (*this->constellation)[j]) *
+			                  (Y_N1[k] - (*this->constellation)[j]) * inv_sigma2);
 
 			for (auto l = 0; l < b; l++)
 				tempL += (j & (1 << l)) * Y_N2[k * this->bits_per_symbol +l];
@@ -243,8 +251,8 @@ void Modem_PAM<B,R,Q,MAX>
 
 		for (auto j = 0; j < this->nbr_symbols; j++)
 		{
-			auto tempL = (Q)((Y_N1[k] - (Q)H_N[k] * this->constellation[j]) *
-			                 (Y_N1[k] - (Q)H_N[k] * this->constellation[j]) * inv_sigma2);
+			auto tempL = (Q)((Y_N1[k] - (Q)H_N[k] * (*this->constellation)[j]) *
+			                 (Y_N1[k] - (Q)H_N[k] * (*this->constellation)[j]) * inv_sigma2);
 
 			for (auto l = 0; l < b; l++)
 				tempL += (j & (1 << l)) * Y_N2[k * this->bits_per_symbol +l];
@@ -1,6 +1,7 @@
 #ifndef MODEM_PSK_HPP_
 #define MODEM_PSK_HPP_
 
+#include <memory>
 #include <complex>
 #include <vector>
 
@@ -19,12 +20,13 @@ private:
 	const int bits_per_symbol;
 	const int nbr_symbols;
 	const bool disable_sig2;
-	std::vector<std::complex<R>> constellation;
+	std::shared_ptr<const std::vector<std::complex<R>>> constellation; // read-only, shared by the clones
 
 public:
 	Modem_PSK(const int N, const R sigma = (R)1, const int bits_per_symbol = 2, const bool disable_sig2 = false,
 	          const int n_frames = 1);
 	virtual ~Modem_PSK();
+	virtual Modem_PSK<B,R,Q,MAX>* clone() const;
 
 	static int size_mod(const int N, const int bps)
 	{
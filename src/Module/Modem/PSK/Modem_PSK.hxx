@@ -26,21 +26,22 @@ Modem_PSK<B,R,Q,MAX>
                n_frames),
   bits_per_symbol(bits_per_symbol),
   nbr_symbols    (1 << bits_per_symbol),
-  disable_sig2   (disable_sig2),
-  constellation  (nbr_symbols)
+  disable_sig2   (disable_sig2)
 {
 	const std::string name = "Modem_PSK";
 	this->set_name(name);
 	
 	std::vector<B> bits(this->bits_per_symbol);
 
+	auto constellation = std::make_shared<std::vector<std::complex<R>>>(this->nbr_symbols);
 	for (auto j = 0; j < this->nbr_symbols; j++)
 	{
 		for (auto l = 0; l< this->bits_per_symbol; l++)
 			bits[l] = (j >> l) & 1;
 
-		this->constellation[j] = this->bits_to_symbol(&bits[0]);
+		(*constellation)[j] = this->bits_to_symbol(&bits[0]);
 	}
+	this->constellation = constellation;
 }
 
 template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
@@ -49,6 +50,13 @@ Modem_PSK<B,R,Q,MAX>
 {
 }
 
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
+Modem_PSK<B,R,Q,MAX>* Modem_PSK<B,R,Q,MAX>
+::clone() const
+{
+	return Module::clone_impl(*this, &Modem_PSK::deep_copy);
+}
+
 /*
  * Mapping function
  */
@@ -87,7 +95,7 @@ void Modem_PSK<B,R,Q,MAX>
 		unsigned idx = 0;
 		for (auto j = 0; j < bps; j++)
 			idx += unsigned(unsigned(1 << j) * X_N1[i * bps +j]);
-		auto symbol = this->constellation[idx];
+		auto symbol = (*this->constellation)[idx];
 
 		X_N2[2*i +0] = symbol.real();
 		X_N2[2*i +1] = symbol.imag();
@@ -99,7 +107,7 @@ void Modem_PSK<B,R,Q,MAX>
 		unsigned idx = 0;
 		for (auto j = 0; j < size_in - (main_loop_size * bps); j++)
 			idx += unsigned(unsigned(1 << j) * X_N1[main_loop_size * bps +j]);
-		auto symbol = this->constellation[idx];
+		auto symbol = (*this->constellation)[idx];
 
 		X_N2[size_out -2] = symbol.real();
 		X_N2[size_out -1] = symbol.imag();
@@ -143,11 +151,11 @@ void Modem_PSK<B,R,Q,MAX>
 
 		for (auto j = 0; j < this->nbr_symbols; j++)
 			if ((j & (1 << b)) == 0)
-				L0 = MAX(L0, -std::norm(complex_Yk - std::complex<Q>((Q)this->constellation[j].real(),
-				                                                     (Q)this->constellation[j].imag())) * inv_sigma2);
+				L0 = MAX(L0, -std::norm(complex_Yk - std::complex<Q>((Q)(*this->constellation)[j].real(),
+				                                                     (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 			else
-				L1 = MAX(L1, -std::norm(complex_Yk - std::complex<Q>((Q)this->constellation[j].real(),
-				                                                     (Q)this->constellation[j].imag())) * inv_sigma2);
+				L1 = MAX(L1, -std::norm(complex_Yk - std::complex<Q>((Q)(*this->constellation)[j].real(),
+				                                                     (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 
 		Y_N2[n] = (L0 - L1);
 	}
@@ -182,12 +190,12 @@ void Modem_PSK<B,R,Q,MAX>
 		for (auto j = 0; j < this->nbr_symbols; j++)
 			if ((j & (1 << b)) == 0)
 				L0 = MAX(L0, -std::norm(complex_Yk -
-				                        complex_Hk * std::complex<Q>((Q)this->constellation[j].real(),
-				                                                     (Q)this->constellation[j].imag())) * inv_sigma2);
+				                        complex_Hk * std::complex<Q>((Q)(*this->constellation)[j].real(),
+				                                                     (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 			else
 				L1 = MAX(L1, -std::norm(complex_Yk -
-				                        complex_Hk * std::complex<Q>((Q)this->constellation[j].real(),
-				                                                     (Q)this->constellation[j].imag())) * inv_sigma2);
+				                        complex_Hk * std::complex<Q>((Q)(*this->constellation)[j].real(),
+				                                                     (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 
 		Y_N2[n] = (L0 - L1);
 	}
@@ -220,8 +228,8 @@ void Modem_PSK<B,R,Q,MAX>
 
 		for (auto j = 0; j < this->nbr_symbols; j++)
 		{
-			auto tempL = (Q)(std::norm(complex_Yk - std::complex<Q>((Q)this->constellation[j].real(),
-			                                                        (Q)this->constellation[j].imag())) * inv_sigma2);
+			auto tempL = (Q)(std::norm(complex_Yk - std::complex<Q>((Q)(*this->constellation)[j].real(),
+			                                                        (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 
 			for (auto l = 0; l < b; l++)
 				tempL += (j & (1 << l)) * Y_N2[k * this->bits_per_symbol +l];
@@ -268,8 +276,8 @@ void Modem_PSK<B,R,Q,MAX>
 		for (auto j = 0; j < this->nbr_symbols; j++)
 		{
 			auto tempL = (Q)(std::norm(complex_Yk -
-			                           complex_Hk * std::complex<Q>((Q)this->constellation[j].real(),
-			                                                        (Q)this->constellation[j].imag())) * inv_sigma2);
+			                           complex_Hk * std::complex<Q>((Q)(*this->constellation)[j].real(),
+			                                                        (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 
 			for (auto l = 0; l < b; l++)
 				tempL += (j & (1 << l)) * Y_N2[k * this->bits_per_symbol +l];
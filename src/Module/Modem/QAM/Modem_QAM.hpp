@@ -1,6 +1,7 @@
 #ifndef MODEM_QAM_HPP_
 #define MODEM_QAM_HPP_
 
+#include <memory>
 #include <complex>
 #include <vector>
 
@@ -20,12 +21,13 @@ private:
 	const int nbr_symbols;
 	const R sqrt_es;
 	const bool disable_sig2;
-	std::vector<std::complex<R>> constellation;
+	std::shared_ptr<const std::vector<std::complex<R>>> constellation; // read-only, shared by the clones
 
 public:
 	Modem_QAM(const int N, const R sigma = (R)1, const int bits_per_symbol = 2, const bool disable_sig2 = false,
 	          const int n_frames = 1);
 	virtual ~Modem_QAM();
+	virtual Modem_QAM<B,R,Q,MAX>* clone() const;
 
 	static int size_mod(const int N, const int bps)
 	{
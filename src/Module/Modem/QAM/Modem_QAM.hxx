@@ -24,8 +24,7 @@ Modem_QAM<B,R,Q,MAX>
   bits_per_symbol(bits_per_symbol),
   nbr_symbols    (1 << bits_per_symbol),
   sqrt_es        ((R)std::sqrt(2.0 * (this->nbr_symbols -1) / 3.0)),
-  disable_sig2   (disable_sig2),
-  constellation  (nbr_symbols)
+  disable_sig2   (disable_sig2)
 {
 	const std::string name = "Modem_QAM";
 	this->set_name(name);
@@ -39,13 +38,15 @@ Modem_QAM<B,R,Q,MAX>
 
 	std::vector<B> bits(this->bits_per_symbol);
 
+	auto constellation = std::make_shared<std::vector<std::complex<R>>>(this->nbr_symbols);
 	for (auto j = 0; j < this->nbr_symbols; j++)
 	{
 		for (auto l = 0; l < this->bits_per_symbol; l++)
 			bits[l] = (j >> l) & 1;
 
-		this->constellation[j] = this->bits_to_symbol(&bits[0]);
+		(*constellation)[j] = this->bits_to_symbol(&bits[0]);
 	}
+	this->constellation = constellation;
 }
 
 template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
@@ -54,6 +55,13 @@ Modem_QAM<B,R,Q,MAX>
 {
 }
 
+template <typename B, typename R, typename Q, tools::proto_max<Q> MAX>
+Modem_QAM<B,R,Q,MAX>* Modem_QAM<B,R,Q,MAX>
+::clone() const
+{
+	return Module::clone_impl(*this, &Modem_QAM::deep_copy);
+}
+
 /*
  * Mapping function
  */
@@ -96,7 +104,7 @@ void Modem_QAM<B,R,Q,MAX>
 		unsigned idx = 0;
 		for (auto j = 0; j < bps; j++)
 			idx += unsigned(unsigned(1 << j) * X_N1[i * bps +j]);
-		auto symbol = this->constellation[idx];
+		auto symbol = (*this->constellation)[idx];
 
 		X_N2[2*i   ] = symbol.real();
 		X_N2[2*i +1] = symbol.imag();
@@ -108,7 +116,7 @@ void Modem_QAM<B,R,Q,MAX>
 		unsigned idx = 0;
 		for (auto j = 0; j < size_in - (main_loop_size * bps); j++)
 			idx += unsigned(unsigned(1 << j) * X_N1[main_loop_size * bps +j]);
-		auto symbol = this->constellation[idx];
+		auto symbol = (*this->constellation)[idx];
 
 		X_N2[size_out -2] = symbol.real();
 		X_N2[size_out -1] = symbol.imag();
@@ -152,11 +160,11 @@ void Modem_QAM<B,R,Q,MAX>
 
 		for (auto j = 0; j < this->nbr_symbols; j++)
 			if ((j & (1 << b)) == 0)
-				L0 = MAX(L0, -std::norm(complex_Yk - std::complex<Q>((Q)this->constellation[j].real(),
-				                                                     (Q)this->constellation[j].imag())) * inv_sigma2);
+				L0 = MAX(L0, -std::norm(complex_Yk - std::complex<Q>((Q)(*this->constellation)[j].real(),
+				                                                     (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 			else
-				L1 = MAX(L1, -std::norm(complex_Yk - std::complex<Q>((Q)this->constellation[j].real(),
-				                                                     (Q)this->constellation[j].imag())) * inv_sigma2);
+				L1 = MAX(L1, -std::norm(complex_Yk - std::complex<Q>((Q)(*this->constellation)[j].real(),
+				                                                     (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 
 		Y_N2[n] = (L0 - L1);
 	}
@@ -191,12 +199,12 @@ void Modem_QAM<B,R,Q,MAX>
 		for (auto j = 0; j < this->nbr_symbols; j++)
 			if ((j & (1 << b)) == 0)
 				L0 = MAX(L0, -std::norm(complex_Yk -
-				                        complex_Hk * std::complex<Q>((Q)this->constellation[j].real(),
-				                                                     (Q)this->constellation[j].imag())) * inv_sigma2);
+				                        complex_Hk * std::complex<Q>((Q)(*this->constellation)[j].real(),
+				                                                     (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 			else
 				L1 = MAX(L1, -std::norm(complex_Yk -
-				                        complex_Hk * std::complex<Q>((Q)this->constellation[j].real(),
-				                                                     (Q)this->constellation[j].imag())) * inv_sigma2);
+				                        complex_Hk * std::complex<Q>((Q)(*this->constellation)[j].real(),
+				                                                     (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 
 		Y_N2[n] = (L0 - L1);
 	}
@@ -226,8 +234,8 @@ void Modem_QAM<B,R,Q,MAX>
 
 		for (auto j = 0; j < this->nbr_symbols; j++)
 		{
-			auto tempL = (Q)(std::norm(complex_Yk - std::complex<Q>((Q)this->constellation[j].real(),
-			                                                        (Q)this->constellation[j].imag())) * inv_sigma2);
+			auto tempL = (Q)(std::norm(complex_Yk - std::complex<Q>((Q)(*this->constellation)[j].real(),
+			                                                        (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 
 			for (auto l = 0; l < b; l++)
 				tempL += (j & (1 << l)) * Y_N2[k * this->bits_per_symbol +l];
@@ -271,8 +279,8 @@ void Modem_QAM<B,R,Q,MAX>
 		for (auto j = 0; j < this->nbr_symbols; j++)
 		{
 			auto tempL = (Q)(std::norm(complex_Yk -
-			                           complex_Hk * std::complex<Q>((Q)this->constellation[j].real(),
-			                                                        (Q)this->constellation[j].imag())) * inv_sigma2);
+			                           complex_Hk * std::complex<Q>((Q)(*this->constellation)[j].real(),
+			                                                        (Q)(*this->constellation)[j].imag())) * inv_sigma2);
 
 			for (auto l = 0; l < b; l++)
 				tempL += (j & (1 << l)) * Y_N2[k * this->bits_per_symbol +l];
@@ -10,6 +10,7 @@
 
 #include <string>
 #include <sstream>
+#include <iostream>
 
 #include <typeinfo>
 #include <typeindex>
@@ -69,6 +70,11 @@ public:
 		}
 	}
 
+	/*!
+	 * \brief Copy constructor, deleted: the Tasks capture their Module, use "clone" instead.
+	 */
+	Module(const Module&) = delete;
+
 	/*!
 	 * \brief Destructor.
 	 */
@@ -77,6 +83,42 @@ public:
 		for (auto t : tasks) delete t;
 	}
 
+	/*!
+	 * \brief Returns a deep copy of the Module.
+	 *
+	 * The Tasks and the Sockets of the clone are rebuilt (the Sockets are not bound) and the internal state is
+	 * duplicated. The read-only data the Module has been built from (code matrices, frozen bits, trellis, ...) are
+	 * not duplicated: the clone references the same data and the original object owning them has to live longer than
+	 * the clone.
+	 *
+	 * \return a new Module, owned by the caller.
+	 */
+	virtual Module* clone() const
+	{
+		std::stringstream message;
+		message << "This Module can't be cloned ('name' = " << this->get_name() << ").";
+		throw tools::unimplemented_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	/*!
+	 * \brief Writes the internal state which evolves from a frame to another (the PRNGs, the error counters, ...), to
+	 *        checkpoint a simulation. The Modules without such a state have nothing to write.
+	 *
+	 * \param os: the output stream (text format).
+	 */
+	virtual void save_state(std::ostream &) const
+	{
+	}
+
+	/*!
+	 * \brief Restores an internal state written by "save_state", the Module has to be built with the same parameters.
+	 *
+	 * \param is: the input stream (text format).
+	 */
+	virtual void load_state(std::istream &)
+	{
+	}
+
 	/*!
 	 * \brief Get the number of frames.
 	 *
@@ -171,6 +213,52 @@ protected:
 	{
 		task.register_timer(key);
 	}
+
+	/*!
+	 * \brief Implements "clone": "m" is soft copied with the copy constructor of "T", then hard copied with the
+	 *        "deep_copy" method of the most derived class (the copy is released if the hard copy fails).
+	 *
+	 * \param m:         the Module to clone.
+	 * \param deep_copy: the "deep_copy" method to call on the copy ("&T::deep_copy").
+	 *
+	 * \return a new Module, owned by the caller.
+	 */
+	template <class T, class D>
+	static T* clone_impl(const T &m, void (D::*deep_copy)(const D&))
+	{
+		auto c = new T(m); // soft copy constructor
+		try
+		{
+			(c->*deep_copy)(m); // hard copy
+		}
+		catch (...)
+		{
+			delete c;
+			throw;
+		}
+		return c;
+	}
+
+	/*!
+	 * \brief Completes a copy made by "clone": the names, the Task settings and the extra timers of "m" are copied
+	 *        (the copy constructors only rebuild the Tasks of the base classes).
+	 */
+	void deep_copy(const Module &m)
+	{
+		this->name       = m.name;
+		this->short_name = m.short_name;
+
+		if (this->tasks.size() != m.tasks.size())
+		{
+			std::stringstream message;
+			message << "'tasks.size()' has to be equal to 'm.tasks.size()' ('tasks.size()' = " << this->tasks.size()
+			        << ", 'm.tasks.size()' = " << m.tasks.size() << ", 'name' = " << m.get_name() << ").";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		for (size_t t = 0; t < this->tasks.size(); t++)
+			this->tasks[t]->copy_settings(*m.tasks[t]);
+	}
 };
 }
 }
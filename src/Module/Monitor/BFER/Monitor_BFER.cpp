@@ -1,23 +1,54 @@
+#include <cmath>
 #include <string>
 #include <vector>
+#include <sstream>
+#include <algorithm>
 #include <stdexcept>
 
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/confidence_interval.h"
+
 #include "Monitor_BFER.hpp"
 
 using namespace aff3ct::module;
 
 template <typename B>
 Monitor_BFER<B>
-::Monitor_BFER(const int size, const unsigned max_fe, const int n_frames)
+::Monitor_BFER(const int size, const unsigned max_fe, const int n_frames,
+               const ci_method_t ci_method, const float ci_precision, const float ci_confidence)
 : Monitor(size, n_frames),
   max_fe(max_fe),
+  ci_method(ci_method),
+  ci_precision(ci_precision),
+  ci_confidence(ci_confidence),
+  ci_z(ci_method != CI_NO ? tools::normal_quantile(0.5 + 0.5 * (double)ci_confidence) : 0.),
+  ci_next_fe(0),
+  ci_reached(false),
+  is_log_weights(nullptr),
   n_bit_errors(0),
   n_frame_errors(0),
-  n_analyzed_frames(0)
+  n_analyzed_frames(0),
+  is_w_fe(0.),
+  is_w2_fe(0.),
+  is_w_be(0.)
 {
 	const std::string name = "Monitor_BFER";
 	this->set_name(name);
-	
+
+	if (ci_method != CI_NO && (ci_confidence <= 0.f || ci_confidence >= 1.f))
+	{
+		std::stringstream message;
+		message << "'ci_confidence' has to be in ]0,1[ ('ci_confidence' = " << ci_confidence << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (ci_method != CI_NO && ci_precision <= 0.f)
+	{
+		std::stringstream message;
+		message << "'ci_precision' has to be greater than 0 ('ci_precision' = " << ci_precision << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	auto &p = this->create_task("check_errors", mnt::tsk::check_errors);
 	auto &ps_U = this->template create_socket_in<B>(p, "U", this->size * this->n_frames);
 	auto &ps_V = this->template create_socket_in<B>(p, "V", this->size * this->n_frames);
@@ -57,10 +88,18 @@ int Monitor_BFER<B>
 		n_bit_errors += bit_errors_count;
 		n_frame_errors++;
 
+		if (this->is_log_weights != nullptr)
+		{
+			const auto w = std::exp(this->is_log_weights[frame_id]);
+			is_w_fe  += w;
+			is_w2_fe += w * w;
+			is_w_be  += w * (double)bit_errors_count;
+		}
+
 		for (auto c : this->callbacks_fe)
 			c(bit_errors_count, frame_id);
 
-		if (this->fe_limit_achieved() && frame_id == this->n_frames -1)
+		if (!this->callbacks_fe_limit_achieved.empty() && frame_id == this->n_frames -1 && this->fe_limit_achieved())
 			for (auto c : this->callbacks_fe_limit_achieved)
 				c();
 	}
@@ -78,7 +117,65 @@ template <typename B>
 bool Monitor_BFER<B>
 ::fe_limit_achieved()
 {
-	return (get_n_fe() >= get_fe_limit()) || Monitor::interrupt;
+	return (get_n_fe() >= get_fe_limit()) || Monitor::interrupt || this->ci_achieved();
+}
+
+template <typename B>
+bool Monitor_BFER<B>
+::ci_achieved()
+{
+	if (this->ci_method == CI_NO)
+		return false;
+
+	const auto n_fe = this->get_n_fe();
+	if (n_fe < this->ci_next_fe.load(std::memory_order_relaxed))
+		return this->ci_reached.load(std::memory_order_relaxed);
+
+	const auto n_fra = this->get_n_analyzed_fra();
+	if (n_fe == 0 || n_fra == 0)
+		return false;
+
+	double lower, upper;
+	if (this->is_importance_sampling())
+	{
+		// the weighted estimator is asymptotically normal, the same interval is used whatever the method
+		const auto half = this->ci_z * std::sqrt(this->get_fer_variance());
+		lower = (double)this->get_fer() - half;
+		upper = (double)this->get_fer() + half;
+	}
+	else if (this->ci_method == CI_WILSON)
+		tools::wilson_interval(n_fe, n_fra, this->ci_z, lower, upper);
+	else
+		tools::clopper_pearson_interval(n_fe, n_fra, (double)this->ci_confidence, lower, upper);
+
+	const auto fer     = this->is_importance_sampling() ? (double)this->get_fer() : (double)n_fe / (double)n_fra;
+	const auto reached = (upper - lower) * 0.5 <= (double)this->ci_precision * fer;
+
+	this->ci_reached.store(reached, std::memory_order_relaxed);
+	this->ci_next_fe.store(n_fe + std::max(1ULL, n_fe / 64), std::memory_order_relaxed);
+
+	return reached;
+}
+
+template <typename B>
+typename Monitor_BFER<B>::ci_method_t Monitor_BFER<B>
+::get_ci_method() const
+{
+	return ci_method;
+}
+
+template <typename B>
+float Monitor_BFER<B>
+::get_ci_precision() const
+{
+	return ci_precision;
+}
+
+template <typename B>
+float Monitor_BFER<B>
+::get_ci_confidence() const
+{
+	return ci_confidence;
 }
 
 template <typename B>
@@ -113,6 +210,9 @@ template <typename B>
 float Monitor_BFER<B>
 ::get_fer() const
 {
+	if (this->is_importance_sampling() && this->get_n_analyzed_fra() != 0)
+		return (float)(this->get_is_w_fe() / (double)this->get_n_analyzed_fra());
+
 	auto t_fer = 0.f;
 	if (this->get_n_be() != 0)
 		t_fer = (float)this->get_n_fe() / (float)this->get_n_analyzed_fra();
@@ -126,6 +226,9 @@ template <typename B>
 float Monitor_BFER<B>
 ::get_ber() const
 {
+	if (this->is_importance_sampling() && this->get_n_analyzed_fra() != 0)
+		return (float)(this->get_is_w_be() / (double)this->get_n_analyzed_fra() / (double)this->get_size());
+
 	auto t_ber = 0.f;
 	if (this->get_n_be() != 0)
 		t_ber = (float)this->get_n_be() / (float)this->get_n_analyzed_fra() / (float)this->get_size();
@@ -135,6 +238,62 @@ float Monitor_BFER<B>
 	return t_ber;
 }
 
+template <typename B>
+void Monitor_BFER<B>
+::set_is_weights(const double *log_weights)
+{
+	this->is_log_weights = log_weights;
+}
+
+template <typename B>
+const double* Monitor_BFER<B>
+::get_is_weights() const
+{
+	return this->is_log_weights;
+}
+
+template <typename B>
+bool Monitor_BFER<B>
+::is_importance_sampling() const
+{
+	return this->is_log_weights != nullptr;
+}
+
+template <typename B>
+double Monitor_BFER<B>
+::get_is_w_fe() const
+{
+	return is_w_fe;
+}
+
+template <typename B>
+double Monitor_BFER<B>
+::get_is_w2_fe() const
+{
+	return is_w2_fe;
+}
+
+template <typename B>
+double Monitor_BFER<B>
+::get_is_w_be() const
+{
+	return is_w_be;
+}
+
+template <typename B>
+double Monitor_BFER<B>
+::get_fer_variance() const
+{
+	const auto n = (double)this->get_n_analyzed_fra();
+	if (n < 2.)
+		return 0.;
+
+	// the sample variance of the weighted errors indicators, divided by the number of frames
+	const auto mean = this->get_is_w_fe () / n;
+	const auto m2   = this->get_is_w2_fe() / n;
+	return std::max(0., (m2 - mean * mean) / (n - 1.));
+}
+
 template <typename B>
 void Monitor_BFER<B>
 ::add_handler_fe(std::function<void(unsigned, int)> callback)
@@ -156,6 +315,15 @@ void Monitor_BFER<B>
 	this->callbacks_fe_limit_achieved.push_back(callback);
 }
 
+template <typename B>
+void Monitor_BFER<B>
+::add_handlers(const Monitor_BFER<B> &m)
+{
+	for (auto c : m.callbacks_fe               ) this->callbacks_fe               .push_back(c);
+	for (auto c : m.callbacks_check            ) this->callbacks_check            .push_back(c);
+	for (auto c : m.callbacks_fe_limit_achieved) this->callbacks_fe_limit_achieved.push_back(c);
+}
+
 template <typename B>
 void Monitor_BFER<B>
 ::reset()
@@ -165,6 +333,31 @@ void Monitor_BFER<B>
 	this->n_bit_errors      = 0;
 	this->n_frame_errors    = 0;
 	this->n_analyzed_frames = 0;
+	this->is_w_fe           = 0.;
+	this->is_w2_fe          = 0.;
+	this->is_w_be           = 0.;
+
+	this->ci_next_fe = 0;
+	this->ci_reached = false;
+}
+
+template <typename B>
+void Monitor_BFER<B>
+::save_state(std::ostream &os) const
+{
+	os << this->n_bit_errors << " " << this->n_frame_errors << " " << this->n_analyzed_frames << " "
+	   << this->is_w_fe      << " " << this->is_w2_fe       << " " << this->is_w_be           << " ";
+}
+
+template <typename B>
+void Monitor_BFER<B>
+::load_state(std::istream &is)
+{
+	is >> this->n_bit_errors >> this->n_frame_errors >> this->n_analyzed_frames
+	   >> this->is_w_fe      >> this->is_w2_fe       >> this->is_w_be;
+
+	this->ci_next_fe = 0;
+	this->ci_reached = false;
 }
 
 template <typename B>
@@ -1,6 +1,7 @@
 #ifndef MONITOR_STD_HPP_
 #define MONITOR_STD_HPP_
 
+#include <atomic>
 #include <chrono>
 #include <vector>
 #include <functional>
@@ -14,19 +15,41 @@ namespace module
 template <typename B = int>
 class Monitor_BFER : public Monitor
 {
+public:
+	// the confidence interval of the FER used to stop the simulation before the max number of frame errors
+	enum ci_method_t { CI_NO = 0, CI_WILSON, CI_CLOPPER_PEARSON };
+
 protected:
 	const unsigned max_fe;
 
+	const ci_method_t ci_method;
+	const float       ci_precision;  // the target half-width of the interval, relatively to the FER
+	const float       ci_confidence;
+	const double      ci_z;          // the normal quantile of the confidence level (Wilson)
+	std::atomic<unsigned long long> ci_next_fe; // the interval is only computed again from this number of frame errors
+	std::atomic<bool>               ci_reached;
+
+	// importance sampling: the errors are weighted by the likelihood ratios of the frames (see Channel_AWGN_LLR_IS)
+	const double *is_log_weights; // one per frame, nullptr without importance sampling
+
+	// the counters are written by the thread of the monitor for each frame and read by the other threads (through
+	// Monitor_BFER_reduction), they are kept on their own cache lines to avoid the false sharing
+	char pad_counters_0[64];
 	unsigned long long n_bit_errors;
 	unsigned long long n_frame_errors;
 	unsigned long long n_analyzed_frames;
+	double             is_w_fe;        // sum of the weights of the wrong frames
+	double             is_w2_fe;       // sum of the squared weights of the wrong frames
+	double             is_w_be;        // sum of the weighted bit errors
+	char pad_counters_1[64];
 
 	std::vector<std::function<void(unsigned, int )>> callbacks_fe;
 	std::vector<std::function<void(          void)>> callbacks_check;
 	std::vector<std::function<void(          void)>> callbacks_fe_limit_achieved;
 
 public:
-	Monitor_BFER(const int size, const unsigned max_fe, const int n_frames = 1);
+	Monitor_BFER(const int size, const unsigned max_fe, const int n_frames = 1,
+	             const ci_method_t ci_method = CI_NO, const float ci_precision = 0.1f, const float ci_confidence = 0.95f);
 	virtual ~Monitor_BFER(){};
 
 	/*!
@@ -72,6 +95,18 @@ public:
 	virtual bool fe_limit_achieved();
 	unsigned get_fe_limit() const;
 
+	/*!
+	 * \brief Tells if the confidence interval of the FER is narrow enough (always false without confidence interval).
+	 *
+	 * The relative half-width of the interval mainly depends on the number of frame errors, so the interval is
+	 * computed again only when the number of frame errors grew by ~1.5% since the last computation.
+	 */
+	bool ci_achieved();
+
+	ci_method_t get_ci_method    () const;
+	float       get_ci_precision () const;
+	float       get_ci_confidence() const;
+
 	virtual unsigned long long get_n_analyzed_fra() const;
 	virtual unsigned long long get_n_fe          () const;
 	virtual unsigned long long get_n_be          () const;
@@ -79,11 +114,40 @@ public:
 	float get_fer() const;
 	float get_ber() const;
 
+	/*!
+	 * \brief Enables the importance sampling.
+	 *
+	 * \param log_weights: the log-likelihood ratios of the frames being checked ("n_frames" values, typically
+	 *                     Channel_AWGN_LLR_IS::get_log_weights), the FER and the BER become weighted estimates.
+	 */
+	void set_is_weights(const double *log_weights);
+	const double* get_is_weights() const;
+
+	virtual bool   is_importance_sampling() const;
+	virtual double get_is_w_fe           () const;
+	virtual double get_is_w2_fe          () const;
+	virtual double get_is_w_be           () const;
+
+	/*!
+	 * \brief The estimated variance of the FER given by "get_fer" with the importance sampling.
+	 */
+	double get_fer_variance() const;
+
 	virtual void add_handler_fe               (std::function<void(unsigned, int )> callback);
 	virtual void add_handler_check            (std::function<void(          void)> callback);
 	virtual void add_handler_fe_limit_achieved(std::function<void(          void)> callback);
 
+	/*!
+	 * \brief Registers the handlers of another monitor, to count the errors of a chain in a second monitor without
+	 *        losing the actions bound to its events (reset of the decoder, refresh of the interleaver, ...).
+	 *
+	 * \param m: the monitor to copy the handlers from.
+	 */
+	virtual void add_handlers(const Monitor_BFER<B> &m);
+
 	virtual void reset();
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
 	virtual void clear_callbacks();
 
 protected:
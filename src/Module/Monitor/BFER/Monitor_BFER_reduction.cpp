@@ -1,8 +1,10 @@
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <limits>
 #include <sstream>
 #include <fstream>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -14,11 +16,17 @@ using namespace aff3ct::module;
 template <typename B>
 Monitor_BFER_reduction<B>
 ::Monitor_BFER_reduction(const std::vector<Monitor_BFER<B>*> &monitors)
-: Monitor_BFER<B>((monitors.size() && monitors[0]) ? monitors[0]->get_size()     : 1,
-                  (monitors.size() && monitors[0]) ? monitors[0]->get_fe_limit() : 1,
-                  (monitors.size() && monitors[0]) ? monitors[0]->get_n_frames() : 1),
+: Monitor_BFER<B>((monitors.size() && monitors[0]) ? monitors[0]->get_size()          : 1,
+                  (monitors.size() && monitors[0]) ? monitors[0]->get_fe_limit()      : 1,
+                  (monitors.size() && monitors[0]) ? monitors[0]->get_n_frames()      : 1,
+                  (monitors.size() && monitors[0]) ? monitors[0]->get_ci_method()     : Monitor_BFER<B>::CI_NO,
+                  (monitors.size() && monitors[0]) ? monitors[0]->get_ci_precision()  : 0.1f,
+                  (monitors.size() && monitors[0]) ? monitors[0]->get_ci_confidence() : 0.95f),
   n_analyzed_frames_historic(0),
-  monitors(monitors)
+  monitors(monitors),
+  next_check(monitors.size()),
+  max_fra(0),
+  done(false)
 {
 	const std::string name = "Monitor_BFER_reduction";
 	this->set_name(name);
@@ -66,6 +74,12 @@ Monitor_BFER_reduction<B>
 			throw tools::logic_error(__FILE__, __LINE__, __func__, message.str());
 		}
 	}
+
+	for (auto &n : next_check)
+	{
+		n.n_fe = n.n_fra = 0;
+		n.max_fra = std::numeric_limits<unsigned long long>::max();
+	}
 }
 
 template <typename B>
@@ -74,6 +88,71 @@ Monitor_BFER_reduction<B>
 {
 }
 
+template <typename B>
+bool Monitor_BFER_reduction<B>
+::is_done(const int tid)
+{
+	if (this->is_done())
+		return true;
+
+	const auto &m = *this->monitors[tid];
+	const auto &n =  this->next_check[tid];
+
+	// the thread has simulated its share of the frames, the other threads go on
+	if (m.get_n_analyzed_fra() >= n.max_fra)
+		return true;
+
+	if (m.get_n_fe() >= n.n_fe || m.get_n_analyzed_fra() >= n.n_fra)
+		this->update_done(tid);
+
+	return this->is_done();
+}
+
+template <typename B>
+void Monitor_BFER_reduction<B>
+::update_done(const int tid)
+{
+	const auto n_fe  = this->get_n_fe();
+	const auto n_fra = this->get_n_analyzed_fra();
+
+	if (this->fe_limit_achieved() || (this->max_fra != 0 && n_fra >= this->max_fra))
+		this->done.store(true, std::memory_order_relaxed);
+
+	// each thread may see half of the remaining errors (frames) before the next aggregation, the confidence interval
+	// is computed again every ~1.5% of frame errors (see Monitor_BFER::ci_achieved)
+	const auto n_thr = (unsigned long long)this->monitors.size();
+
+	auto rem_fe = n_fe < (unsigned long long)this->get_fe_limit() ? this->get_fe_limit() - n_fe : 0ULL;
+	if (this->get_ci_method() != Monitor_BFER<B>::CI_NO)
+		rem_fe = std::min(rem_fe, n_fe / 64);
+
+	const auto &m = *this->monitors[tid];
+	auto       &n =  this->next_check[tid];
+	n.n_fe = m.get_n_fe() + std::max(1ULL, rem_fe / (2 * n_thr));
+
+	if (this->max_fra != 0)
+	{
+		const auto rem_fra = n_fra < this->max_fra ? this->max_fra - n_fra : 0ULL;
+		n.n_fra = m.get_n_analyzed_fra() + std::max(1ULL, rem_fra / (2 * n_thr));
+	}
+	else
+		n.n_fra = std::numeric_limits<unsigned long long>::max();
+}
+
+template <typename B>
+void Monitor_BFER_reduction<B>
+::set_fra_limit(const unsigned long long max_fra)
+{
+	this->max_fra = max_fra;
+
+	const auto n_thr = (unsigned long long)this->monitors.size();
+	for (unsigned long long t = 0; t < n_thr; t++)
+		if (max_fra == 0)
+			this->next_check[t].max_fra = std::numeric_limits<unsigned long long>::max();
+		else
+			this->next_check[t].max_fra = t < max_fra ? (max_fra - t + n_thr -1) / n_thr : 0;
+}
+
 template <typename B>
 unsigned long long Monitor_BFER_reduction<B>
 ::get_n_analyzed_fra() const
@@ -114,6 +193,46 @@ unsigned long long Monitor_BFER_reduction<B>
 	return cur_be;
 }
 
+template <typename B>
+bool Monitor_BFER_reduction<B>
+::is_importance_sampling() const
+{
+	return monitors[0]->is_importance_sampling();
+}
+
+template <typename B>
+double Monitor_BFER_reduction<B>
+::get_is_w_fe() const
+{
+	auto cur_w_fe = this->is_w_fe;
+	for (unsigned i = 0; i < monitors.size(); i++)
+		cur_w_fe += monitors[i]->get_is_w_fe();
+
+	return cur_w_fe;
+}
+
+template <typename B>
+double Monitor_BFER_reduction<B>
+::get_is_w2_fe() const
+{
+	auto cur_w2_fe = this->is_w2_fe;
+	for (unsigned i = 0; i < monitors.size(); i++)
+		cur_w2_fe += monitors[i]->get_is_w2_fe();
+
+	return cur_w2_fe;
+}
+
+template <typename B>
+double Monitor_BFER_reduction<B>
+::get_is_w_be() const
+{
+	auto cur_w_be = this->is_w_be;
+	for (unsigned i = 0; i < monitors.size(); i++)
+		cur_w_be += monitors[i]->get_is_w_be();
+
+	return cur_w_be;
+}
+
 template <typename B>
 void Monitor_BFER_reduction<B>
 ::reset()
@@ -122,6 +241,10 @@ void Monitor_BFER_reduction<B>
 	Monitor_BFER<B>::reset();
 	for (auto m : monitors)
 		m->reset();
+
+	for (auto &n : next_check)
+		n.n_fe = n.n_fra = 0;
+	this->done = false;
 }
 
 template <typename B>
@@ -1,6 +1,7 @@
 #ifndef MONITOR_REDUCTION_HPP_
 #define MONITOR_REDUCTION_HPP_
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -10,24 +11,81 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \class Monitor_BFER_reduction
+ *
+ * \brief Sums the counters of the Monitor_BFER of each thread.
+ *
+ * The simulation threads do not aggregate all the counters for each frame to know if the point is over: "is_done"
+ * reads a shared flag and a thread only aggregates the counters (and updates the flag) when its own monitor went
+ * through a given number of frame errors (or frames). This number is a part of the remaining errors divided by the
+ * number of threads, it decreases to 1 near the limit, so the frame errors limit is overshot by a few frames at most.
+ *
+ * With a frames limit, each thread also has its own share of the frames ("max_fra" / number of threads): when the
+ * tracked bad frames are replayed, the thread "tid" plays the frames "tid", "tid + n_threads", ... of the dump.
+ */
 template <typename B = int>
 class Monitor_BFER_reduction : public Monitor_BFER<B>
 {
 private:
+	// the next values of the counters of a thread monitor from which the thread aggregates the counters
+	struct next_check_t
+	{
+		char pad_0[64];
+		unsigned long long n_fe;
+		unsigned long long n_fra;
+		unsigned long long max_fra; // the share of the frames of the thread
+		char pad_1[64];
+	};
+
 	unsigned long long n_analyzed_frames_historic;
 	std::vector<Monitor_BFER<B>*> monitors;
 
+	std::vector<next_check_t> next_check;
+	unsigned long long        max_fra;
+	std::atomic<bool>         done;
+
 public:
 	Monitor_BFER_reduction(const std::vector<Monitor_BFER<B>*> &monitors);
 	virtual ~Monitor_BFER_reduction();
 
+	/*!
+	 * \brief Tells if the point is over (frame errors limit, confidence interval, frames limit or interruption), from
+	 *        the point of view of the simulation thread "tid".
+	 *
+	 * \param tid: the thread which owns "monitors[tid]", the only monitor read outside the aggregations.
+	 */
+	virtual bool is_done(const int tid);
+
+	/*!
+	 * \brief Reads the flag updated by the "is_done(tid)" calls (for the threads without monitor).
+	 */
+	inline bool is_done() const
+	{
+		return this->done.load(std::memory_order_relaxed) || Monitor::interrupt;
+	}
+
+	/*!
+	 * \brief Sets the max number of frames to simulate in "is_done" (0 is infinite), the thread "tid" simulates the
+	 *        frames "tid", "tid + n_threads", ... (see Source_user::set_partition).
+	 */
+	void set_fra_limit(const unsigned long long max_fra);
+
 	unsigned long long get_n_analyzed_fra_historic() const;
 	unsigned long long get_n_analyzed_fra         () const;
 	unsigned long long get_n_fe                   () const;
 	unsigned long long get_n_be                   () const;
 
+	bool   is_importance_sampling() const;
+	double get_is_w_fe           () const;
+	double get_is_w2_fe          () const;
+	double get_is_w_be           () const;
+
 	virtual void reset();
 	virtual void clear_callbacks();
+
+private:
+	void update_done(const int tid);
 };
 }
 }
@@ -15,6 +15,9 @@ struct monitor_vals
 	unsigned long long n_be;
 	unsigned long long n_fe;
 	unsigned long long n_fra;
+	double             is_w_fe;
+	double             is_w2_fe;
+	double             is_w_be;
 };
 
 void MPI_SUM_monitor_vals_func(void *in, void *inout, int *len, MPI_Datatype *datatype)
@@ -27,6 +30,10 @@ void MPI_SUM_monitor_vals_func(void *in, void *inout, int *len, MPI_Datatype *da
 		inout_cvt[i].n_be  += in_cvt[i].n_be;
 		inout_cvt[i].n_fe  += in_cvt[i].n_fe;
 		inout_cvt[i].n_fra += in_cvt[i].n_fra;
+
+		inout_cvt[i].is_w_fe  += in_cvt[i].is_w_fe;
+		inout_cvt[i].is_w2_fe += in_cvt[i].is_w2_fe;
+		inout_cvt[i].is_w_be  += in_cvt[i].is_w_be;
 	}
 }
 
@@ -44,15 +51,18 @@ Monitor_BFER_reduction_mpi<B>
 	const std::string name = "Monitor_BFER_reduction_mpi";
 	this->set_name(name);
 
-	int blen[3];
-	MPI_Aint displacements[3];
-	MPI_Datatype oldtypes[3];
+	int blen[6];
+	MPI_Aint displacements[6];
+	MPI_Datatype oldtypes[6];
 
-	blen[0] = 1; displacements[0] = offsetof(monitor_vals, n_be);  oldtypes[0] = MPI_UNSIGNED_LONG_LONG;
-	blen[1] = 1; displacements[1] = offsetof(monitor_vals, n_fe);  oldtypes[1] = MPI_UNSIGNED_LONG_LONG;
-	blen[2] = 1; displacements[2] = offsetof(monitor_vals, n_fra); oldtypes[2] = MPI_UNSIGNED_LONG_LONG;
+	blen[0] = 1; displacements[0] = offsetof(monitor_vals, n_be    ); oldtypes[0] = MPI_UNSIGNED_LONG_LONG;
+	blen[1] = 1; displacements[1] = offsetof(monitor_vals, n_fe    ); oldtypes[1] = MPI_UNSIGNED_LONG_LONG;
+	blen[2] = 1; displacements[2] = offsetof(monitor_vals, n_fra   ); oldtypes[2] = MPI_UNSIGNED_LONG_LONG;
+	blen[3] = 1; displacements[3] = offsetof(monitor_vals, is_w_fe ); oldtypes[3] = MPI_DOUBLE;
+	blen[4] = 1; displacements[4] = offsetof(monitor_vals, is_w2_fe); oldtypes[4] = MPI_DOUBLE;
+	blen[5] = 1; displacements[5] = offsetof(monitor_vals, is_w_be ); oldtypes[5] = MPI_DOUBLE;
 
-	if (auto ret = MPI_Type_create_struct(3, blen, displacements, oldtypes, &MPI_monitor_vals))
+	if (auto ret = MPI_Type_create_struct(6, blen, displacements, oldtypes, &MPI_monitor_vals))
 	{
 		std::stringstream message;
 		message << "'MPI_Type_create_struct' returned '" << ret << "' error code.";
@@ -91,22 +101,38 @@ bool Monitor_BFER_reduction_mpi<B>
 		monitor_vals mvals_recv;
 		monitor_vals mvals_send = { this->get_n_be()           - this->n_bit_errors,
 		                            this->get_n_fe()           - this->n_frame_errors,
-		                            this->get_n_analyzed_fra() - this->n_analyzed_frames };
+		                            this->get_n_analyzed_fra() - this->n_analyzed_frames,
+		                            this->get_is_w_fe()        - this->is_w_fe,
+		                            this->get_is_w2_fe()       - this->is_w2_fe,
+		                            this->get_is_w_be()        - this->is_w_be };
 
 		MPI_Allreduce(&mvals_send, &mvals_recv, 1, MPI_monitor_vals, MPI_SUM_monitor_vals, MPI_COMM_WORLD);
 
 		this->n_bit_errors      = mvals_recv.n_be  - mvals_send.n_be;
 		this->n_frame_errors    = mvals_recv.n_fe  - mvals_send.n_fe;
 		this->n_analyzed_frames = mvals_recv.n_fra - mvals_send.n_fra;
+		this->is_w_fe           = mvals_recv.is_w_fe  - mvals_send.is_w_fe;
+		this->is_w2_fe          = mvals_recv.is_w2_fe - mvals_send.is_w2_fe;
+		this->is_w_be           = mvals_recv.is_w_be  - mvals_send.is_w_be;
 
 		t_last_mpi_comm = std::chrono::steady_clock::now();
 
-		is_fe_limit_achieved = mvals_recv.n_fe >= this->get_fe_limit();
+		is_fe_limit_achieved = mvals_recv.n_fe >= this->get_fe_limit() || this->ci_achieved();
 	}
 
 	return is_fe_limit_achieved;
 }
 
+template <typename B>
+bool Monitor_BFER_reduction_mpi<B>
+::is_done(const int tid)
+{
+	if (this->fe_limit_achieved())
+		return true;
+
+	return Monitor_BFER_reduction<B>::is_done(tid);
+}
+
 template <typename B>
 void Monitor_BFER_reduction_mpi<B>
 ::reset()
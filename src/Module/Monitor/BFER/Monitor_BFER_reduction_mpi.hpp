@@ -36,6 +36,11 @@ public:
 
 	bool fe_limit_achieved();
 
+	/*!
+	 * \brief The master thread makes the MPI communications when it checks if the point is over.
+	 */
+	bool is_done(const int tid);
+
 	void reset();
 };
 }
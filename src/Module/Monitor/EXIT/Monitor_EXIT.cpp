@@ -1,23 +1,48 @@
 #include <cmath>
 #include <string>
 #include <vector>
+#include <sstream>
+#include <algorithm>
 #include <stdexcept>
 
+#include "Tools/Exception/exception.hpp"
+
 #include "Monitor_EXIT.hpp"
 
 using namespace aff3ct::module;
 
 template <typename B, typename R>
 Monitor_EXIT<B,R>
-::Monitor_EXIT(const int size, const unsigned n_trials, const int n_frames)
+::Monitor_EXIT(const int size, const unsigned n_trials, const int n_frames,
+               const mi_method_t mi_method, const int n_bins, const R llr_max)
 : Monitor(size, n_frames),
   n_trials(n_trials),
-  I_A_sum((R)0),
-  n_analyzed_frames(0)
+  mi_method(mi_method),
+  n_bins(n_bins),
+  llr_max(llr_max),
+  bin_scale((R)n_bins / ((R)2 * llr_max)),
+  I_A_sum(0.0),
+  n_analyzed_frames(0),
+  histogram(2 * (n_bins +2), 0),
+  I_E_sum(0.0)
 {
 	const std::string name = "Monitor_EXIT";
 	this->set_name(name);
 
+	if (n_bins <= 0)
+	{
+		std::stringstream message;
+		message << "'n_bins' has to be greater than 0 ('n_bins' = " << n_bins << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (!(llr_max > (R)0))
+	{
+		std::stringstream message;
+		message << "'llr_max' has to be greater than 0 ('llr_max' = " << llr_max << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	auto &p = this->create_task("check_mutual_info", mnt::tsk::check_mutual_info);
 	auto &ps_bits   = this->template create_socket_in<B>(p, "bits",   this->size * this->n_frames);
 	auto &ps_llrs_a = this->template create_socket_in<R>(p, "llrs_a", this->size * this->n_frames);
@@ -39,14 +64,43 @@ void Monitor_EXIT<B,R>
 	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
 	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
+	const auto stride = this->n_bins +2;
+
 	for (auto f = f_start; f < f_stop; f++)
 	{
 		this->_check_mutual_info_avg(bits   + f * this->size,
 		                             llrs_a + f * this->size,
 		                             f);
 
-		bits_buff  .insert(bits_buff  .end(), bits   + f * this->size, bits   + (f +1) * this->size);
-		llrs_e_buff.insert(llrs_e_buff.end(), llrs_e + f * this->size, llrs_e + (f +1) * this->size);
+		const auto bits_f   = bits   + f * this->size;
+		const auto llrs_e_f = llrs_e + f * this->size;
+
+		std::lock_guard<std::mutex> lock(this->mutex_stats);
+		if (this->mi_method == HISTOGRAM)
+		{
+			for (int j = 0; j < this->size; j++)
+			{
+				const auto l = llrs_e_f[j];
+
+				int bin;
+				if      (!(l >= -this->llr_max)) bin = 0; // also -inf and NaN
+				else if (  l >=  this->llr_max ) bin = this->n_bins +1;
+				else bin = std::min(1 + (int)((l + this->llr_max) * this->bin_scale), this->n_bins);
+
+				this->histogram[(bits_f[j] ? stride : 0) + bin]++;
+			}
+		}
+		else
+		{
+			double sum = 0.0;
+			for (int j = 0; j < this->size; j++)
+			{
+				const auto symb = bits_f[j] ? -1.0 : 1.0;
+				const auto l    = std::max(-(double)this->llr_max, std::min((double)this->llr_max, (double)llrs_e_f[j]));
+				sum += 1.0 - std::log2(1.0 + std::exp(-symb * l));
+			}
+			this->I_E_sum += sum;
+		}
 
 		n_analyzed_frames++;
 	}
@@ -59,146 +113,48 @@ template <typename B, typename R>
 void Monitor_EXIT<B,R>
 ::_check_mutual_info_avg(const B *bits, const R *llrs_a, const int frame_id)
 {
+	double sum = 0.0;
 	for (int j = 0; j < this->size; j++)
 	{
 		double symb = -2.0 * (double)bits[j] +1.0;
-		I_A_sum += (R)(1.0 - std::log2(1.0 + std::exp(-symb * (double)llrs_a[j])));
+		sum += 1.0 - std::log2(1.0 + std::exp(-symb * (double)llrs_a[j]));
 	}
+
+	std::lock_guard<std::mutex> lock(this->mutex_stats);
+	I_A_sum += sum;
 }
 
 template <typename B, typename R>
 R Monitor_EXIT<B,R>
-::_check_mutual_info_histo() const
+::_compute_I_E(const std::vector<unsigned long long> &histogram, const double I_E_sum,
+               const unsigned long long n_fra) const
 {
-	size_t size = this->bits_buff.size();
-	unsigned bit_1_count = 0;
-	for (size_t i = 0; i < size; i++)
-		bit_1_count += (unsigned)bits_buff[i];
+	if (this->mi_method == AVERAGE)
+		return n_fra ? (R)(I_E_sum / ((double)this->size * (double)n_fra)) : (R)0;
 
-	unsigned bit_0_count = (unsigned)size - bit_1_count;
-	if (bit_0_count == 0 || bit_1_count == 0)
+	const auto stride = this->n_bins +2;
+
+	unsigned long long bit_0_count = 0, bit_1_count = 0;
+	for (auto i = 0; i < stride; i++)
 	{
-		return (R)0;
+		bit_0_count += histogram[         i];
+		bit_1_count += histogram[stride + i];
 	}
-	else
-	{
-		const R inf = std::numeric_limits<R>::infinity();
-
-		bool     lots_of_bins;
-		unsigned bin_count;
-		int      bin_offset = 0;
-		R        bin_width  = (R)0;
-
-		// determine the min and max value for llrs / 0 and llrs / 1
-		R llr_0_max = -inf, llr_1_max = -inf;
-		R llr_0_min = +inf, llr_1_min = +inf;
-
-		unsigned llr_0_noninfinite_count = 0;
-		unsigned llr_1_noninfinite_count = 0;
-
-		for (unsigned i = 0; i < size; i++)
-		{
-			if (!std::isinf(llrs_e_buff[i]))
-			{
-				if ((int)bits_buff[i] == 0)
-				{
-					llr_0_noninfinite_count++;
-					llr_0_min = std::min(llrs_e_buff[i], llr_0_min);
-					llr_0_max = std::max(llrs_e_buff[i], llr_0_max);
-				}
-				else
-				{
-					llr_1_noninfinite_count++;
-					llr_1_min = std::min(llrs_e_buff[i], llr_1_min);
-					llr_1_max = std::max(llrs_e_buff[i], llr_1_max);
-				}
-			}
-		}
-		if (llr_0_noninfinite_count && llr_1_noninfinite_count && llr_0_min <= llr_1_max && llr_1_min <= llr_0_max)
-		{
-			R llr_0_mean = (R)0;
-			R llr_1_mean = (R)0;
-			for (unsigned i = 0; i < size; i++)
-			{
-				if (!std::isinf(llrs_e_buff[i]))
-				{
-					if ((int)bits_buff[i] == 0) llr_0_mean += llrs_e_buff[i];
-					else                        llr_1_mean += llrs_e_buff[i];
-				}
-			}
-			llr_0_mean /= llr_0_noninfinite_count;
-			llr_1_mean /= llr_1_noninfinite_count;
 
-			R llr_0_variance = (R)0;
-			R llr_1_variance = (R)0;
-			for (unsigned i = 0; i < size; i++)
-			{
-				if (!std::isinf(llrs_e_buff[i]))
-				{
-					if ((int)bits_buff[i] == 0) llr_0_variance += std::pow((llrs_e_buff[i] - llr_0_mean), 2);
-					else                        llr_1_variance += std::pow((llrs_e_buff[i] - llr_1_mean), 2);
-				}
-			}
-			llr_0_variance /= llr_0_noninfinite_count;
-			llr_1_variance /= llr_1_noninfinite_count;
-
-			bin_width = (R)0.5 * ((R)3.49 * (R)std::sqrt(llr_0_variance) * (R)(std::pow(llr_0_noninfinite_count, (R)-1.0 / (R)3.0)) +
-			                      (R)3.49 * (R)std::sqrt(llr_1_variance) * (R)(std::pow(llr_1_noninfinite_count, (R)-1.0 / (R)3.0)));
-			if (bin_width > (R)0)
-			{
-				bin_offset = (int)std::floor(std::min(llr_0_min, llr_1_min) / bin_width) -1;
-				auto tmp = std::max(llr_0_max, llr_1_max) / bin_width - (R)bin_offset + (R)1;
-				bin_count = (unsigned)std::ceil(tmp);
-				if ((R)bin_count == tmp)
-					bin_count++;
-			}
-			else
-			{
-				bin_offset = -1;
-				bin_count  = 3;
-			}
-			lots_of_bins = true;
-		}
-		else
-		{
-			lots_of_bins = false;
-			bin_count    = 4;
-		}
-
-		std::vector<std::vector<unsigned>> histogram(2, std::vector<unsigned>(bin_count));
-		std::vector<std::vector<R       >> pdf      (2, std::vector<R       >(bin_count));
-		for (unsigned i = 0; i < size; i++)
-		{
-			if      (llrs_e_buff[i] == -inf) histogram[(int)bits_buff[i]][0           ]++;
-			else if (llrs_e_buff[i] ==  inf) histogram[(int)bits_buff[i]][bin_count -1]++;
-			else
-			{
-				if (lots_of_bins)
-				{
-					if (bin_width > 0.0)
-						histogram[(int)bits_buff[i]][(int)(std::floor(llrs_e_buff[i] / bin_width) - bin_offset)]++;
-					else
-						histogram[(int)bits_buff[i]][1]++;
-				}
-				else
-					histogram[(int)bits_buff[i]][(int)bits_buff[i] +1]++;
-			}
-		}
-
-		for (unsigned i = 0; i < bin_count; i++)
-		{
-			pdf[0][i] = (R)histogram[0][i] / (R)bit_0_count;
-			pdf[1][i] = (R)histogram[1][i] / (R)bit_1_count;
-		}
+	if (bit_0_count == 0 || bit_1_count == 0)
+		return (R)0;
 
-		R I_E = (R)0;
-		for (auto b = 0; b < 2; b++)
-			for (unsigned bin_ix = 0; bin_ix < bin_count; bin_ix++)
-				if (pdf[b][bin_ix] > (R)0)
-					I_E += (R)0.5 * pdf[b][bin_ix] * std::log2((R)2.0 * pdf[b][bin_ix] / (pdf[0][bin_ix] + pdf[1][bin_ix]));
+	double I_E = 0.0;
+	for (auto i = 0; i < stride; i++)
+	{
+		const auto pdf_0 = (double)histogram[         i] / (double)bit_0_count;
+		const auto pdf_1 = (double)histogram[stride + i] / (double)bit_1_count;
 
-		return I_E;
+		if (pdf_0 > 0.0) I_E += 0.5 * pdf_0 * std::log2(2.0 * pdf_0 / (pdf_0 + pdf_1));
+		if (pdf_1 > 0.0) I_E += 0.5 * pdf_1 * std::log2(2.0 * pdf_1 / (pdf_0 + pdf_1));
 	}
+
+	return (R)I_E;
 }
 
 template <typename B, typename R>
@@ -208,6 +164,27 @@ unsigned Monitor_EXIT<B,R>
 	return n_trials;
 }
 
+template <typename B, typename R>
+typename Monitor_EXIT<B,R>::mi_method_t Monitor_EXIT<B,R>
+::get_mi_method() const
+{
+	return mi_method;
+}
+
+template <typename B, typename R>
+int Monitor_EXIT<B,R>
+::get_n_bins() const
+{
+	return n_bins;
+}
+
+template <typename B, typename R>
+R Monitor_EXIT<B,R>
+::get_llr_max() const
+{
+	return llr_max;
+}
+
 template <typename B, typename R>
 bool Monitor_EXIT<B,R>
 ::n_trials_achieved() const
@@ -219,14 +196,34 @@ template <typename B, typename R>
 R Monitor_EXIT<B,R>
 ::get_I_A() const
 {
-	return this->I_A_sum / (R)(this->size * this->n_analyzed_frames);
+	return (R)(this->get_I_A_sum() / ((double)this->size * (double)this->get_n_analyzed_fra()));
+}
+
+template <typename B, typename R>
+double Monitor_EXIT<B,R>
+::get_I_A_sum() const
+{
+	std::lock_guard<std::mutex> lock(this->mutex_stats);
+	return this->I_A_sum;
 }
 
 template <typename B, typename R>
 R Monitor_EXIT<B,R>
 ::get_I_E() const
 {
-	return this->_check_mutual_info_histo();
+	std::lock_guard<std::mutex> lock(this->mutex_stats);
+	return this->_compute_I_E(this->histogram, this->I_E_sum, this->n_analyzed_frames);
+}
+
+template <typename B, typename R>
+void Monitor_EXIT<B,R>
+::collect_stats(std::vector<unsigned long long> &histogram, double &I_E_sum) const
+{
+	std::lock_guard<std::mutex> lock(this->mutex_stats);
+	histogram.resize(this->histogram.size(), 0);
+	for (size_t i = 0; i < this->histogram.size(); i++)
+		histogram[i] += this->histogram[i];
+	I_E_sum += this->I_E_sum;
 }
 
 template <typename B, typename R>
@@ -249,10 +246,11 @@ void Monitor_EXIT<B,R>
 {
 	Monitor::reset();
 
+	std::lock_guard<std::mutex> lock(this->mutex_stats);
 	this->n_analyzed_frames = 0;
-	this->I_A_sum = (R)0;
-	this->bits_buff.clear();
-	this->llrs_e_buff.clear();
+	this->I_A_sum = 0.0;
+	this->I_E_sum = 0.0;
+	std::fill(this->histogram.begin(), this->histogram.end(), 0);
 }
 
 template <typename B, typename R>
@@ -1,6 +1,7 @@
 #ifndef MONITOR_EXIT_HPP_
 #define MONITOR_EXIT_HPP_
 
+#include <mutex>
 #include <chrono>
 #include <vector>
 #include <functional>
@@ -11,23 +12,53 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \class Monitor_EXIT
+ *
+ * \brief Estimates the a priori and the extrinsic mutual information of a SISO decoder.
+ *
+ * The statistics are accumulated on the fly, the memory does not depend on the number of trials:
+ * - HISTOGRAM: the extrinsic LLRs are counted in a fixed-bin histogram per bit value (plus two bins for the values
+ *   out of [-llr_max, llr_max]), the mutual information is computed from the two conditional distributions,
+ * - AVERAGE:   the running average of 1 - log2(1 + exp(-x)) where x is the extrinsic LLR signed by the bit value
+ *   (the LLRs have to be consistent, they are saturated to [-llr_max, llr_max]).
+ */
 template <typename B = int, typename R = float>
 class Monitor_EXIT : public Monitor
 {
+public:
+	enum mi_method_t { HISTOGRAM = 0, AVERAGE };
+
 protected:
-	const unsigned n_trials;
+	const unsigned    n_trials;
+	const mi_method_t mi_method;
+	const int         n_bins;
+	const R           llr_max;
+	const R           bin_scale; // the inverse of the bin width
 
-	R I_A_sum;
+	double I_A_sum;
 
 	unsigned long long n_analyzed_frames;
 
 	std::vector<std::function<void(void)>> callbacks_measure;
 
-	std::vector<B> bits_buff;
-	std::vector<R> llrs_e_buff;
+	std::vector<unsigned long long> histogram; // the bins of the bit 0 followed by the bins of the bit 1
+	double I_E_sum;
+	mutable std::mutex mutex_stats; // the statistics are read by the terminal while they are updated
 
 public:
-	Monitor_EXIT(const int size, const unsigned n_trials, const int n_frames = 1);
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param size:      the number of bits to check per frame.
+	 * \param n_trials:  the number of frames to simulate per point.
+	 * \param n_frames:  the number of frames to process in one call.
+	 * \param mi_method: the estimator of the extrinsic mutual information.
+	 * \param n_bins:    the number of bins in [-llr_max, llr_max] (HISTOGRAM only).
+	 * \param llr_max:   the range of the histogram and the saturation of the AVERAGE method.
+	 */
+	Monitor_EXIT(const int size, const unsigned n_trials, const int n_frames = 1,
+	             const mi_method_t mi_method = HISTOGRAM, const int n_bins = 2048, const R llr_max = (R)64);
 	virtual ~Monitor_EXIT(){};
 
 	/*!
@@ -81,12 +112,25 @@ public:
 
 	virtual void check_mutual_info(const B *bits, const R *llrs_a, const R *llrs_e, const int frame_id = -1);
 
-	unsigned get_n_trials() const;
+	unsigned    get_n_trials () const;
+	mi_method_t get_mi_method() const;
+	int         get_n_bins   () const;
+	R           get_llr_max  () const;
 
 	virtual bool n_trials_achieved() const;
 
-	virtual R get_I_E() const;
-	virtual R get_I_A() const;
+	virtual R      get_I_E    () const;
+	virtual R      get_I_A    () const;
+	virtual double get_I_A_sum() const;
+
+	/*!
+	 * \brief Adds the extrinsic statistics accumulated so far (to compute the mutual information of several
+	 *        monitors).
+	 *
+	 * \param histogram: the histogram to update (2 * (n_bins +2) bins).
+	 * \param I_E_sum:   the sum to update (AVERAGE method).
+	 */
+	virtual void collect_stats(std::vector<unsigned long long> &histogram, double &I_E_sum) const;
 
 	virtual unsigned long long get_n_analyzed_fra() const;
 
@@ -96,8 +140,10 @@ public:
 	virtual void clear_callbacks();
 
 protected:
-	virtual void _check_mutual_info_avg  (const B *bits, const R *llrs_a, const int frame_id);
-	virtual R _check_mutual_info_histo() const;
+	virtual void _check_mutual_info_avg(const B *bits, const R *llrs_a, const int frame_id);
+
+	R _compute_I_E(const std::vector<unsigned long long> &histogram, const double I_E_sum,
+	               const unsigned long long n_fra) const;
 };
 }
 }
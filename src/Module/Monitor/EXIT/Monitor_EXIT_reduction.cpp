@@ -0,0 +1,144 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Monitor_EXIT_reduction.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Monitor_EXIT_reduction<B,R>
+::Monitor_EXIT_reduction(const std::vector<Monitor_EXIT<B,R>*> &monitors)
+: Monitor_EXIT<B,R>((monitors.size() && monitors[0]) ? monitors[0]->get_size()      : 1,
+                    (monitors.size() && monitors[0]) ? monitors[0]->get_n_trials()  : 1,
+                    (monitors.size() && monitors[0]) ? monitors[0]->get_n_frames()  : 1,
+                    (monitors.size() && monitors[0]) ? monitors[0]->get_mi_method() : Monitor_EXIT<B,R>::HISTOGRAM,
+                    (monitors.size() && monitors[0]) ? monitors[0]->get_n_bins()    : 1,
+                    (monitors.size() && monitors[0]) ? monitors[0]->get_llr_max()   : (R)1),
+  monitors(monitors)
+{
+	const std::string name = "Monitor_EXIT_reduction";
+	this->set_name(name);
+
+	if (monitors.size() == 0)
+	{
+		std::stringstream message;
+		message << "'monitors.size()' has to be greater than 0 ('monitors.size()' = " << monitors.size() << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t m = 0; m < monitors.size(); m++)
+	{
+		if (monitors[m] == nullptr)
+		{
+			std::stringstream message;
+			message << "'monitors[m]' can't be null ('m' = " << m << ").";
+			throw tools::logic_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (monitors[0]->get_size() != monitors[m]->get_size())
+		{
+			std::stringstream message;
+			message << "'monitors[0]->get_size()' and 'monitors[m]->get_size()' have to be equal ('m' = " << m
+			        << ", 'monitors[0]->get_size()' = " << monitors[0]->get_size()
+			        << ", 'monitors[m]->get_size()' = " << monitors[m]->get_size() << ").";
+			throw tools::logic_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (monitors[0]->get_n_trials() != monitors[m]->get_n_trials())
+		{
+			std::stringstream message;
+			message << "'monitors[0]->get_n_trials()' and 'monitors[m]->get_n_trials()' have to be equal ('m' = " << m
+			        << ", 'monitors[0]->get_n_trials()' = " << monitors[0]->get_n_trials()
+			        << ", 'monitors[m]->get_n_trials()' = " << monitors[m]->get_n_trials() << ").";
+			throw tools::logic_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (monitors[0]->get_mi_method() != monitors[m]->get_mi_method() ||
+		    monitors[0]->get_n_bins   () != monitors[m]->get_n_bins   () ||
+		    monitors[0]->get_llr_max  () != monitors[m]->get_llr_max  ())
+		{
+			std::stringstream message;
+			message << "'monitors[0]' and 'monitors[m]' have to estimate the mutual information the same way ('m' = "
+			        << m << ").";
+			throw tools::logic_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+}
+
+template <typename B, typename R>
+Monitor_EXIT_reduction<B,R>
+::~Monitor_EXIT_reduction()
+{
+}
+
+template <typename B, typename R>
+R Monitor_EXIT_reduction<B,R>
+::get_I_E() const
+{
+	std::vector<unsigned long long> histogram;
+	double I_E_sum = 0.0;
+	this->collect_stats(histogram, I_E_sum);
+
+	return this->_compute_I_E(histogram, I_E_sum, this->get_n_analyzed_fra());
+}
+
+template <typename B, typename R>
+double Monitor_EXIT_reduction<B,R>
+::get_I_A_sum() const
+{
+	auto cur_I_A_sum = Monitor_EXIT<B,R>::get_I_A_sum();
+	for (unsigned i = 0; i < monitors.size(); i++)
+		cur_I_A_sum += monitors[i]->get_I_A_sum();
+
+	return cur_I_A_sum;
+}
+
+template <typename B, typename R>
+unsigned long long Monitor_EXIT_reduction<B,R>
+::get_n_analyzed_fra() const
+{
+	auto cur_fra = this->n_analyzed_frames;
+	for (unsigned i = 0; i < monitors.size(); i++)
+		cur_fra += monitors[i]->get_n_analyzed_fra();
+
+	return cur_fra;
+}
+
+template <typename B, typename R>
+void Monitor_EXIT_reduction<B,R>
+::collect_stats(std::vector<unsigned long long> &histogram, double &I_E_sum) const
+{
+	Monitor_EXIT<B,R>::collect_stats(histogram, I_E_sum);
+	for (auto m : monitors)
+		m->collect_stats(histogram, I_E_sum);
+}
+
+template <typename B, typename R>
+void Monitor_EXIT_reduction<B,R>
+::reset()
+{
+	Monitor_EXIT<B,R>::reset();
+	for (auto m : monitors)
+		m->reset();
+}
+
+template <typename B, typename R>
+void Monitor_EXIT_reduction<B,R>
+::clear_callbacks()
+{
+	Monitor_EXIT<B,R>::clear_callbacks();
+	for (auto m : monitors)
+		m->clear_callbacks();
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Monitor_EXIT_reduction<B_32,R_32>;
+template class aff3ct::module::Monitor_EXIT_reduction<B_64,R_64>;
+#else
+template class aff3ct::module::Monitor_EXIT_reduction<B,R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,42 @@
+#ifndef MONITOR_EXIT_REDUCTION_HPP_
+#define MONITOR_EXIT_REDUCTION_HPP_
+
+#include <vector>
+
+#include "Monitor_EXIT.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Monitor_EXIT_reduction
+ *
+ * \brief Gathers the statistics of the Monitor_EXIT of each thread: the a priori mutual information is averaged over
+ *        all the frames and the extrinsic mutual information is computed on the sum of the histograms (or of the
+ *        running sums).
+ */
+template <typename B = int, typename R = float>
+class Monitor_EXIT_reduction : public Monitor_EXIT<B,R>
+{
+private:
+	std::vector<Monitor_EXIT<B,R>*> monitors;
+
+public:
+	explicit Monitor_EXIT_reduction(const std::vector<Monitor_EXIT<B,R>*> &monitors);
+	virtual ~Monitor_EXIT_reduction();
+
+	R      get_I_E    () const;
+	double get_I_A_sum() const;
+
+	unsigned long long get_n_analyzed_fra() const;
+
+	void collect_stats(std::vector<unsigned long long> &histogram, double &I_E_sum) const;
+
+	virtual void reset();
+	virtual void clear_callbacks();
+};
+}
+}
+
+#endif /* MONITOR_EXIT_REDUCTION_HPP_ */
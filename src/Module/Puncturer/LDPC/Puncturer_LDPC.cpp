@@ -55,6 +55,13 @@ Puncturer_LDPC<B,Q>
 {
 }
 
+template <typename B, typename Q>
+Puncturer_LDPC<B,Q>* Puncturer_LDPC<B,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Puncturer_LDPC::deep_copy);
+}
+
 template <typename B, typename Q>
 void Puncturer_LDPC<B,Q>
 ::_puncture(const B *X_N1, B *X_N2, const int frame_id) const
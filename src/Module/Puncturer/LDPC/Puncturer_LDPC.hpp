@@ -23,6 +23,7 @@ public:
 	               const std::vector<bool> &pattern,
 	               const int n_frames = 1);
 	virtual ~Puncturer_LDPC();
+	virtual Puncturer_LDPC<B,Q>* clone() const;
 
 protected:
 	void   _puncture(const B *X_N1, B *X_N2, const int frame_id) const;
@@ -19,6 +19,13 @@ Puncturer_NO<B,Q>
 {
 }
 
+template <typename B, typename Q>
+Puncturer_NO<B,Q>* Puncturer_NO<B,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Puncturer_NO::deep_copy);
+}
+
 template <typename B, typename Q>
 void Puncturer_NO<B,Q>
 ::_puncture(const B *X_N1, B *X_N2, const int frame_id) const
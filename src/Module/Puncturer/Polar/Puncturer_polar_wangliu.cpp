@@ -44,6 +44,13 @@ Puncturer_polar_wangliu<B,Q>
 {
 }
 
+template <typename B, typename Q>
+Puncturer_polar_wangliu<B,Q>* Puncturer_polar_wangliu<B,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Puncturer_polar_wangliu::deep_copy);
+}
+
 template <typename B, typename Q>
 void Puncturer_polar_wangliu<B,Q>
 ::gen_frozen_bits(std::vector<bool> &frozen_bits)
@@ -21,6 +21,7 @@ public:
 	                        const tools::Frozenbits_generator &fb_generator,
 	                        const int n_frames = 1);
 	virtual ~Puncturer_polar_wangliu();
+	virtual Puncturer_polar_wangliu<B,Q>* clone() const;
 
 	void gen_frozen_bits(std::vector<bool> &frozen_bits);
 
@@ -127,6 +127,14 @@ public:
 		});
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Puncturer (see Module::clone).
+	 */
+	Puncturer(const Puncturer &p)
+	: Puncturer(p.K, p.N, p.N_cw, p.n_frames)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
@@ -156,6 +156,13 @@ Quantizer_fast<R,Q>
 {
 }
 
+template <typename R, typename Q>
+Quantizer_fast<R,Q>* Quantizer_fast<R,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Quantizer_fast::deep_copy);
+}
+
 template<typename R, typename Q>
 void Quantizer_fast<R,Q>
 ::_process(const R *Y_N1, Q *Y_N2, const int frame_id)
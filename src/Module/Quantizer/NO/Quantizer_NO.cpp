@@ -20,6 +20,13 @@ Quantizer_NO<R,Q>
 {
 }
 
+template <typename R, typename Q>
+Quantizer_NO<R,Q>* Quantizer_NO<R,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Quantizer_NO::deep_copy);
+}
+
 template<typename R, typename Q>
 void Quantizer_NO<R,Q>
 ::_process(const R *Y_N1, Q *Y_N2, const int frame_id)
@@ -84,6 +84,14 @@ public:
 
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Quantizer (see Module::clone).
+	 */
+	Quantizer(const Quantizer &q)
+	: Quantizer(q.N, q.n_frames)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
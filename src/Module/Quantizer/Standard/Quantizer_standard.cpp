@@ -154,6 +154,13 @@ Quantizer_standard<R,Q>
 {
 }
 
+template <typename R, typename Q>
+Quantizer_standard<R,Q>* Quantizer_standard<R,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Quantizer_standard::deep_copy);
+}
+
 template<typename R, typename Q>
 void Quantizer_standard<R,Q>
 ::_process(const R *Y_N1, Q *Y_N2, const int frame_id)
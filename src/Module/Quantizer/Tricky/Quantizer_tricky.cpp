@@ -170,6 +170,13 @@ Quantizer_tricky<R,Q>
 {
 }
 
+template <typename R, typename Q>
+Quantizer_tricky<R,Q>* Quantizer_tricky<R,Q>
+::clone() const
+{
+	return Module::clone_impl(*this, &Quantizer_tricky::deep_copy);
+}
+
 template<typename R, typename Q>
 void Quantizer_tricky<R,Q>
 ::_process(const R *Y_N1, Q *Y_N2, const int frame_id)
@@ -21,6 +21,7 @@ public:
 	Quantizer_tricky(const int N, const float min_max, const int n_frames = 1);
 	Quantizer_tricky(const int N, const float min_max, const short& saturation_pos,  const int n_frames = 1);
 	virtual ~Quantizer_tricky();
+	virtual Quantizer_tricky<R,Q>* clone() const;
 
 protected:
 	void _process(const R *Y_N1, Q *Y_N2, const int frame_id);
@@ -2,7 +2,9 @@
 #define SOCKET_HPP_
 
 #include <string>
+#include <vector>
 #include <sstream>
+#include <algorithm>
 #include <typeindex>
 
 #include "Tools/Exception/exception.hpp"
@@ -40,14 +42,21 @@ protected:
 	      bool            fast;
 	      void*           dataptr;
 
+	Socket*              bound_socket;  // the socket this one has been bound to (if any)
+	std::vector<Socket*> bound_sockets; // the sockets which have been bound to this one
+
 	Socket(Task &task, const std::string &name, const std::type_index datatype, const size_t databytes,
 	       const bool fast = false, void *dataptr = nullptr)
-	: task(task), name(name), datatype(datatype), databytes(databytes), fast(fast), dataptr(dataptr)
+	: task(task), name(name), datatype(datatype), databytes(databytes), fast(fast), dataptr(dataptr),
+	  bound_socket(nullptr)
 	{
 	}
 
 	~Socket()
 	{
+		set_bound_socket(nullptr);
+		for (auto *s : bound_sockets)
+			s->bound_socket = nullptr;
 	}
 
 public:
@@ -59,6 +68,10 @@ public:
 	inline size_t          get_n_elmts        () const { return get_databytes() / (size_t)get_datatype_size(); }
 	inline void*           get_dataptr        () const { return dataptr;                                       }
 	inline bool            is_fast            () const { return fast;                                          }
+	inline Task&           get_task           () const { return task;                                          }
+	inline Socket*         get_bound_socket   () const { return bound_socket;                                  }
+
+	inline const std::vector<Socket*>& get_bound_sockets() const { return bound_sockets; }
 
 	inline void set_fast(const bool fast) { this->fast = fast; }
 
@@ -105,6 +118,7 @@ public:
 		}
 
 		this->dataptr = s.dataptr;
+		this->set_bound_socket(&s);
 
 		if (this->task.is_autoexec() && this->task.is_last_input_socket(*this))
 			return this->task.exec();
@@ -123,6 +137,7 @@ public:
 		if (is_fast())
 		{
 			this->dataptr = static_cast<void*>(vector.data());
+			this->set_bound_socket(nullptr);
 			return 0;
 		}
 
@@ -153,6 +168,7 @@ public:
 		if (is_fast())
 		{
 			this->dataptr = static_cast<void*>(array);
+			this->set_bound_socket(nullptr);
 			return 0;
 		}
 
@@ -190,6 +206,7 @@ public:
 		}
 
 		this->dataptr = dataptr;
+		this->set_bound_socket(nullptr);
 
 		return 0;
 	}
@@ -198,6 +215,21 @@ public:
 	{
 		return bind(dataptr);
 	}
+
+private:
+	inline void set_bound_socket(Socket *s)
+	{
+		if (this->bound_socket != nullptr)
+		{
+			auto &bss = this->bound_socket->bound_sockets;
+			bss.erase(std::remove(bss.begin(), bss.end(), this), bss.end());
+		}
+
+		this->bound_socket = s;
+
+		if (this->bound_socket != nullptr)
+			this->bound_socket->bound_sockets.push_back(this);
+	}
 };
 }
 }
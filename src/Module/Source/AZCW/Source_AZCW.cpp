@@ -17,6 +17,13 @@ Source_AZCW<B>
 {
 }
 
+template <typename B>
+Source_AZCW<B>* Source_AZCW<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Source_AZCW::deep_copy);
+}
+
 template <typename B>
 void Source_AZCW<B>
 ::_generate(B *U_K, const int frame_id)
@@ -18,6 +18,7 @@ public:
 	Source_AZCW(const int K, const int n_frames = 1);
 
 	virtual ~Source_AZCW();
+	virtual Source_AZCW<B>* clone() const;
 
 protected:
 	void _generate(B *U_K, const int frame_id);
@@ -19,6 +19,20 @@ Source_random<B>
 {
 }
 
+template <typename B>
+Source_random<B>* Source_random<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Source_random::deep_copy);
+}
+
+template <typename B>
+void Source_random<B>
+::set_seed(const int seed)
+{
+	rd_engine.seed(seed);
+}
+
 template <typename B>
 void Source_random<B>
 ::_generate(B *U_K, const int frame_id)
@@ -28,6 +42,20 @@ void Source_random<B>
 		U_K[i] = (B)this->uniform_dist(this->rd_engine);
 }
 
+template <typename B>
+void Source_random<B>
+::save_state(std::ostream &os) const
+{
+	os << rd_engine << " " << uniform_dist << " ";
+}
+
+template <typename B>
+void Source_random<B>
+::load_state(std::istream &is)
+{
+	is >> rd_engine >> uniform_dist;
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
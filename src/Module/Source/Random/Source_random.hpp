@@ -25,6 +25,11 @@ public:
 	Source_random(const int K, const int seed = 0, const int n_frames = 1);
 
 	virtual ~Source_random();
+	virtual Source_random<B>* clone() const;
+
+	void set_seed(const int seed);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
 
 protected:
 	void _generate(B *U_K, const int frame_id);
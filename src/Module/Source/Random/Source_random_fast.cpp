@@ -14,11 +14,8 @@ Source_random_fast<B>
 {
 	const std::string name = "Source_random_fast";
 	this->set_name(name);
-	
-	mipp::vector<int> seeds(mipp::nElReg<int>());
-	for (auto i = 0; i < mipp::nElReg<int>(); i++)
-		seeds[i] = mt19937.rand();
-	mt19937_simd.seed(seeds.data());
+
+	this->set_seed(seed);
 }
 
 template <typename B>
@@ -27,6 +24,25 @@ Source_random_fast<B>
 {
 }
 
+template <typename B>
+Source_random_fast<B>* Source_random_fast<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Source_random_fast::deep_copy);
+}
+
+template <typename B>
+void Source_random_fast<B>
+::set_seed(const int seed)
+{
+	mt19937.seed(seed);
+
+	mipp::vector<int> seeds(mipp::nElReg<int>());
+	for (auto i = 0; i < mipp::nElReg<int>(); i++)
+		seeds[i] = mt19937.rand();
+	mt19937_simd.seed(seeds.data());
+}
+
 template <typename B>
 void Source_random_fast<B>
 ::_generate(B *U_K, const int frame_id)
@@ -67,6 +83,22 @@ void Source_random_fast<B>
 	}
 }
 
+template <typename B>
+void Source_random_fast<B>
+::save_state(std::ostream &os) const
+{
+	mt19937     .save_state(os);
+	mt19937_simd.save_state(os);
+}
+
+template <typename B>
+void Source_random_fast<B>
+::load_state(std::istream &is)
+{
+	mt19937     .load_state(is);
+	mt19937_simd.load_state(is);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
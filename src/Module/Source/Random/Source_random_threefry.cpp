@@ -0,0 +1,86 @@
+#include "Source_random_threefry.hpp"
+
+using namespace aff3ct::module;
+
+template <typename B>
+Source_random_threefry<B>
+::Source_random_threefry(const int K, const int seed, const int n_frames)
+: Source<B>(K, n_frames),
+  threefry(seed, tools::PRNG_Threefry::SOURCE),
+  counter(0),
+  words((K + 31) / 32)
+{
+	const std::string name = "Source_random_threefry";
+	this->set_name(name);
+}
+
+template <typename B>
+Source_random_threefry<B>
+::~Source_random_threefry()
+{
+}
+
+template <typename B>
+Source_random_threefry<B>* Source_random_threefry<B>
+::clone() const
+{
+	return Module::clone_impl(*this, &Source_random_threefry::deep_copy);
+}
+
+template <typename B>
+void Source_random_threefry<B>
+::set_seed(const int seed)
+{
+	threefry.seed(seed);
+	this->counter = 0;
+}
+
+template <typename B>
+void Source_random_threefry<B>
+::set_counter(const uint64_t counter)
+{
+	this->counter = counter;
+}
+
+template <typename B>
+void Source_random_threefry<B>
+::_generate(B *U_K, const int frame_id)
+{
+	threefry.set_counter(this->counter + frame_id);
+	threefry.generate(this->words.data(), this->words.size());
+
+	for (auto i = 0; i < this->K; i++)
+		U_K[i] = (B)((this->words[i >> 5] >> (i & 31)) & 1);
+
+	// without a call to "set_counter", the next call to "generate" gives the next frames
+	if (frame_id == this->n_frames -1)
+		this->counter += this->n_frames;
+}
+
+template <typename B>
+void Source_random_threefry<B>
+::save_state(std::ostream &os) const
+{
+	threefry.save_state(os);
+	os << this->counter << " ";
+}
+
+template <typename B>
+void Source_random_threefry<B>
+::load_state(std::istream &is)
+{
+	threefry.load_state(is);
+	is >> this->counter;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Source_random_threefry<B_8>;
+template class aff3ct::module::Source_random_threefry<B_16>;
+template class aff3ct::module::Source_random_threefry<B_32>;
+template class aff3ct::module::Source_random_threefry<B_64>;
+#else
+template class aff3ct::module::Source_random_threefry<B>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,45 @@
+#ifndef SOURCE_RANDOM_THREEFRY_HPP_
+#define SOURCE_RANDOM_THREEFRY_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/PRNG/PRNG_Threefry.hpp"
+
+#include "../Source.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Source_random_threefry
+ *
+ * \brief Generates random bits with the counter-based Threefry PRNG: the bits of a frame only depend on the seed and
+ *        on the global index of the frame (see "set_counter"), whatever the thread which generates it.
+ */
+template <typename B = int>
+class Source_random_threefry : public Source<B>
+{
+private:
+	tools::PRNG_Threefry  threefry;
+	uint64_t              counter; // the global index of the first frame of the next call to "generate"
+	std::vector<uint32_t> words;   // the random numbers of a frame
+
+public:
+	Source_random_threefry(const int K, const int seed = 0, const int n_frames = 1);
+	virtual ~Source_random_threefry();
+	virtual Source_random_threefry<B>* clone() const;
+
+	void set_seed(const int seed);
+	void set_counter(const uint64_t counter);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+
+protected:
+	void _generate(B *U_K, const int frame_id);
+};
+}
+}
+
+#endif /* SOURCE_RANDOM_THREEFRY_HPP_ */
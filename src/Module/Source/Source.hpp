@@ -10,6 +10,7 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
 #include <sstream>
 #include <iostream>
 
@@ -81,6 +82,14 @@ public:
 		});
 	}
 
+	/*!
+	 * \brief Copy constructor, the Tasks are rebuilt for the new Source (see Module::clone).
+	 */
+	Source(const Source &s)
+	: Source(s.K, s.n_frames)
+	{
+	}
+
 	/*!
 	 * \brief Destructor.
 	 */
@@ -93,6 +102,25 @@ public:
 		return K;
 	}
 
+	/*!
+	 * \brief Re-initializes the random generator of the Source (does nothing for the deterministic Sources).
+	 *
+	 * \param seed: the new seed.
+	 */
+	virtual void set_seed(const int seed)
+	{
+	}
+
+	/*!
+	 * \brief Sets the global index of the next generated frame, for the Sources based on a counter-based random
+	 *        generator (does nothing for the other Sources).
+	 *
+	 * \param counter: the index of the first frame of the next call to "generate".
+	 */
+	virtual void set_counter(const uint64_t counter)
+	{
+	}
+
 	/*!
 	 * \brief Fulfills a vector with bits.
 	 *
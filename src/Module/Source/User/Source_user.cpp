@@ -1,7 +1,9 @@
-#include <fstream>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
+#include "Tools/Display/Dumper/Dumper.hpp"
 
 #include "Source_user.hpp"
 
@@ -11,7 +13,7 @@ using namespace aff3ct::module;
 template <typename B>
 Source_user<B>
 ::Source_user(const int K, const std::string filename, const int n_frames)
-: Source<B>(K, n_frames), source(), src_counter(0)
+: Source<B>(K, n_frames), file(nullptr), frames(nullptr), source(nullptr), n_src(0), partition()
 {
 	const std::string name = "Source_user";
 	this->set_name(name);
@@ -19,51 +21,75 @@ Source_user<B>
 	if (filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
-	std::ifstream file(filename.c_str(), std::ios::in);
+	this->file = tools::File_mapping::open(filename);
 
-	if (file.is_open())
+	int src_size = 0;
+
+	// the bit-packed files are written by the Dumper in binary
+	const auto &magic = tools::Dumper::bits_magic;
+	const auto header_size = magic.size() + sizeof(n_src) + sizeof(src_size);
+	const auto packed = this->file->size() >= header_size &&
+	                    std::equal(magic.begin(), magic.end(), this->file->data());
+
+	if (packed)
+	{
+		const auto header = this->file->data() + magic.size();
+		std::copy(header,                 header + sizeof(n_src),                    (char*)&this->n_src);
+		std::copy(header + sizeof(n_src), header + sizeof(n_src) + sizeof(src_size), (char*)&src_size   );
+	}
+	else
 	{
-		int n_src = 0, src_size = 0;
+		std::stringstream text(std::string(this->file->data(), this->file->size()));
 
-		file >> n_src;
-		file >> src_size;
+		text >> this->n_src;
+		text >> src_size;
 
-		if (n_src <= 0 || src_size <= 0)
+		if (this->n_src > 0 && src_size == this->K)
 		{
-			std::stringstream message;
-			message << "'n_src', and 'src_size' have to be greater than 0 ('n_src' = " << n_src
-			        << ", 'src_size' = " << src_size << ").";
-			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+			auto source = std::make_shared<std::vector<B>>((size_t)this->n_src * src_size);
+			for (auto &b : *source)
+			{
+				int bit;
+				text >> bit;
+
+				b = bit != 0;
+			}
+			this->source = source;
 		}
 
-		this->source.resize(n_src);
-		for (auto i = 0; i < n_src; i++)
-			this->source[i].resize(src_size);
+		// the text is parsed once and for all
+		this->file = nullptr;
+	}
 
-		if (src_size == this->K)
-		{
-			for (auto i = 0; i < n_src; i++)
-				for (auto j = 0; j < src_size; j++)
-				{
-					int bit;
-					file >> bit;
-
-					this->source[i][j] = bit != 0;
-				}
-		}
-		else
-		{
-			file.close();
+	if (this->n_src <= 0 || src_size <= 0)
+	{
+		std::stringstream message;
+		message << "'n_src', and 'src_size' have to be greater than 0 ('n_src' = " << this->n_src
+		        << ", 'src_size' = " << src_size << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
 
+	if (src_size != this->K)
+	{
+		std::stringstream message;
+		message << "The size is wrong (read: " << src_size << ", expected: " << this->K << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (packed)
+	{
+		const auto frame_bytes = (size_t)(src_size + 7) / 8;
+		if (this->file->size() < header_size + this->n_src * frame_bytes)
+		{
 			std::stringstream message;
-			message << "The size is wrong (read: " << src_size << ", expected: " << this->K << ").";
+			message << "The file is truncated ('n_src' = " << this->n_src << ", 'src_size' = " << src_size << ").";
 			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 		}
 
-		file.close();
+		this->frames = this->file->data() + header_size;
 	}
-	else
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file.");
+
+	this->partition.set_n_fra(this->n_src);
 }
 
 template <typename B>
@@ -76,11 +102,38 @@ template <typename B>
 void Source_user<B>
 ::_generate(B *U_K, const int frame_id)
 {
-	std::copy(this->source[this->src_counter].begin(),
-	          this->source[this->src_counter].end  (),
-	          U_K);
+	const auto src_id = this->partition.next();
+
+	if (this->frames != nullptr)
+	{
+		const auto frame = this->frames + (size_t)src_id * ((this->K + 7) / 8);
+		tools::Bit_packer<B>::unpack((const B*)frame, U_K, this->K);
+	}
+	else
+		std::copy(this->source->begin() + (size_t)(src_id    ) * this->K,
+		          this->source->begin() + (size_t)(src_id + 1) * this->K,
+		          U_K);
+}
 
-	this->src_counter = (this->src_counter +1) % (int)this->source.size();
+template <typename B>
+void Source_user<B>
+::set_partition(const int part_id, const int n_parts)
+{
+	this->partition.set_partition(part_id, n_parts);
+}
+
+template <typename B>
+void Source_user<B>
+::save_state(std::ostream &os) const
+{
+	this->partition.save_state(os);
+}
+
+template <typename B>
+void Source_user<B>
+::load_state(std::istream &is)
+{
+	this->partition.load_state(is);
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -1,10 +1,13 @@
 #ifndef SOURCE_USER_HPP_
 #define SOURCE_USER_HPP_
 
+#include <memory>
 #include <string>
-#include <random>
 #include <vector>
 
+#include "Tools/Algo/Frame_partition.hpp"
+#include "Tools/Perf/File_mapping/File_mapping.hpp"
+
 #include "../Source.hpp"
 
 namespace aff3ct
@@ -15,12 +18,23 @@ template <typename B>
 class Source_user : public Source<B>
 {
 private:
-	std::vector<std::vector<B>> source;
-	int src_counter;
+	std::shared_ptr<const tools::File_mapping> file; // the bit-packed frames are unpacked from the mapped file
+	const char *frames;                              // the first bit-packed frame in the file
+	std::shared_ptr<const std::vector<B>> source;    // the frames of a text file (parsed once, shared by the clones)
+	int n_src;
+	tools::Frame_partition partition;                // the frames played by this instance
 
 public:
 	Source_user(const int K, std::string filename, const int n_frames = 1);
 	virtual ~Source_user();
+	/*!
+	 * \brief Replays only the frames "part_id", "part_id + n_parts", "part_id + 2 * n_parts", ... of the file (to
+	 *        share the frames between several instances), a part without frame can't be played (see
+	 *        tools::Frame_partition).
+	 */
+	void set_partition(const int part_id, const int n_parts);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
 
 protected:
 	void _generate(B *U_K, const int frame_id);
@@ -4,6 +4,7 @@
 
 #include "Tools/Display/bash_tools.h"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
+#include "Tools/Display/Timeline/Timeline.hpp"
 
 #include "Module.hpp"
 #include "Socket.hpp"
@@ -19,6 +20,7 @@ Task::Task(const Module &module, const std::string &name, const bool autoalloc,
   autoalloc(autoalloc),
   autoexec(autoexec),
   stats(stats),
+  perf(false),
   fast(fast),
   debug(debug),
   debug_hex(false),
@@ -31,6 +33,7 @@ Task::Task(const Module &module, const std::string &name, const bool autoalloc,
   duration_max(std::chrono::nanoseconds(0)),
   last_input_socket(nullptr)
 {
+	this->perf_total.fill(0);
 }
 
 Task::~Task()
@@ -61,7 +64,7 @@ void Task::set_autoalloc(const bool autoalloc)
 			for (auto *s : sockets)
 				if (get_socket_type(*s) == OUT)
 				{
-					out_buffers.push_back(mipp::vector<uint8_t>(s->databytes));
+					out_buffers.push_back(std::vector<uint8_t,tools::Huge_pages_allocator<uint8_t>>(s->databytes));
 					s->dataptr = out_buffers.back().data();
 				}
 		}
@@ -79,6 +82,16 @@ void Task::set_stats(const bool stats)
 
 	if (this->stats)
 		this->set_fast(false);
+	else
+		this->perf = false;
+}
+
+void Task::set_perf(const bool perf)
+{
+	this->perf = perf;
+
+	if (this->perf)
+		this->set_stats(true);
 }
 
 void Task::set_fast(const bool fast)
@@ -238,22 +251,42 @@ int Task::exec()
 		}
 
 		int exec_status;
-		if (stats)
+		const auto trace = tools::Timeline::is_enabled();
+		if (stats || trace)
 		{
+			tools::Hardware_counters::values perf_start, perf_stop;
+			if (perf)
+				tools::Hardware_counters::read(perf_start);
+
 			auto t_start = std::chrono::steady_clock::now();
 			exec_status = this->codelet();
-			auto duration = std::chrono::steady_clock::now() - t_start;
+			auto t_stop = std::chrono::steady_clock::now();
+			auto duration = t_stop - t_start;
 
-			this->duration_total += duration;
-			if (n_calls)
+			// the counters are read before the timeline is recorded, so its cost is not counted in the task
+			if (perf)
 			{
-				this->duration_min = std::min(this->duration_min, duration);
-				this->duration_max = std::max(this->duration_max, duration);
+				tools::Hardware_counters::read(perf_stop);
+				for (size_t e = 0; e < perf_total.size(); e++)
+					this->perf_total[e] += perf_stop[e] - perf_start[e];
 			}
-			else
+
+			if (trace)
+				tools::Timeline::add(*this, t_start, t_stop, (uint64_t)this->n_calls * this->module.get_n_frames());
+
+			if (stats)
 			{
-				this->duration_min = duration;
-				this->duration_max = duration;
+				this->duration_total += duration;
+				if (n_calls)
+				{
+					this->duration_min = std::min(this->duration_min, duration);
+					this->duration_max = std::max(this->duration_max, duration);
+				}
+				else
+				{
+					this->duration_min = duration;
+					this->duration_max = duration;
+				}
 			}
 		}
 		else
@@ -360,7 +393,7 @@ Socket& Task::create_socket_out(const std::string &name, const size_t n_elmts)
 	// memory allocation
 	if (is_autoalloc())
 	{
-		out_buffers.push_back(mipp::vector<uint8_t>(s.databytes));
+		out_buffers.push_back(std::vector<uint8_t,tools::Huge_pages_allocator<uint8_t>>(s.databytes));
 		s.dataptr = out_buffers.back().data();
 	}
 
@@ -425,6 +458,16 @@ const std::vector<std::chrono::nanoseconds>& Task::get_timers_max() const
 	return this->timers_max;
 }
 
+const tools::Hardware_counters::values& Task::get_perf_total() const
+{
+	return this->perf_total;
+}
+
+const std::vector<tools::Hardware_counters::values>& Task::get_timers_perf_total() const
+{
+	return this->timers_perf_total;
+}
+
 Socket_type Task::get_socket_type(const Socket &s) const
 {
 	for (size_t i = 0; i < sockets.size(); i++)
@@ -444,6 +487,27 @@ void Task::register_timer(const std::string &name)
 	this->timers_total  .push_back(std::chrono::nanoseconds(0));
 	this->timers_max    .push_back(std::chrono::nanoseconds(0));
 	this->timers_min    .push_back(std::chrono::nanoseconds(0));
+
+	tools::Hardware_counters::values perf_zero;
+	perf_zero.fill(0);
+	this->timers_perf_total.push_back(perf_zero);
+}
+
+void Task::copy_settings(const Task &t)
+{
+	// the timers registered after the creation of the Task (by the derived Modules)
+	for (auto i = this->timers_name.size(); i < t.timers_name.size(); i++)
+		this->register_timer(t.timers_name[i]);
+
+	this->set_autoalloc      (t.autoalloc      );
+	this->set_autoexec       (t.autoexec       );
+	this->set_fast           (t.fast           );
+	this->set_debug          (t.debug          );
+	this->set_stats          (t.stats          );
+	this->set_perf           (t.perf           );
+	this->set_debug_hex      (t.debug_hex      );
+	this->set_debug_limit    (t.debug_limit    );
+	this->set_debug_precision(t.debug_precision);
 }
 
 void Task::reset_stats()
@@ -452,7 +516,9 @@ void Task::reset_stats()
 	this->duration_total = std::chrono::nanoseconds(0);
 	this->duration_min   = std::chrono::nanoseconds(0);
 	this->duration_max   = std::chrono::nanoseconds(0);
+	this->perf_total.fill(0);
 
+	for (auto &x : this->timers_perf_total) x.fill(0);
 	for (auto &x : this->timers_n_calls) x =                          0;
 	for (auto &x : this->timers_total  ) x = std::chrono::nanoseconds(0);
 	for (auto &x : this->timers_min    ) x = std::chrono::nanoseconds(0);
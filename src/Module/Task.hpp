@@ -16,6 +16,8 @@
 #include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Hardware_counters/Hardware_counters.hpp"
+#include "Tools/Perf/Huge_pages/Huge_pages.hpp"
 
 namespace aff3ct
 {
@@ -42,25 +44,28 @@ protected:
 	bool autoalloc;
 	bool autoexec;
 	bool stats;
+	bool perf;
 	bool fast;
 	bool debug;
 	bool debug_hex;
 	int32_t debug_limit;
 	uint8_t debug_precision;
 	std::function<int(void)> codelet;
-	std::vector<mipp::vector<uint8_t>> out_buffers;
+	std::vector<std::vector<uint8_t,tools::Huge_pages_allocator<uint8_t>>> out_buffers;
 
 	// stats
 	uint32_t                 n_calls;
 	std::chrono::nanoseconds duration_total;
 	std::chrono::nanoseconds duration_min;
 	std::chrono::nanoseconds duration_max;
+	tools::Hardware_counters::values perf_total;
 
 	std::vector<std::string             > timers_name;
 	std::vector<uint32_t                > timers_n_calls;
 	std::vector<std::chrono::nanoseconds> timers_total;
 	std::vector<std::chrono::nanoseconds> timers_min;
 	std::vector<std::chrono::nanoseconds> timers_max;
+	std::vector<tools::Hardware_counters::values> timers_perf_total;
 
 	Socket* last_input_socket;
 	std::vector<Socket_type> socket_type;
@@ -83,6 +88,7 @@ public:
 	void set_autoalloc      (const bool     autoalloc);
 	void set_autoexec       (const bool     autoexec );
 	void set_stats          (const bool     stats    );
+	void set_perf           (const bool     perf     );
 	void set_fast           (const bool     fast     );
 	void set_debug          (const bool     debug    );
 	void set_debug_hex      (const bool     debug_hex);
@@ -92,6 +98,7 @@ public:
 	inline bool is_autoalloc        (                  ) const { return this->autoalloc;            }
 	inline bool is_autoexec         (                  ) const { return this->autoexec;             }
 	inline bool is_stats            (                  ) const { return this->stats;                }
+	inline bool is_perf             (                  ) const { return this->perf;                 }
 	inline bool is_fast             (                  ) const { return this->fast;                 }
 	inline bool is_debug            (                  ) const { return this->debug;                }
 	inline bool is_debug_hex        (                  ) const { return this->debug_hex;            }
@@ -113,6 +120,8 @@ public:
 	const std::vector<std::chrono::nanoseconds>& get_timers_total  () const;
 	const std::vector<std::chrono::nanoseconds>& get_timers_min    () const;
 	const std::vector<std::chrono::nanoseconds>& get_timers_max    () const;
+	const tools::Hardware_counters::values&              get_perf_total       () const;
+	const std::vector<tools::Hardware_counters::values>& get_timers_perf_total() const;
 
 	int exec();
 
@@ -127,7 +136,7 @@ public:
 		{
 			this->timers_n_calls[id]++;
 			this->timers_total[id] += duration;
-			if (this->n_calls)
+			if (this->timers_n_calls[id] > 1)
 			{
 				this->timers_max[id] = std::max(this->timers_max[id], duration);
 				this->timers_min[id] = std::min(this->timers_min[id], duration);
@@ -140,9 +149,21 @@ public:
 		}
 	}
 
+	inline void update_timer(const int id, const std::chrono::nanoseconds &duration,
+	                         const tools::Hardware_counters::values &perf)
+	{
+		if (this->is_perf())
+			for (size_t e = 0; e < perf.size(); e++)
+				this->timers_perf_total[id][e] += perf[e];
+
+		this->update_timer(id, duration);
+	}
+
 protected:
 	void register_timer(const std::string &key);
 
+	void copy_settings(const Task &t);
+
 	template <typename T>
 	Socket& create_socket_in(const std::string &name, const size_t n_elmts);
 
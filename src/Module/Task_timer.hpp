@@ -0,0 +1,100 @@
+/*!
+ * \file
+ * \brief Scoped timer feeding one of the sub-timers registered on a Task.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef TASK_TIMER_HPP_
+#define TASK_TIMER_HPP_
+
+#include <chrono>
+
+#include "Tools/Perf/Hardware_counters/Hardware_counters.hpp"
+
+#include "Task.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Task_timer
+ *
+ * \brief Scoped timer feeding one of the sub-timers registered on a Task.
+ *
+ * The timer starts at construction and stops at the first call to "stop" or at destruction, then the measured
+ * duration (and the hardware counters if the Task is in perf mode) is added to the sub-timer "id" of the Task. When
+ * the statistics of the Task are disabled, the clock is not read at all. The timers can be completely removed at
+ * compile time with the DISABLE_TASK_TIMERS macro.
+ */
+class Task_timer
+{
+#ifndef DISABLE_TASK_TIMERS
+private:
+	Task *task;
+	const int id;
+	bool perf;
+	std::chrono::time_point<std::chrono::steady_clock> t_start;
+	tools::Hardware_counters::values perf_start;
+
+public:
+	/*!
+	 * \brief Constructor, starts the timer.
+	 *
+	 * \param task: the Task in which the timer has been registered.
+	 * \param id:   the id of the timer in the Task.
+	 */
+	inline Task_timer(Task &task, const int id)
+	: task(task.is_stats() ? &task : nullptr), id(id), perf(false)
+	{
+		if (this->task != nullptr)
+		{
+			this->perf = this->task->is_perf() && tools::Hardware_counters::read(this->perf_start);
+			this->t_start = std::chrono::steady_clock::now();
+		}
+	}
+
+	/*!
+	 * \brief Destructor, stops the timer if it has not been done before.
+	 */
+	inline ~Task_timer()
+	{
+		this->stop();
+	}
+
+	/*!
+	 * \brief Stops the timer and updates the Task statistics (the next calls do nothing).
+	 */
+	inline void stop()
+	{
+		if (this->task != nullptr)
+		{
+			const auto duration = std::chrono::steady_clock::now() - this->t_start;
+
+			tools::Hardware_counters::values perf_stop;
+			if (this->perf && tools::Hardware_counters::read(perf_stop))
+			{
+				for (size_t e = 0; e < perf_stop.size(); e++)
+					perf_stop[e] -= this->perf_start[e];
+				this->task->update_timer(this->id, duration, perf_stop);
+			}
+			else
+				this->task->update_timer(this->id, duration);
+
+			this->task = nullptr;
+		}
+	}
+#else
+public:
+	inline Task_timer(Task &, const int) {}
+	inline void stop() {}
+#endif
+
+	Task_timer(const Task_timer&) = delete;
+	Task_timer& operator=(const Task_timer&) = delete;
+};
+}
+}
+
+#endif /* TASK_TIMER_HPP_ */
@@ -1,4 +1,5 @@
 #include <cmath>
+#include <limits>
 #include <thread>
 #include <string>
 #include <sstream>
@@ -9,7 +10,9 @@
 #include "Tools/system_functions.h"
 #include "Tools/Display/bash_tools.h"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Threads/Thread_pinning.hpp"
 #include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Display/Timeline/Timeline.hpp"
 #include "Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
 
 #ifdef ENABLE_MPI
@@ -45,7 +48,8 @@ BFER<B,R,Q>
   monitor_red(                       nullptr),
   dumper     (params_BFER.n_threads, nullptr),
   dumper_red (                       nullptr),
-  terminal   (                       nullptr)
+  terminal   (                       nullptr),
+  checkpoint (                       nullptr)
 {
 	if (params_BFER.n_threads < 1)
 	{
@@ -66,6 +70,24 @@ BFER<B,R,Q>
 		dumper_red = new tools::Dumper_reduction(dumpers);
 	}
 
+	if (!params_BFER.chkpt_path.empty())
+	{
+		if (params_BFER.err_track_revert)
+		{
+			std::stringstream message;
+			message << "The checkpoints are not compatible with the bad frames replay.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+#ifdef ENABLE_MPI
+		// each process saves its own threads
+		const auto path = params_BFER.chkpt_path + "_" + std::to_string(params_BFER.mpi_rank);
+#else
+		const auto path = params_BFER.chkpt_path;
+#endif
+		checkpoint = new tools::Checkpoint(path, params_BFER.n_threads, params_BFER.chkpt_freq);
+	}
+
 	modules["monitor"] = std::vector<module::Module*>(params_BFER.n_threads, nullptr);
 	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
 	{
@@ -99,20 +121,22 @@ BFER<B,R,Q>
 		if (dumper [tid] != nullptr) { delete dumper [tid]; dumper [tid] = nullptr; }
 	}
 
-	if (terminal != nullptr) { delete terminal; terminal = nullptr; }
+	if (terminal   != nullptr) { delete terminal;   terminal   = nullptr; }
+	if (checkpoint != nullptr) { delete checkpoint; checkpoint = nullptr; }
 }
 
 template <typename B, typename R, typename Q>
 void BFER<B,R,Q>
 ::_build_communication_chain()
 {
+	// build the communication chain of the master thread first, the other threads clone its modules when possible
+	BFER<B,R,Q>::start_thread_build_comm_chain(this, 0);
+
 	// build the communication chain in multi-threaded mode
 	std::vector<std::thread> threads(params_BFER.n_threads -1);
 	for (auto tid = 1; tid < params_BFER.n_threads; tid++)
 		threads[tid -1] = std::thread(BFER<B,R,Q>::start_thread_build_comm_chain, this, tid);
 
-	BFER<B,R,Q>::start_thread_build_comm_chain(this, 0);
-
 	// join the slave threads with the master thread
 	for (auto tid = 1; tid < params_BFER.n_threads; tid++)
 		threads[tid -1].join();
@@ -135,9 +159,63 @@ void BFER<B,R,Q>
 		}
 	}
 
+	// the states are saved by the simulation threads, a module which can't save its state (the MKL and GSL noise
+	// generators for instance) would stop the simulation at the first checkpoint
+	if (this->checkpoint != nullptr)
+	{
+		try
+		{
+			this->save_state(0);
+		}
+		catch (tools::unimplemented_error const&)
+		{
+			this->release_objects();
+
+			std::stringstream message;
+			message << "The checkpoints are not compatible with a module which can't save its state (the MKL and GSL "
+			        << "noise generators for instance).";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	// restore the state of the threads saved by a previous run, the simulation restarts from the saved SNR point
+	size_t resume_id  = 0;
+	float  resume_snr = 0.f;
+	bool   resumed    = false;
+	if (this->checkpoint != nullptr && params_BFER.chkpt_resume)
+	{
+		std::vector<std::string> states;
+		resumed = tools::Checkpoint::read(this->checkpoint->get_path(), resume_id, resume_snr, states);
+		if (resumed)
+		{
+			if ((int)states.size() != params_BFER.n_threads)
+			{
+				std::stringstream message;
+				message << "The checkpoint has been saved with a different number of threads ('states.size()' = "
+				        << states.size() << ", 'n_threads' = " << params_BFER.n_threads << ").";
+				throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+				this->load_state(tid, states[tid]);
+		}
+	}
+
 	// for each SNR to be simulated
-	for (snr = params_BFER.snr_min; snr <= params_BFER.snr_max; snr += params_BFER.snr_step)
+	size_t snr_id = 0;
+	for (snr = params_BFER.snr_min; snr <= params_BFER.snr_max; snr += params_BFER.snr_step, snr_id++)
 	{
+		if (snr_id < resume_id)
+			continue;
+
+		if (snr_id == resume_id && resumed && std::abs(snr - resume_snr) > 1e-4f)
+		{
+			std::stringstream message;
+			message << "The checkpoint does not match the simulated SNR range ('snr' = " << snr
+			        << ", 'resume_snr' = " << resume_snr << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
 		if (params_BFER.snr_type == "EB")
 		{
 			snr_b = snr;
@@ -173,6 +251,8 @@ void BFER<B,R,Q>
 			{
 				file.read((char*)&max_fra, sizeof(max_fra));
 				file.close();
+
+				this->monitor_red->set_fra_limit(max_fra);
 			}
 			else
 			{
@@ -191,10 +271,10 @@ void BFER<B,R,Q>
 		}
 
 #ifdef ENABLE_MPI
-		if (((!params_BFER.ter->disabled && snr == params_BFER.snr_min && !params_BFER.debug) ||
+		if (((!params_BFER.ter->disabled && snr_id == resume_id && !params_BFER.debug) ||
 		    (params_BFER.statistics && !params_BFER.debug)) && params_BFER.mpi_rank == 0)
 #else
-		if (((!params_BFER.ter->disabled && snr == params_BFER.snr_min && !params_BFER.debug) ||
+		if (((!params_BFER.ter->disabled && snr_id == resume_id && !params_BFER.debug) ||
 		    (params_BFER.statistics && !params_BFER.debug)))
 #endif
 			terminal->legend(std::cout);
@@ -208,6 +288,18 @@ void BFER<B,R,Q>
 #endif
 			terminal->start_temp_report(params_BFER.ter->frequency);
 
+		if (this->checkpoint != nullptr)
+			this->checkpoint->start(snr_id, snr);
+
+		// the bad frames are written during the simulation of the point
+		if (this->dumper_red != nullptr)
+		{
+			std::stringstream s_snr_b;
+			s_snr_b << std::setprecision(2) << std::fixed << snr_b;
+
+			this->dumper_red->start(params_BFER.err_track_path + "_" + s_snr_b.str());
+		}
+
 		try
 		{
 			this->_launch();
@@ -221,6 +313,9 @@ void BFER<B,R,Q>
 			this->simu_error = true;
 		}
 
+		if (this->checkpoint != nullptr)
+			this->checkpoint->stop();
+
 #ifdef ENABLE_MPI
 		if (!params_BFER.ter->disabled && terminal != nullptr && !this->simu_error && params_BFER.mpi_rank == 0)
 #else
@@ -249,16 +344,37 @@ void BFER<B,R,Q>
 			}
 		}
 
-		if (this->dumper_red != nullptr && !this->simu_error)
+		if (this->dumper_red != nullptr)
+		{
+			if (!this->simu_error)
+			{
+				std::stringstream s_snr_b;
+				s_snr_b << std::setprecision(2) << std::fixed << snr_b;
+
+				this->dumper_red->dump(params_BFER.err_track_path + "_" + s_snr_b.str());
+			}
+			this->dumper_red->clear(); // the files of a point in error are removed
+		}
+
+		if (!params_BFER.trace_path.empty())
 		{
 			std::stringstream s_snr_b;
 			s_snr_b << std::setprecision(2) << std::fixed << snr_b;
 
-			this->dumper_red->dump(params_BFER.err_track_path + "_" + s_snr_b.str());
-			this->dumper_red->clear();
+#ifdef ENABLE_MPI
+			tools::Timeline::flush(params_BFER.trace_path + "_" + s_snr_b.str() + "_" +
+			                       std::to_string(params_BFER.mpi_rank) + ".json", params_BFER.mpi_rank);
+#else
+			tools::Timeline::flush(params_BFER.trace_path + "_" + s_snr_b.str() + ".json");
+#endif
 		}
 
-		if (!module::Monitor::is_interrupt() && this->monitor_red->get_n_fe() < this->monitor_red->get_fe_limit() &&
+		// a stopped simulation resumes the current point, the next point is resumed otherwise
+		const auto is_stopped = module::Monitor::is_over();
+		if (this->checkpoint != nullptr && !this->simu_error && is_stopped)
+			this->write_checkpoint(snr_id, snr);
+
+		if (!module::Monitor::is_interrupt() && !this->monitor_red->fe_limit_achieved() &&
 		    (max_fra == 0 || this->monitor_red->get_n_fe() < max_fra))
 			module::Monitor::stop();
 
@@ -269,6 +385,9 @@ void BFER<B,R,Q>
 					for (auto &t : mm->tasks)
 						t->reset_stats();
 
+		if (this->checkpoint != nullptr && !this->simu_error && !is_stopped)
+			this->write_checkpoint(snr_id +1, snr + params_BFER.snr_step);
+
 		if (module::Monitor::is_over())
 			break;
 	}
@@ -282,6 +401,69 @@ void BFER<B,R,Q>
 {
 }
 
+template <typename B, typename R, typename Q>
+std::string BFER<B,R,Q>
+::save_state(const int tid)
+{
+	std::stringstream ss;
+	ss.precision(std::numeric_limits<double>::max_digits10);
+	this->_save_state(tid, ss);
+	return ss.str();
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::load_state(const int tid, const std::string &state)
+{
+	std::stringstream ss(state);
+	this->_load_state(tid, ss);
+
+	if (ss.fail())
+	{
+		std::stringstream message;
+		message << "The state of the thread can't be restored, the checkpoint does not match the simulation "
+		        << "('tid' = " << tid << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::_save_state(const int tid, std::ostream &os)
+{
+	// the modules are saved in the order of their names
+	for (auto &m : this->modules)
+		if (m.second[tid] != nullptr)
+			m.second[tid]->save_state(os);
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::_load_state(const int tid, std::istream &is)
+{
+	for (auto &m : this->modules)
+		if (m.second[tid] != nullptr)
+			m.second[tid]->load_state(is);
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::write_checkpoint(const size_t snr_id, const float snr)
+{
+	std::vector<std::string> states;
+	for (auto tid = 0; tid < params_BFER.n_threads; tid++)
+		states.push_back(this->save_state(tid));
+
+	try
+	{
+		this->checkpoint->write(snr_id, snr, states);
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << tools::apply_on_each_line(e.what(), &tools::format_warning) << std::endl;
+	}
+}
+
 template <typename B, typename R, typename Q>
 module::Monitor_BFER<B>* BFER<B,R,Q>
 ::build_monitor(const int tid)
@@ -302,6 +484,10 @@ void BFER<B,R,Q>
 {
 	try
 	{
+		// the modules and their buffers are first written by the thread which will use them, on its NUMA node
+		if (simu->params_BFER.pin_threads)
+			tools::Thread_pinning::pin(tid);
+
 		simu->__build_communication_chain(tid);
 
 		if (simu->params_BFER.err_track_enable)
@@ -320,6 +506,10 @@ void BFER<B,R,Q>
 		}
 		simu->mutex_exception.unlock();
 	}
+
+	// the thread 0 is the main thread, the threads it starts later (terminal, checkpoints, ...) must not inherit its core
+	if (simu->params_BFER.pin_threads)
+		tools::Thread_pinning::unpin();
 }
 
 // ==================================================================================== explicit template instantiation
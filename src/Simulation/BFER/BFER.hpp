@@ -5,7 +5,9 @@
 #include <chrono>
 #include <vector>
 
+#include "Tools/Exception/exception.hpp"
 #include "Tools/Threads/Barrier.hpp"
+#include "Tools/Checkpoint/Checkpoint.hpp"
 #include "Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
 #include "Tools/Display/Dumper/Dumper.hpp"
 #include "Tools/Display/Dumper/Dumper_reduction.hpp"
@@ -57,6 +59,9 @@ protected:
 	// terminal (for the output of the code)
 	tools::Terminal_BFER<B> *terminal;
 
+	// periodic snapshots of the simulation state (nullptr if disabled)
+	tools::Checkpoint *checkpoint;
+
 public:
 	explicit BFER(const factory::BFER::parameters& params_BFER);
 	virtual ~BFER();
@@ -68,10 +73,36 @@ protected:
 	virtual void release_objects();
 	virtual void _launch() = 0;
 
+	// the state of a thread (its PRNGs, its error counters, ...) for the checkpoints
+	std::string save_state(const int tid                          );
+	void        load_state(const int tid, const std::string &state);
+
+	virtual void _save_state(const int tid, std::ostream &os);
+	virtual void _load_state(const int tid, std::istream &is);
+
 	module::Monitor_BFER <B>* build_monitor (const int tid = 0);
 	tools ::Terminal_BFER<B>* build_terminal(                 );
 
+	// clones the module built by the thread 0, returns nullptr if it can't be cloned (the factory has to be used)
+	template <class M>
+	static M* clone_module(const std::vector<M*> &modules, const int tid)
+	{
+		if (tid == 0 || modules[0] == nullptr)
+			return nullptr;
+
+		try
+		{
+			return dynamic_cast<M*>(modules[0]->clone());
+		}
+		catch (tools::unimplemented_error const&)
+		{
+			return nullptr;
+		}
+	}
+
 private:
+	void write_checkpoint(const size_t snr_id, const float snr);
+
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
 };
 }
@@ -1,6 +1,11 @@
 #include "Tools/Exception/exception.hpp"
 
 #include "Factory/Module/Coset/Coset.hpp"
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_IS.hpp"
+#include "Module/Channel/User/Channel_user.hpp"
+#include "Module/Encoder/User/Encoder_user.hpp"
+#include "Module/Source/User/Source_user.hpp"
+#include "Tools/Interleaver/User/Interleaver_core_user.hpp"
 
 #include "BFER_ite.hpp"
 
@@ -87,7 +92,14 @@ void BFER_ite<B,R,Q>
 
 	this->monitor[tid]->add_handler_check(std::bind(&module::Codec_SISO_SIHO<B,Q>::reset, codec[tid]));
 
-	interleaver_core[tid]->init();
+	// importance sampling: the monitor weights the errors with the likelihood ratios computed by the channel
+	if (auto *c = dynamic_cast<module::Channel_AWGN_LLR_IS<R>*>(channel[tid]))
+		this->monitor[tid]->set_is_weights(c->get_log_weights().data());
+
+	if (tid > 0 && interleaver_core[0] != nullptr)
+		interleaver_core[tid]->init(*interleaver_core[0]); // share the LUTs of the thread 0 (if not uniform)
+	else
+		interleaver_core[tid]->init();
 	if (interleaver_core[tid]->is_uniform())
 		this->monitor[tid]->add_handler_check(std::bind(&tools::Interleaver_core<>::refresh,
 		                                                this->interleaver_core[tid]));
@@ -104,18 +116,35 @@ void BFER_ite<B,R,Q>
 		source[src::tsk::generate].set_autoalloc(true);
 		auto src_data = (B*)(source[src::tsk::generate][src::sck::generate::U_K].get_dataptr());
 		auto src_size = (source[src::tsk::generate][src::sck::generate::U_K].get_databytes() / sizeof(B)) / this->params_BFER_ite.src->n_frames;
-		this->dumper[tid]->register_data(src_data, (unsigned int)src_size, this->params_BFER_ite.err_track_threshold, "src", false, this->params_BFER_ite.src->n_frames, {});
+		this->dumper[tid]->register_data(src_data, (unsigned int)src_size, this->params_BFER_ite.err_track_threshold, "src", false, this->params_BFER_ite.src->n_frames, {},
+		                                 tools::Dumper::packing_t::BITS);
 
 		encoder[enc::tsk::encode].set_autoalloc(true);
 		auto enc_data = (B*)(encoder[enc::tsk::encode][enc::sck::encode::X_N].get_dataptr());
 		auto enc_size = (encoder[enc::tsk::encode][enc::sck::encode::X_N].get_databytes() / sizeof(B)) / this->params_BFER_ite.src->n_frames;
 		this->dumper[tid]->register_data(enc_data, (unsigned int)enc_size, this->params_BFER_ite.err_track_threshold, "enc", false, this->params_BFER_ite.src->n_frames,
-		                                 {(unsigned)this->params_BFER_ite.cdc->enc->K});
+		                                 {(unsigned)this->params_BFER_ite.cdc->enc->K}, tools::Dumper::packing_t::BITS);
+
+		const auto chn_packing = this->params_BFER_ite.err_track_half ? tools::Dumper::packing_t::HALF : tools::Dumper::packing_t::NONE;
+		this->dumper[tid]->register_data(channel.get_noise(), this->params_BFER_ite.err_track_threshold, "chn", true, this->params_BFER_ite.src->n_frames, {},
+		                                 chn_packing);
+
+		// a non-uniform interleaver is the same for all the frames, its table is written once
+		this->dumper[tid]->register_data(interleaver.get_lut(), this->params_BFER_ite.err_track_threshold, "itl", false, this->params_BFER_ite.src->n_frames, {},
+		                                 tools::Dumper::packing_t::NONE, !interleaver_core[tid]->is_uniform());
+	}
 
-		this->dumper[tid]->register_data(channel.get_noise(), this->params_BFER_ite.err_track_threshold, "chn", true, this->params_BFER_ite.src->n_frames, {});
+	// each thread replays its own part of the tracked bad frames (see Monitor_BFER_reduction::set_fra_limit)
+	if (this->params_BFER_ite.err_track_revert)
+	{
+		const auto n_thr = this->params_BFER_ite.n_threads;
+
+		if (auto *s = dynamic_cast<module::Source_user <B>*>(source[tid]                )) s->set_partition(tid, n_thr);
+		if (auto *e = dynamic_cast<module::Encoder_user<B>*>(codec [tid]->get_encoder())) e->set_partition(tid, n_thr);
+		if (auto *c = dynamic_cast<module::Channel_user<R>*>(channel[tid]               )) c->set_partition(tid, n_thr);
 
-		if (interleaver_core[tid]->is_uniform())
-			this->dumper[tid]->register_data(interleaver.get_lut(), this->params_BFER_ite.err_track_threshold, "itl", false, this->params_BFER_ite.src->n_frames, {});
+		if (auto *i = dynamic_cast<tools::Interleaver_core_user<>*>(interleaver_core[tid]))
+			i->set_partition(tid, n_thr);
 	}
 }
 
@@ -132,6 +161,24 @@ void BFER_ite<B,R,Q>
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_ite<B,R,Q>
+::_save_state(const int tid, std::ostream &os)
+{
+	BFER<B,R,Q>::_save_state(tid, os);
+
+	// the interleaver is not a module, its tables change from a frame to another when it is uniform
+	interleaver_core[tid]->save_state(os);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_ite<B,R,Q>
+::_load_state(const int tid, std::istream &is)
+{
+	BFER<B,R,Q>::_load_state(tid, is);
+	interleaver_core[tid]->load_state(is);
+}
+
 template <typename B, typename R, typename Q>
 void BFER_ite<B,R,Q>
 ::release_objects()
@@ -158,6 +205,12 @@ module::Source<B>* BFER_ite<B,R,Q>
 {
 	const auto seed_src = rd_engine_seed[tid]();
 
+	if (auto s = this->clone_module(this->source, tid))
+	{
+		s->set_seed(seed_src);
+		return s;
+	}
+
 	auto params_src = params_BFER_ite.src->clone();
 	params_src->seed = seed_src;
 	auto s = params_src->template build<B>();
@@ -169,6 +222,9 @@ template <typename B, typename R, typename Q>
 module::CRC<B>* BFER_ite<B,R,Q>
 ::build_crc(const int tid)
 {
+	if (auto c = this->clone_module(this->crc, tid))
+		return c;
+
 	return params_BFER_ite.crc->template build<B>();
 }
 
@@ -178,6 +234,12 @@ module::Codec_SISO_SIHO<B,Q>* BFER_ite<B,R,Q>
 {
 	const auto seed_enc = rd_engine_seed[tid]();
 
+	if (auto c = this->clone_module(this->codec, tid))
+	{
+		c->get_encoder()->set_seed(seed_enc);
+		return c;
+	}
+
 	auto params_cdc = params_BFER_ite.cdc->clone();
 	params_cdc->enc->seed = seed_enc;
 	auto crc = this->params_BFER_ite.crc->type == "NO" ? nullptr : this->crc[tid];
@@ -211,6 +273,9 @@ template <typename B, typename R, typename Q>
 module::Modem<B,R,Q>* BFER_ite<B,R,Q>
 ::build_modem(const int tid)
 {
+	if (auto m = this->clone_module(this->modem, tid))
+		return m;
+
 	return params_BFER_ite.mdm->template build<B,R,Q>();
 }
 
@@ -220,6 +285,12 @@ module::Channel<R>* BFER_ite<B,R,Q>
 {
 	const auto seed_chn = rd_engine_seed[tid]();
 
+	if (auto c = this->clone_module(this->channel, tid))
+	{
+		c->set_seed(seed_chn);
+		return c;
+	}
+
 	auto params_chn = params_BFER_ite.chn->clone();
 	params_chn->seed = seed_chn;
 	auto c = params_chn->template build<R>();
@@ -231,6 +302,9 @@ template <typename B, typename R, typename Q>
 module::Quantizer<R,Q>* BFER_ite<B,R,Q>
 ::build_quantizer(const int tid)
 {
+	if (auto q = this->clone_module(this->quantizer, tid))
+		return q;
+
 	return params_BFER_ite.qnt->template build<R,Q>();
 }
 
@@ -238,6 +312,9 @@ template <typename B, typename R, typename Q>
 module::Coset<B,Q>* BFER_ite<B,R,Q>
 ::build_coset_real(const int tid)
 {
+	if (auto c = this->clone_module(this->coset_real, tid))
+		return c;
+
 	factory::Coset::parameters cst_params;
 	cst_params.size = params_BFER_ite.cdc->N_cw;
 	cst_params.n_frames = params_BFER_ite.src->n_frames;
@@ -248,6 +325,9 @@ template <typename B, typename R, typename Q>
 module::Coset<B,B>* BFER_ite<B,R,Q>
 ::build_coset_bit(const int tid)
 {
+	if (auto c = this->clone_module(this->coset_bit, tid))
+		return c;
+
 	factory::Coset::parameters cst_params;
 	cst_params.size = params_BFER_ite.coded_monitoring ? params_BFER_ite.cdc->N_cw : params_BFER_ite.cdc->K;
 	cst_params.n_frames = params_BFER_ite.src->n_frames;
@@ -54,6 +54,8 @@ protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
 	virtual void release_objects();
+	virtual void _save_state(const int tid, std::ostream &os);
+	virtual void _load_state(const int tid, std::istream &is);
 
 	virtual module::Source          <B    >* build_source     (const int tid = 0);
 	virtual module::CRC             <B    >* build_crc        (const int tid = 0);
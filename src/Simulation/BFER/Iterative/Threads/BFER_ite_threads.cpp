@@ -5,6 +5,7 @@
 #include <thread>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Threads/Thread_pinning.hpp"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
 #include "Tools/Display/bash_tools.h"
 
@@ -18,21 +19,18 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_ite_threads<B,R,Q>
 ::BFER_ite_threads(const factory::BFER_ite::parameters &params_BFER_ite)
-: BFER_ite<B,R,Q>(params_BFER_ite)
+: BFER_ite<B,R,Q>(params_BFER_ite),
+  sequence_pre (params_BFER_ite.n_threads, nullptr),
+  sequence_post(params_BFER_ite.n_threads, nullptr)
 {
-	if (this->params_BFER_ite.err_track_revert)
-	{
-		if (this->params_BFER_ite.n_threads != 1)
-			std::clog << tools::format_warning("Multi-threading detected with error tracking revert feature! "
-			                                   "Each thread will play the same frames. Please run with one thread.")
-			          << std::endl;
-	}
 }
 
 template <typename B, typename R, typename Q>
 BFER_ite_threads<B,R,Q>
 ::~BFER_ite_threads()
 {
+	for (auto i = 0; i < (int)sequence_pre .size(); i++) if (sequence_pre [i] != nullptr) { delete sequence_pre [i]; sequence_pre [i] = nullptr; }
+	for (auto i = 0; i < (int)sequence_post.size(); i++) if (sequence_post[i] != nullptr) { delete sequence_post[i]; sequence_post[i] = nullptr; }
 }
 
 template <typename B, typename R, typename Q>
@@ -57,12 +55,26 @@ void BFER_ite_threads<B,R,Q>
 		throw std::runtime_error(this->prev_err_messages.back());
 }
 
+template <typename B, typename R, typename Q>
+void BFER_ite_threads<B,R,Q>
+::release_objects()
+{
+	const auto nthr = this->params_BFER_ite.n_threads;
+	for (auto i = 0; i < nthr; i++) if (sequence_pre [i] != nullptr) { delete sequence_pre [i]; sequence_pre [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (sequence_post[i] != nullptr) { delete sequence_post[i]; sequence_post[i] = nullptr; }
+
+	BFER_ite<B,R,Q>::release_objects();
+}
+
 template <typename B, typename R, typename Q>
 void BFER_ite_threads<B,R,Q>
 ::start_thread(BFER_ite_threads<B,R,Q> *simu, const int tid)
 {
 	try
 	{
+		if (simu->params_BFER_ite.pin_threads)
+			tools::Thread_pinning::pin(tid);
+
 		simu->sockets_binding(tid);
 		simu->simulation_loop(tid);
 	}
@@ -75,6 +87,10 @@ void BFER_ite_threads<B,R,Q>
 			simu->prev_err_messages.push_back(e.what());
 		simu->mutex_exception.unlock();
 	}
+
+	// the thread 0 is the main thread, the threads it starts later (terminal, checkpoints, ...) must not inherit its core
+	if (simu->params_BFER_ite.pin_threads)
+		tools::Thread_pinning::unpin();
 }
 
 template <typename B, typename R, typename Q>
@@ -169,6 +185,8 @@ void BFER_ite_threads<B,R,Q>
 		mdm[mdm::tsk::filter       ][mdm::sck::filter       ::Y_N1](chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg::Y_N ]);
 		qnt[qnt::tsk::process      ][qnt::sck::process      ::Y_N1](mdm[mdm::tsk::filter       ][mdm::sck::filter      ::Y_N2]);
 		mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N1](qnt[qnt::tsk::process      ][qnt::sck::process     ::Y_N2]);
+
+		itl[itl::tsk::deinterleave ][itl::sck::deinterleave ::itl ](mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
 	}
 	else
 	{
@@ -185,9 +203,16 @@ void BFER_ite_threads<B,R,Q>
 		mdm[mdm::tsk::filter    ][mdm::sck::filter    ::Y_N1](chn[chn::tsk::add_noise][chn::sck::add_noise::Y_N ]);
 		qnt[qnt::tsk::process   ][qnt::sck::process   ::Y_N1](mdm[mdm::tsk::filter   ][mdm::sck::filter   ::Y_N2]);
 		mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N1](qnt[qnt::tsk::process  ][qnt::sck::process  ::Y_N2]);
+		itl[itl::tsk::deinterleave][itl::sck::deinterleave::itl](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
 	}
 
-	itl[itl::tsk::deinterleave][itl::sck::deinterleave::itl](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
+	// compile the execution plan until the first deinterleaving (before the loop re-binds the deinterleaver)
+	auto &first = this->params_BFER_ite.src->type != "AZCW" ? src[src::tsk::generate] :
+	              this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos ? chn[chn::tsk::add_noise_wg] :
+	                                                                                         chn[chn::tsk::add_noise   ];
+
+	if (this->sequence_pre[tid] != nullptr) delete this->sequence_pre[tid];
+	this->sequence_pre[tid] = new tools::Sequence(first, itl[itl::tsk::deinterleave]);
 
 	// ----------------------------------------------------------------------------------------------------------------
 	// ---------------------------------------------------------------------------------------- turbo demodulation loop
@@ -226,7 +251,7 @@ void BFER_ite_threads<B,R,Q>
 		if (!mdm.is_demodulator())
 			mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::Y_N3](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
 		else // output socket binding (trick to avoid runtime re-binding)
-			mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::Y_N3](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
+			mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::Y_N3](mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
 
 		mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::Y_N1](qnt[qnt::tsk::process     ][qnt::sck::process     ::Y_N2]);
 		mdm[mdm::tsk::tdemodulate_wg][mdm::sck::tdemodulate_wg::H_N ](chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::H_N ]);
@@ -299,36 +324,47 @@ void BFER_ite_threads<B,R,Q>
 	{
 		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V](crc[crc::tsk::extract][crc::sck::extract::V_K2]);
 	}
+
+	// compile the execution plan after the loop (the coset output is also bound to the loop tasks, they are excluded)
+	auto &first_post = this->params_BFER_ite.coset            ? csr[cst::tsk::apply         ] :
+	                   this->params_BFER_ite.coded_monitoring ? dch[dec::tsk::decode_siho_cw] :
+	                                                            dch[dec::tsk::decode_siho   ];
+
+	if (this->sequence_post[tid] != nullptr) delete this->sequence_post[tid];
+	this->sequence_post[tid] = new tools::Sequence({&first_post},
+	                                               {&mnt[mnt::tsk::check_errors]},
+	                                               {&dcs[dec::tsk::decode_siso], &itl[itl::tsk::interleave]});
 }
 
 template <typename B, typename R, typename Q>
 void BFER_ite_threads<B,R,Q>
 ::simulation_loop(const int tid)
 {
-	auto &source          = *this->source         [tid];
 	auto &crc             = *this->crc            [tid];
 	auto &codec           = *this->codec          [tid];
-	auto &interleaver_bit = *this->interleaver_bit[tid];
 	auto &modem           = *this->modem          [tid];
-	auto &channel         = *this->channel        [tid];
-	auto &quantizer       = *this->quantizer      [tid];
 	auto &interleaver_llr = *this->interleaver_llr[tid];
 	auto &coset_real      = *this->coset_real     [tid];
-	auto &coset_bit       = *this->coset_bit      [tid];
 	auto &monitor         = *this->monitor        [tid];
+	auto &sequence_pre    = *this->sequence_pre   [tid];
+	auto &sequence_post   = *this->sequence_post  [tid];
 
-	auto &encoder      = *codec.get_encoder();
 	auto &decoder_siso = *codec.get_decoder_siso();
-	auto &decoder_siho = *codec.get_decoder_siho();
 
 	using namespace module;
 	using namespace std::chrono;
 	auto t_snr = steady_clock::now();
 
-	while ((!this->monitor_red->fe_limit_achieved()) && // while max frame error count has not been reached
+	// the turbo demodulation loop can't be deduced from the bindings, its branches are resolved once here
+	const auto is_crc    = this->params_BFER_ite.crc->type != "NO";
+	const auto is_coset  = this->params_BFER_ite.coset;
+	const auto is_demod  = modem.is_demodulator();
+	auto &tdemodulate = this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos ?
+	                    modem[mdm::tsk::tdemodulate_wg] : modem[mdm::tsk::tdemodulate];
+
+	while ((!this->monitor_red->is_done(tid)) && // while max frame error count (or frames) has not been reached
 	        (this->params_BFER_ite.stop_time == seconds(0) || 
-	        (steady_clock::now() - t_snr) < this->params_BFER_ite.stop_time) &&
-	        (this->monitor_red->get_n_analyzed_fra() < this->max_fra || this->max_fra == 0))
+	        (steady_clock::now() - t_snr) < this->params_BFER_ite.stop_time))
 	{
 		if (this->params_BFER_ite.debug)
 		{
@@ -341,42 +377,7 @@ void BFER_ite_threads<B,R,Q>
 			std::cout << "#" << std::endl;
 		}
 
-		if (this->params_BFER_ite.src->type != "AZCW")
-		{
-			source[src::tsk::generate].exec();
-			if (this->params_BFER_ite.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_ite.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-
-			interleaver_bit[itl::tsk::interleave].exec();
-			modem          [mdm::tsk::modulate  ].exec();
-		}
-
-		if (this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos)
-		{
-			if (this->params_BFER_ite.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem [mdm::tsk::filter].exec();
-			if (this->params_BFER_ite.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-		}
-		else
-		{
-			if (this->params_BFER_ite.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (this->params_BFER_ite.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-		}
-
-		interleaver_llr[itl::tsk::deinterleave].exec();
+		sequence_pre.exec();
 
 		// ------------------------------------------------------------------------------------------------------------
 		// ------------------------------------------------------------------------------------ turbo demodulation loop
@@ -384,7 +385,7 @@ void BFER_ite_threads<B,R,Q>
 		for (auto ite = 1; ite <= this->params_BFER_ite.n_ite; ite++)
 		{
 			// ------------------------------------------------------------------------------------------- CRC checking
-			if (this->params_BFER_ite.crc->type != "NO" && ite >= this->params_BFER_ite.crc_start)
+			if (is_crc && ite >= this->params_BFER_ite.crc_start)
 			{
 				codec[cdc::tsk::extract_sys_bit].exec();
 				if (crc[crc::tsk::check].exec())
@@ -392,7 +393,7 @@ void BFER_ite_threads<B,R,Q>
 			}
 
 			// ----------------------------------------------------------------------------------------------- decoding
-			if (this->params_BFER_ite.coset)
+			if (is_coset)
 			{
 				coset_real  [cst::tsk::apply      ].exec();
 				decoder_siso[dec::tsk::decode_siso].exec();
@@ -407,56 +408,22 @@ void BFER_ite_threads<B,R,Q>
 			interleaver_llr[itl::tsk::interleave].exec();
 
 			// ------------------------------------------------------------------------------------------- demodulation
-			if (this->params_BFER_ite.chn->type.find("RAYLEIGH") != std::string::npos)
-			{
-				if (modem.is_demodulator())
-					modem[mdm::tsk::tdemodulate_wg].exec();
-			}
-			else
-			{
-				if (modem.is_demodulator())
-					modem[mdm::tsk::tdemodulate].exec();
-			}
+			if (is_demod)
+				tdemodulate.exec();
 
 			// ----------------------------------------------------------------------------------------- deinterleaving
 			interleaver_llr[itl::tsk::deinterleave].exec();
 		}
 
-		if (this->params_BFER_ite.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
-
-			if (this->params_BFER_ite.coded_monitoring)
-			{
-				decoder_siho[dec::tsk::decode_siho_cw].exec();
-				coset_bit   [cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder_siho[dec::tsk::decode_siho].exec();
-				coset_bit   [cst::tsk::apply      ].exec();
-
-				if (this->params_BFER_ite.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
-		else
-		{
-			if (this->params_BFER_ite.coded_monitoring)
-			{
-				decoder_siho[dec::tsk::decode_siho_cw].exec();
-			}
-			else
-			{
-				decoder_siho[dec::tsk::decode_siho].exec();
-
-				if (this->params_BFER_ite.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
+		sequence_post.exec();
 
-		monitor[mnt::tsk::check_errors].exec();
+		// the state of the thread is consistent between two frames
+		if (this->checkpoint != nullptr && this->checkpoint->is_requested(tid))
+			this->checkpoint->submit(tid, this->save_state(tid));
 	}
+
+	if (this->checkpoint != nullptr)
+		this->checkpoint->leave(tid);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -1,6 +1,8 @@
 #ifndef SIMULATION_BFER_ITE_THREADS_HPP_
 #define SIMULATION_BFER_ITE_THREADS_HPP_
 
+#include "Tools/Sequence/Sequence.hpp"
+
 #include "../BFER_ite.hpp"
 
 namespace aff3ct
@@ -10,12 +12,18 @@ namespace simulation
 template <typename B = int, typename R = float, typename Q = R>
 class BFER_ite_threads : public BFER_ite<B,R,Q>
 {
+protected:
+	// the execution plans before and after the turbo demodulation loop (one per thread)
+	std::vector<tools::Sequence*> sequence_pre;
+	std::vector<tools::Sequence*> sequence_post;
+
 public:
 	explicit BFER_ite_threads(const factory::BFER_ite::parameters &params_BFER_ite);
 	virtual ~BFER_ite_threads();
 
 protected:
 	virtual void _launch();
+	virtual void release_objects();
 
 private:
 	void sockets_binding(const int tid = 0);
@@ -1,6 +1,11 @@
 #include "Tools/Exception/exception.hpp"
 
 #include "Factory/Module/Coset/Coset.hpp"
+#include "Module/Channel/AWGN/Channel_AWGN_LLR_IS.hpp"
+#include "Module/Channel/User/Channel_user.hpp"
+#include "Module/Encoder/User/Encoder_user.hpp"
+#include "Module/Source/User/Source_user.hpp"
+#include "Tools/Interleaver/User/Interleaver_core_user.hpp"
 
 #include "BFER_std.hpp"
 
@@ -21,6 +26,7 @@ BFER_std<B,R,Q>
   quantizer (params_BFER_std.n_threads, nullptr),
   coset_real(params_BFER_std.n_threads, nullptr),
   coset_bit (params_BFER_std.n_threads, nullptr),
+  fused     (params_BFER_std.n_threads, nullptr),
 
   rd_engine_seed(params_BFER_std.n_threads)
 {
@@ -37,6 +43,8 @@ BFER_std<B,R,Q>
 	this->modules["coset_real"] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
 	this->modules["decoder"   ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
 	this->modules["coset_bit" ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
+	if (params_BFER_std.fused)
+		this->modules["fused"] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
 }
 
 template <typename B, typename R, typename Q>
@@ -49,15 +57,18 @@ template <typename B, typename R, typename Q>
 void BFER_std<B,R,Q>
 ::__build_communication_chain(const int tid)
 {
-	// build the objects
-	source     [tid] = build_source    (tid);
-	crc        [tid] = build_crc       (tid);
-	codec      [tid] = build_codec     (tid);
-	modem      [tid] = build_modem     (tid);
-	channel    [tid] = build_channel   (tid);
-	quantizer  [tid] = build_quantizer (tid);
-	coset_real [tid] = build_coset_real(tid);
-	coset_bit  [tid] = build_coset_bit (tid);
+	// build the objects (a chain fed by the frames of another one has no source, modem, channel nor quantizer)
+	const auto gen = this->has_generation(tid);
+	source     [tid] = gen ? build_source    (tid) : nullptr;
+	crc        [tid] =       build_crc       (tid);
+	codec      [tid] =       build_codec     (tid);
+	modem      [tid] = gen ? build_modem     (tid) : nullptr;
+	channel    [tid] = gen ? build_channel   (tid) : nullptr;
+	quantizer  [tid] = gen ? build_quantizer (tid) : nullptr;
+	coset_real [tid] =       build_coset_real(tid);
+	coset_bit  [tid] =       build_coset_bit (tid);
+	if (this->params_BFER_std.fused && gen)
+		fused  [tid] =       build_fused     (tid);
 
 	this->modules["source"    ][tid] = source    [tid];
 	this->modules["crc"       ][tid] = crc       [tid];
@@ -69,18 +80,30 @@ void BFER_std<B,R,Q>
 	this->modules["coset_real"][tid] = coset_real[tid];
 	this->modules["decoder"   ][tid] = codec     [tid]->get_decoder_siho();
 	this->modules["coset_bit" ][tid] = coset_bit [tid];
+	if (this->params_BFER_std.fused)
+		this->modules["fused"][tid] = fused[tid];
 
 	this->monitor[tid]->add_handler_check(std::bind(&module::Codec_SIHO<B,Q>::reset, codec[tid]));
 
+	// importance sampling: the monitor weights the errors with the likelihood ratios computed by the channel
+	if (auto *c = dynamic_cast<module::Channel_AWGN_LLR_IS<R>*>(channel[tid]))
+		this->monitor[tid]->set_is_weights(c->get_log_weights().data());
+
 	try
 	{
 		auto *interleaver = codec[tid]->get_interleaver(); // can raise an exceptions
-		interleaver->init();
-		if (interleaver->is_uniform())
+		if (tid > 0 && codec[0] != nullptr)
+			interleaver->init(*codec[0]->get_interleaver()); // share the LUTs of the thread 0 (if not uniform)
+		else
+			interleaver->init();
+		// with the counter-based PRNGs, the tables are regenerated for each frame index (see "set_counter")
+		if (interleaver->is_uniform() && !this->params_BFER_std.cbrng)
 			this->monitor[tid]->add_handler_check(std::bind(&tools::Interleaver_core<>::refresh, interleaver));
 
-		if (this->params_BFER_std.err_track_enable && interleaver->is_uniform())
-			this->dumper[tid]->register_data(interleaver->get_lut(), this->params_BFER_std.err_track_threshold, "itl", false, this->params_BFER_std.src->n_frames, {});
+		// a non-uniform interleaver is the same for all the frames, its table is written once
+		if (this->params_BFER_std.err_track_enable)
+			this->dumper[tid]->register_data(interleaver->get_lut(), this->params_BFER_std.err_track_threshold, "itl", false, this->params_BFER_std.src->n_frames, {},
+			                                 tools::Dumper::packing_t::NONE, !interleaver->is_uniform());
 	}
 	catch (const std::exception&) { /* do nothing if there is no interleaver */ }
 
@@ -95,29 +118,107 @@ void BFER_std<B,R,Q>
 		source[src::tsk::generate].set_autoalloc(true);
 		auto src_data = (B*)(source[src::tsk::generate][src::sck::generate::U_K].get_dataptr());
 		auto src_size = (source[src::tsk::generate][src::sck::generate::U_K].get_databytes() / sizeof(B)) / this->params_BFER_std.src->n_frames;
-		this->dumper[tid]->register_data(src_data, (unsigned int)src_size, this->params_BFER_std.err_track_threshold, "src", false, this->params_BFER_std.src->n_frames, {});
+		this->dumper[tid]->register_data(src_data, (unsigned int)src_size, this->params_BFER_std.err_track_threshold, "src", false, this->params_BFER_std.src->n_frames, {},
+		                                 tools::Dumper::packing_t::BITS);
 
 		encoder[enc::tsk::encode].set_autoalloc(true);
 		auto enc_data = (B*)(encoder[enc::tsk::encode][enc::sck::encode::X_N].get_dataptr());
 		auto enc_size = (encoder[enc::tsk::encode][enc::sck::encode::X_N].get_databytes() / sizeof(B)) / this->params_BFER_std.src->n_frames;
 		this->dumper[tid]->register_data(enc_data, (unsigned int)enc_size, this->params_BFER_std.err_track_threshold, "enc", false, this->params_BFER_std.src->n_frames,
-		                                 {(unsigned)this->params_BFER_std.cdc->enc->K});
+		                                 {(unsigned)this->params_BFER_std.cdc->enc->K}, tools::Dumper::packing_t::BITS);
 
-		this->dumper[tid]->register_data(channel.get_noise(), this->params_BFER_std.err_track_threshold, "chn", true, this->params_BFER_std.src->n_frames, {});
+		const auto chn_packing = this->params_BFER_std.err_track_half ? tools::Dumper::packing_t::HALF : tools::Dumper::packing_t::NONE;
+		this->dumper[tid]->register_data(channel.get_noise(), this->params_BFER_std.err_track_threshold, "chn", true, this->params_BFER_std.src->n_frames, {},
+		                                 chn_packing);
+	}
+
+	// each thread replays its own part of the tracked bad frames (see Monitor_BFER_reduction::set_fra_limit)
+	if (this->params_BFER_std.err_track_revert)
+	{
+		const auto n_thr = this->params_BFER_std.n_threads;
+
+		if (auto *s = dynamic_cast<module::Source_user <B>*>(source[tid]                )) s->set_partition(tid, n_thr);
+		if (auto *e = dynamic_cast<module::Encoder_user<B>*>(codec [tid]->get_encoder())) e->set_partition(tid, n_thr);
+		if (auto *c = dynamic_cast<module::Channel_user<R>*>(channel[tid]               )) c->set_partition(tid, n_thr);
+
+		try
+		{
+			auto *interleaver = codec[tid]->get_interleaver(); // can raise an exceptions
+			if (auto *i = dynamic_cast<tools::Interleaver_core_user<>*>(interleaver))
+				i->set_partition(tid, n_thr);
+		}
+		catch (const std::exception&) { /* do nothing if there is no interleaver */ }
 	}
 }
 
+template <typename B, typename R, typename Q>
+bool BFER_std<B,R,Q>
+::has_generation(const int tid) const
+{
+	return true;
+}
+
 template <typename B, typename R, typename Q>
 void BFER_std<B,R,Q>
 ::_launch()
 {
 	// set current sigma
 	for (auto tid = 0; tid < this->params_BFER_std.n_threads; tid++)
+		this->set_sigma(this->sigma, tid);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std<B,R,Q>
+::set_sigma(const float sigma, const int tid)
+{
+	if (this->channel[tid] != nullptr)
+		this->channel[tid]->set_sigma(                                                          sigma);
+	if (this->modem[tid] != nullptr)
+		this->modem  [tid]->set_sigma(this->params_BFER_std.mdm->complex ? sigma * std::sqrt(2.f) : sigma);
+	this->codec  [tid]->set_sigma(                                                          sigma);
+	if (this->fused[tid] != nullptr)
+		this->fused[tid]->set_sigma((R)sigma);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std<B,R,Q>
+::set_counter(const uint64_t counter, const int tid)
+{
+	this->source [tid]->set_counter(counter);
+	this->channel[tid]->set_counter(counter);
+
+	try
 	{
-		this->channel[tid]->set_sigma(                                                                    this->sigma);
-		this->modem  [tid]->set_sigma(this->params_BFER_std.mdm->complex ? this->sigma * std::sqrt(2.f) : this->sigma);
-		this->codec  [tid]->set_sigma(                                                                    this->sigma);
+		this->codec[tid]->get_interleaver()->set_counter(counter); // can raise an exceptions
 	}
+	catch (const std::exception&) { /* do nothing if there is no interleaver */ }
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std<B,R,Q>
+::_save_state(const int tid, std::ostream &os)
+{
+	BFER<B,R,Q>::_save_state(tid, os);
+
+	// the interleaver is not a module, its tables change from a frame to another when it is uniform
+	try
+	{
+		codec[tid]->get_interleaver()->save_state(os); // can raise an exceptions
+	}
+	catch (const std::exception&) { /* do nothing if there is no interleaver */ }
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std<B,R,Q>
+::_load_state(const int tid, std::istream &is)
+{
+	BFER<B,R,Q>::_load_state(tid, is);
+
+	try
+	{
+		codec[tid]->get_interleaver()->load_state(is); // can raise an exceptions
+	}
+	catch (const std::exception&) { /* do nothing if there is no interleaver */ }
 }
 
 template <typename B, typename R, typename Q>
@@ -133,6 +234,7 @@ void BFER_std<B,R,Q>
 	for (auto i = 0; i < nthr; i++) if (quantizer [i] != nullptr) { delete quantizer [i]; quantizer [i] = nullptr; }
 	for (auto i = 0; i < nthr; i++) if (coset_real[i] != nullptr) { delete coset_real[i]; coset_real[i] = nullptr; }
 	for (auto i = 0; i < nthr; i++) if (coset_bit [i] != nullptr) { delete coset_bit [i]; coset_bit [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (fused     [i] != nullptr) { delete fused     [i]; fused     [i] = nullptr; }
 
 	BFER<B,R,Q>::release_objects();
 }
@@ -141,7 +243,14 @@ template <typename B, typename R, typename Q>
 module::Source<B>* BFER_std<B,R,Q>
 ::build_source(const int tid)
 {
-	const auto seed_src = rd_engine_seed[tid]();
+	// with the counter-based PRNGs, all the threads share the same seed (the frames are told apart by their index)
+	const auto seed_src = params_BFER_std.cbrng ? params_BFER_std.local_seed : (int)rd_engine_seed[tid]();
+
+	if (auto s = this->clone_module(this->source, tid))
+	{
+		s->set_seed(seed_src);
+		return s;
+	}
 
 	auto params_src = params_BFER_std.src->clone();
 	params_src->seed = seed_src;
@@ -154,6 +263,9 @@ template <typename B, typename R, typename Q>
 module::CRC<B>* BFER_std<B,R,Q>
 ::build_crc(const int tid)
 {
+	if (auto c = this->clone_module(this->crc, tid))
+		return c;
+
 	return params_BFER_std.crc->template build<B>();
 }
 
@@ -163,6 +275,12 @@ module::Codec_SIHO<B,Q>* BFER_std<B,R,Q>
 {
 	const auto seed_enc = rd_engine_seed[tid]();
 
+	if (auto c = this->clone_module(this->codec, tid))
+	{
+		c->get_encoder()->set_seed(seed_enc);
+		return c;
+	}
+
 	auto params_cdc = params_BFER_std.cdc->clone();
 	params_cdc->enc->seed = seed_enc;
 
@@ -178,7 +296,7 @@ module::Codec_SIHO<B,Q>* BFER_std<B,R,Q>
 		}
 		else if (params_cdc->itl->core->uniform)
 		{
-			const auto seed_itl = rd_engine_seed[tid]();
+			const auto seed_itl = params_BFER_std.cbrng ? params_BFER_std.local_seed : (int)rd_engine_seed[tid]();
 			params_cdc->itl->core->seed = seed_itl;
 		}
 	}
@@ -193,6 +311,9 @@ template <typename B, typename R, typename Q>
 module::Modem<B,R,R>* BFER_std<B,R,Q>
 ::build_modem(const int tid)
 {
+	if (auto m = this->clone_module(this->modem, tid))
+		return m;
+
 	return params_BFER_std.mdm->template build<B,R,R>();
 }
 
@@ -200,7 +321,13 @@ template <typename B, typename R, typename Q>
 module::Channel<R>* BFER_std<B,R,Q>
 ::build_channel(const int tid)
 {
-	const auto seed_chn = rd_engine_seed[tid]();
+	const auto seed_chn = params_BFER_std.cbrng ? params_BFER_std.local_seed : (int)rd_engine_seed[tid]();
+
+	if (auto c = this->clone_module(this->channel, tid))
+	{
+		c->set_seed(seed_chn);
+		return c;
+	}
 
 	auto params_chn = this->params_BFER_std.chn->clone();
 	params_chn->seed = seed_chn;
@@ -213,6 +340,9 @@ template <typename B, typename R, typename Q>
 module::Quantizer<R,Q>* BFER_std<B,R,Q>
 ::build_quantizer(const int tid)
 {
+	if (auto q = this->clone_module(this->quantizer, tid))
+		return q;
+
 	return params_BFER_std.qnt->template build<R,Q>();
 }
 
@@ -220,6 +350,9 @@ template <typename B, typename R, typename Q>
 module::Coset<B,Q>* BFER_std<B,R,Q>
 ::build_coset_real(const int tid)
 {
+	if (auto c = this->clone_module(this->coset_real, tid))
+		return c;
+
 	factory::Coset::parameters cst_params;
 	cst_params.size = params_BFER_std.cdc->N_cw;
 	cst_params.n_frames = params_BFER_std.src->n_frames;
@@ -230,12 +363,36 @@ template <typename B, typename R, typename Q>
 module::Coset<B,B>* BFER_std<B,R,Q>
 ::build_coset_bit(const int tid)
 {
+	if (auto c = this->clone_module(this->coset_bit, tid))
+		return c;
+
 	factory::Coset::parameters cst_params;
 	cst_params.size = this->params_BFER_std.coded_monitoring ? params_BFER_std.cdc->N_cw : params_BFER_std.cdc->K;
 	cst_params.n_frames = params_BFER_std.src->n_frames;
 	return cst_params.template build_bit<B,B>();
 }
 
+template <typename B, typename R, typename Q>
+module::Fused_BPSK_AWGN<B,R,Q>* BFER_std<B,R,Q>
+::build_fused(const int tid)
+{
+	const auto seed_fus = rd_engine_seed[tid]();
+
+	if (auto f = this->clone_module(this->fused, tid))
+	{
+		f->set_seed(seed_fus);
+		return f;
+	}
+
+	// the quantization parameters are ignored if Q is a floating-point type
+	return new module::Fused_BPSK_AWGN<B,R,Q>(params_BFER_std.mdm->N,
+	                                          (short)params_BFER_std.qnt->n_decimals,
+	                                          (short)params_BFER_std.qnt->n_bits,
+	                                          params_BFER_std.mdm->no_sig2,
+	                                          seed_fus,
+	                                          params_BFER_std.src->n_frames);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
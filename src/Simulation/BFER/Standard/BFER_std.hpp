@@ -2,6 +2,7 @@
 #define SIMULATION_BFER_STD_HPP_
 
 #include <chrono>
+#include <cstdint>
 #include <vector>
 #include <random>
 
@@ -12,6 +13,7 @@
 #include "Module/Channel/Channel.hpp"
 #include "Module/Quantizer/Quantizer.hpp"
 #include "Module/Coset/Coset.hpp"
+#include "Module/Fused/BPSK_AWGN/Fused_BPSK_AWGN.hpp"
 
 #include "Factory/Simulation/BFER/BFER_std.hpp"
 
@@ -36,6 +38,7 @@ protected:
 	std::vector<module::Quantizer <R,Q  >*> quantizer;
 	std::vector<module::Coset     <B,Q  >*> coset_real;
 	std::vector<module::Coset     <B,B  >*> coset_bit;
+	std::vector<module::Fused_BPSK_AWGN<B,R,Q>*> fused; // replaces the modem, the channel and the quantizer if enabled
 
 	// a vector of random generator to generate the seeds
 	std::vector<std::mt19937> rd_engine_seed;
@@ -48,6 +51,21 @@ protected:
 	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
 	virtual void release_objects();
+	virtual void _save_state(const int tid, std::ostream &os);
+	virtual void _load_state(const int tid, std::istream &is);
+
+	/*!
+	 * \brief Tells if the chain "tid" generates its own frames, the source, the modem, the channel and the quantizer
+	 *        are only built for these chains.
+	 */
+	virtual bool has_generation(const int tid) const;
+
+	void set_sigma(const float sigma, const int tid = 0);
+
+	/*!
+	 * \brief Gives the global index of the next frames to the counter-based random generators of a chain.
+	 */
+	void set_counter(const uint64_t counter, const int tid = 0);
 
 	module::Source    <B    >* build_source    (const int tid = 0);
 	module::CRC       <B    >* build_crc       (const int tid = 0);
@@ -57,6 +75,7 @@ protected:
 	module::Quantizer <R,Q  >* build_quantizer (const int tid = 0);
 	module::Coset     <B,Q  >* build_coset_real(const int tid = 0);
 	module::Coset     <B,B  >* build_coset_bit (const int tid = 0);
+	module::Fused_BPSK_AWGN<B,R,Q>* build_fused(const int tid = 0);
 };
 }
 }
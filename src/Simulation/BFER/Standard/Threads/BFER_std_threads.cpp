@@ -3,12 +3,14 @@
 #include <vector>
 #include <chrono>
 #include <thread>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Threads/Thread_pinning.hpp"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
 #include "Tools/Display/bash_tools.h"
 
-#include "Factory/Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
+#include "Factory/Module/Codec/Polar/Codec_polar.hpp"
 
 #include "BFER_std_threads.hpp"
 
@@ -18,21 +20,269 @@ using namespace aff3ct::simulation;
 template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std)
-: BFER_std<B,R,Q>(params_BFER_std)
+: BFER_std<B,R,Q>(params_BFER_std),
+  sequence(params_BFER_std.n_threads, nullptr),
+  sequence_gen(params_BFER_std.n_threads, nullptr),
+  sequence_dec(params_BFER_std.n_threads, nullptr),
+  ring(params_BFER_std.n_threads, nullptr),
+  crossing_sockets(params_BFER_std.n_threads),
+  crc_gen(params_BFER_std.n_threads, nullptr),
+  encoder_gen(params_BFER_std.n_threads, nullptr),
+  points_thread(params_BFER_std.n_threads, nullptr),
+  n_started(0),
+  n_displayed(0),
+  sweep_stopped(false),
+  sweep_over(false),
+  n_live_lines(0),
+  bench_slot_size(0),
+  bench_n_slots(0),
+  bench_n_calls(params_BFER_std.n_threads, 0),
+  bench_n_ite(params_BFER_std.n_threads, 0),
+  bench_time(params_BFER_std.n_threads, std::chrono::nanoseconds(0)),
+  frame_counter(0)
 {
-	if (this->params_BFER_std.err_track_revert)
+	const auto &p = params_BFER_std;
+
+#ifdef ENABLE_MPI
+	const auto mpi = true;
+#else
+	const auto mpi = false;
+#endif
+	const auto pipeline  = p.n_threads_gen  > 0;
+	const auto groups    = p.n_snr_groups   > 1;
+	const auto bench     = p.n_bench_frames > 0;
+	const auto err_track = p.err_track_enable || p.err_track_revert;
+	const auto chkpt     = !p.chkpt_path.empty();
+	const auto uniform   = p.cdc->itl != nullptr && p.cdc->itl->core->uniform;
+
+	// the polar codec regenerates its frozen bits for each noise when they are adaptive and not fixed by a generated
+	// decoder
+	auto polar = dynamic_cast<const factory::Codec_polar::parameters*>(p.cdc);
+	const auto adaptive_fb = polar != nullptr && polar->fbg != nullptr && polar->fbg->sigma == -1.f &&
+	                         polar->dec->implem.find("_SNR") == std::string::npos;
+
+	if (groups)
+		check_compatibility("The parallel SNR sweep",
+		                    {{mpi,       "MPI"},
+		                     {pipeline,  "the pipeline mode"},
+		                     {err_track, "the bad frames tracking"},
+		                     {p.debug,   "the debug mode"},
+		                     {chkpt,     "the checkpoints"}});
+
+	if (p.crn)
+	{
+		check_compatibility("The common random numbers",
+		                    {{mpi,       "MPI"},
+		                     {pipeline,  "the pipeline mode"},
+		                     {groups,    "the SNR groups"},
+		                     {err_track, "the bad frames tracking"},
+		                     {p.debug,   "the debug mode"},
+		                     {chkpt,     "the checkpoints"},
+		                     // the frames are encoded once for all the points, the encoder cannot depend on the noise
+		                     {adaptive_fb, "the adaptive frozen bits (set '--fbg-sigma')"}});
+
+		// the received samples of a point are computed from the unit-variance noise: Y = X + sigma * N
+		if (p.chn->type != "AWGN" || p.chn->is_method != "NO" || p.chn->add_users)
+		{
+			std::stringstream message;
+			message << "The common random numbers require an AWGN channel without importance sampling and without "
+			        << "added users ('chn->type' = " << p.chn->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	if (bench)
+		check_compatibility("The decoder benchmark",
+		                    {{mpi,       "MPI"},
+		                     {pipeline,  "the pipeline mode"},
+		                     {groups,    "the SNR groups"},
+		                     {p.crn,     "the common random numbers"},
+		                     {err_track, "the bad frames tracking"},
+		                     {p.debug,   "the debug mode"},
+		                     {chkpt,     "the checkpoints"},
+		                     // the frames of the bank would be decoded with another interleaver than the one used to
+		                     // encode them
+		                     {uniform,   "the uniform interleavers"}});
+
+	if (p.cbrng)
+	{
+		check_compatibility("The counter-based PRNGs",
+		                    {{pipeline, "the pipeline mode"},
+		                     {groups,   "the SNR groups"},
+		                     {p.crn,    "the common random numbers"},
+		                     {bench,    "the decoder benchmark"},
+		                     // the index of the next frames is not saved
+		                     {chkpt,    "the checkpoints"}});
+
+		if (uniform && p.cdc->itl->core->type != "RANDOM")
+		{
+			std::stringstream message;
+			message << "The counter-based PRNGs only support the RANDOM uniform interleaver ('itl->core->type' = "
+			        << p.cdc->itl->core->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	if (p.fused)
 	{
-		if (this->params_BFER_std.n_threads != 1)
-			std::clog << tools::format_warning("Multi-threading detected with error tracking revert feature! "
-			                                   "Each thread will play the same frames. Please run with one thread.")
-			          << std::endl;
+		check_compatibility("The fused BPSK/AWGN module",
+		                    {{p.crn,     "the common random numbers"},
+		                     {p.cbrng,   "the counter-based PRNGs"},
+		                     // the noise never leaves the registers, there is nothing to dump
+		                     {err_track, "the bad frames tracking"}});
+
+		if (p.mdm->type != "BPSK" && p.mdm->type != "BPSK_FAST")
+		{
+			std::stringstream message;
+			message << "The fused BPSK/AWGN module requires a BPSK modulation ('mdm->type' = " << p.mdm->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (p.chn->type != "AWGN" || p.chn->is_method != "NO" || p.chn->add_users)
+		{
+			std::stringstream message;
+			message << "The fused BPSK/AWGN module requires an AWGN channel without importance sampling and without "
+			        << "added users ('chn->type' = " << p.chn->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (p.qnt->type != "STD" && p.qnt->type != "STD_FAST" && p.qnt->type != "NO")
+		{
+			std::stringstream message;
+			message << "The fused BPSK/AWGN module only supports the STD and STD_FAST quantizers ('qnt->type' = "
+			        << p.qnt->type << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	if (pipeline)
+	{
+		if (p.n_threads_gen > p.n_threads)
+		{
+			std::stringstream message;
+			message << "'n_threads_gen' has to be smaller or equal to 'n_threads' ('n_threads_gen' = "
+			        << p.n_threads_gen << ", 'n_threads' = " << p.n_threads << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		// the generation threads are pinned after the decoding threads ("n_threads + gid")
+		const auto n_cores = tools::Thread_pinning::get_n_cores();
+		if (p.pin_threads && n_cores && p.n_threads + p.n_threads_gen > n_cores)
+		{
+			std::stringstream message;
+			message << "The " << p.n_threads_gen << " generation threads and the " << p.n_threads << " decoding "
+			        << "threads are pinned on " << n_cores << " cores, some of them share a core.";
+			std::clog << tools::format_warning(message.str()) << std::endl;
+		}
+
+		check_compatibility("The pipeline mode",
+		                    {{err_track,                "the bad frames tracking"},
+		                     // the weights of the importance sampling are overwritten by the generation thread
+		                     // before being checked
+		                     {p.chn->is_method != "NO", "the importance sampling"},
+		                     // the frames in the queues would be lost
+		                     {chkpt,                    "the checkpoints"},
+		                     // a uniform interleaver is refreshed by the decoding thread while the generation thread
+		                     // uses it
+		                     {uniform,                  "the uniform interleavers"}});
+
+		this->modules["crc_gen"    ] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
+		this->modules["encoder_gen"] = std::vector<module::Module*>(params_BFER_std.n_threads, nullptr);
 	}
 }
 
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::check_compatibility(const std::string &mode, const std::vector<std::pair<bool,std::string>> &features)
+{
+	for (auto &f : features)
+		if (f.first)
+		{
+			std::stringstream message;
+			message << mode << " is not compatible with " << f.second << ".";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+}
+
 template <typename B, typename R, typename Q>
 BFER_std_threads<B,R,Q>
 ::~BFER_std_threads()
 {
+	for (auto i = 0; i < (int)sequence    .size(); i++) if (sequence    [i] != nullptr) { delete sequence    [i]; sequence    [i] = nullptr; }
+	for (auto i = 0; i < (int)sequence_gen.size(); i++) if (sequence_gen[i] != nullptr) { delete sequence_gen[i]; sequence_gen[i] = nullptr; }
+	for (auto i = 0; i < (int)sequence_dec.size(); i++) if (sequence_dec[i] != nullptr) { delete sequence_dec[i]; sequence_dec[i] = nullptr; }
+	for (auto i = 0; i < (int)ring        .size(); i++) if (ring        [i] != nullptr) { delete ring        [i]; ring        [i] = nullptr; }
+	for (auto i = 0; i < (int)crc_gen     .size(); i++) if (crc_gen     [i] != nullptr) { delete crc_gen     [i]; crc_gen     [i] = nullptr; }
+	for (auto i = 0; i < (int)encoder_gen .size(); i++) if (encoder_gen [i] != nullptr) { delete encoder_gen [i]; encoder_gen [i] = nullptr; }
+
+	for (auto *p : points)
+	{
+		for (auto *m : p->monitor)
+			delete m;
+		delete p->monitor_red;
+		if (p->terminal != nullptr) delete p->terminal;
+		delete p;
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::launch()
+{
+	if (this->params_BFER_std.n_bench_frames)
+		this->launch_bench();
+	else if (this->params_BFER_std.n_snr_groups > 1 || this->params_BFER_std.crn)
+		this->launch_sweep();
+	else
+		BFER_std<B,R,Q>::launch();
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::__build_communication_chain(const int tid)
+{
+	BFER_std<B,R,Q>::__build_communication_chain(tid);
+
+	// the generation thread and the decoding thread of a chain run at the same time: the generation stage can't use
+	// the CRC and the encoder of the codec, a CRC-aided decoder (or a Chase/ML decoder) uses them too
+	if (this->params_BFER_std.n_threads_gen && tid < this->params_BFER_std.n_threads_gen)
+	{
+		this->crc_gen[tid] = dynamic_cast<module::CRC<B>*>(this->crc[tid]->clone());
+
+		try
+		{
+			this->encoder_gen[tid] = dynamic_cast<module::Encoder<B>*>(this->codec[tid]->get_encoder()->clone());
+		}
+		catch (tools::unimplemented_error const&)
+		{
+			const auto &dec_type = this->params_BFER_std.cdc->dec->type;
+			if (dec_type == "ML" || dec_type == "CHASE")
+			{
+				std::stringstream message;
+				message << "The pipeline mode requires an encoder which can be cloned with the '" << dec_type
+				        << "' decoder.";
+				throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+		}
+
+		this->modules["crc_gen"    ][tid] = this->crc_gen    [tid];
+		this->modules["encoder_gen"][tid] = this->encoder_gen[tid];
+	}
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::has_generation(const int tid) const
+{
+	return this->generation_chain(tid) == tid;
+}
+
+template <typename B, typename R, typename Q>
+int BFER_std_threads<B,R,Q>
+::generation_chain(const int tid) const
+{
+	// in the pipeline mode, the generation thread "gid" feeds the decoding threads "gid", "gid + n_threads_gen", ...
+	return this->params_BFER_std.n_threads_gen ? tid % this->params_BFER_std.n_threads_gen : tid;
 }
 
 template <typename B, typename R, typename Q>
@@ -41,6 +291,15 @@ void BFER_std_threads<B,R,Q>
 {
 	BFER_std<B,R,Q>::_launch();
 
+	// the same frames are simulated at each SNR point
+	this->frame_counter = 0;
+
+	if (this->params_BFER_std.n_threads_gen)
+	{
+		this->launch_pipeline();
+		return;
+	}
+
 	std::vector<std::thread> threads(this->params_BFER_std.n_threads -1);
 	// launch a group of slave threads (there is "n_threads -1" slave threads)
 	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
@@ -59,12 +318,30 @@ void BFER_std_threads<B,R,Q>
 
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
-::start_thread(BFER_std_threads<B,R,Q> *simu, const int tid)
+::release_objects()
+{
+	const auto nthr = this->params_BFER_std.n_threads;
+	for (auto i = 0; i < nthr; i++) if (sequence    [i] != nullptr) { delete sequence    [i]; sequence    [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (sequence_gen[i] != nullptr) { delete sequence_gen[i]; sequence_gen[i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (sequence_dec[i] != nullptr) { delete sequence_dec[i]; sequence_dec[i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (ring        [i] != nullptr) { delete ring        [i]; ring        [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (crc_gen     [i] != nullptr) { delete crc_gen     [i]; crc_gen     [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (encoder_gen [i] != nullptr) { delete encoder_gen [i]; encoder_gen [i] = nullptr; }
+
+	BFER_std<B,R,Q>::release_objects();
+}
+
+template <typename B, typename R, typename Q>
+template <class F>
+void BFER_std_threads<B,R,Q>
+::run_thread(BFER_std_threads<B,R,Q> *simu, const int core, F &&body)
 {
 	try
 	{
-		simu->sockets_binding(tid);
-		simu->simulation_loop(tid);
+		if (simu->params_BFER_std.pin_threads)
+			tools::Thread_pinning::pin(core);
+
+		body();
 	}
 	catch (std::exception const& e)
 	{
@@ -75,6 +352,96 @@ void BFER_std_threads<B,R,Q>
 			simu->prev_err_messages.push_back(e.what());
 		simu->mutex_exception.unlock();
 	}
+
+	// the thread 0 is the main thread, the threads it starts later (terminal, checkpoints, ...) must not inherit its core
+	if (simu->params_BFER_std.pin_threads)
+		tools::Thread_pinning::unpin();
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::start_thread(BFER_std_threads<B,R,Q> *simu, const int tid)
+{
+	run_thread(simu, tid, [simu, tid]()
+	{
+		simu->sockets_binding(tid);
+		simu->simulation_loop(tid);
+	});
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::start_thread_pipeline(BFER_std_threads<B,R,Q> *simu, const int tid, const bool generation)
+{
+	// the generation threads run on the cores following the ones of the decoding threads
+	const auto core = generation ? simu->params_BFER_std.n_threads + tid : tid;
+
+	run_thread(simu, core, [simu, tid, generation]()
+	{
+		if (generation)
+			simu->generation_loop(tid);
+		else
+			simu->decoding_loop(tid);
+	});
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::start_thread_sweep(BFER_std_threads<B,R,Q> *simu, const int tid)
+{
+	auto *monitor = simu->monitor[tid];
+
+	run_thread(simu, tid, [simu, tid]()
+	{
+		for (auto *p = simu->points_thread[tid]; p != nullptr; p = simu->switch_point(tid, p))
+		{
+			// the chain of the thread counts its errors in the monitor of the point
+			simu->monitor[tid] = p->monitor[tid];
+			simu->set_sigma(p->sigma, tid);
+			simu->sockets_binding(tid);
+			simu->sweep_loop(tid, *p);
+		}
+	});
+
+	simu->monitor[tid] = monitor;
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::start_thread_crn(BFER_std_threads<B,R,Q> *simu, const int tid)
+{
+	run_thread(simu, tid, [simu, tid]()
+	{
+		simu->sockets_binding(tid);
+		simu->crn_loop(tid);
+	});
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::start_thread_bench(BFER_std_threads<B,R,Q> *simu, const int tid, const bool generation)
+{
+	run_thread(simu, tid, [simu, tid, generation]()
+	{
+		if (generation)
+		{
+			simu->sockets_binding(tid);
+			simu->bench_generation(tid);
+		}
+		else
+			simu->bench_loop(tid);
+	});
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::start_thread_calib(BFER_std_threads<B,R,Q> *simu, const int tid, const std::chrono::steady_clock::time_point t_stop)
+{
+	run_thread(simu, tid, [simu, tid, t_stop]()
+	{
+		simu->sockets_binding(tid);
+		simu->calibration_loop(tid, t_stop);
+	});
 }
 
 template <typename B, typename R, typename Q>
@@ -83,107 +450,133 @@ void BFER_std_threads<B,R,Q>
 {
 	using namespace module;
 
-	auto &src = *this->source    [tid];
+	// in the pipeline mode, the decoding stage of a chain without generation modules is bound on the generation stage
+	// of the chain which feeds it (see "generation_loop"), before being re-bound on its queue (see "pipeline_binding")
+	const auto gid = this->generation_chain(tid);
+	const auto gen = gid == tid;
+
+	auto &src = *this->source    [gid];
 	auto &crc = *this->crc       [tid];
-	auto &enc = *this->codec     [tid]->get_encoder();
-	auto &pct = *this->codec     [tid]->get_puncturer();
-	auto &mdm = *this->modem     [tid];
-	auto &chn = *this->channel   [tid];
-	auto &qnt = *this->quantizer [tid];
+	auto &enc = *this->codec     [gid]->get_encoder();
+	auto &pct = *this->codec     [gid]->get_puncturer();
+	auto &mdm = *this->modem     [gid];
+	auto &chn = *this->channel   [gid];
+	auto &qnt = *this->quantizer [gid];
 	auto &csr = *this->coset_real[tid];
 	auto &dec = *this->codec     [tid]->get_decoder_siho();
 	auto &csb = *this->coset_bit [tid];
 	auto &mnt = *this->monitor   [tid];
+	auto *fus =  this->fused     [gid];
 
-	if (this->params_BFER_std.src->type == "AZCW")
-	{
-		auto src_data = (uint8_t*)(src[src::tsk::generate][src::sck::generate::U_K ].get_dataptr());
-		auto crc_data = (uint8_t*)(crc[crc::tsk::build   ][crc::sck::build   ::U_K2].get_dataptr());
-		auto enc_data = (uint8_t*)(enc[enc::tsk::encode  ][enc::sck::encode  ::X_N ].get_dataptr());
-		auto pct_data = (uint8_t*)(pct[pct::tsk::puncture][pct::sck::puncture::X_N2].get_dataptr());
-
-		auto src_bytes = src[src::tsk::generate][src::sck::generate::U_K ].get_databytes();
-		auto crc_bytes = crc[crc::tsk::build   ][crc::sck::build   ::U_K2].get_databytes();
-		auto enc_bytes = enc[enc::tsk::encode  ][enc::sck::encode  ::X_N ].get_databytes();
-		auto pct_bytes = pct[pct::tsk::puncture][pct::sck::puncture::X_N2].get_databytes();
-
-		std::fill(src_data, src_data + src_bytes, 0);
-		std::fill(crc_data, crc_data + crc_bytes, 0);
-		std::fill(enc_data, enc_data + enc_bytes, 0);
-		std::fill(pct_data, pct_data + pct_bytes, 0);
-
-		mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N1](pct[pct::tsk::puncture][pct::sck::puncture::X_N2]);
-		mdm[mdm::tsk::modulate].exec();
-		mdm[mdm::tsk::modulate].reset_stats();
-	}
-	else
-	{
-		if (this->params_BFER_std.crc->type == "NO")
-			crc[crc::tsk::build][crc::sck::build::U_K2](src[src::tsk::generate][src::sck::generate::U_K]);
-		if (this->params_BFER_std.cdc->enc->type == "NO")
-			enc[enc::tsk::encode][enc::sck::encode::X_N](crc[crc::tsk::build][crc::sck::build::U_K2]);
-		if (this->params_BFER_std.cdc->pct == nullptr || this->params_BFER_std.cdc->pct->type == "NO")
-			pct[pct::tsk::puncture][pct::sck::puncture::X_N2](enc[enc::tsk::encode][enc::sck::encode::X_N]);
-
-		crc[crc::tsk::build   ][crc::sck::build   ::U_K1](src[src::tsk::generate][src::sck::generate::U_K ]);
-		enc[enc::tsk::encode  ][enc::sck::encode  ::U_K ](crc[crc::tsk::build   ][crc::sck::build   ::U_K2]);
-		pct[pct::tsk::puncture][pct::sck::puncture::X_N1](enc[enc::tsk::encode  ][enc::sck::encode  ::X_N ]);
-		mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N1](pct[pct::tsk::puncture][pct::sck::puncture::X_N2]);
-	}
+	// in the pipeline mode, the generation stage has its own CRC and encoder (see "__build_communication_chain")
+	auto &crg = this->crc_gen    [gid] != nullptr ? *this->crc_gen    [gid] : *this->crc[gid];
+	auto &eng = this->encoder_gen[gid] != nullptr ? *this->encoder_gen[gid] : enc;
 
-	if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
+	// the generation stage has already been bound by the chain "gid" otherwise
+	if (gen)
 	{
-		if (this->params_BFER_std.chn->type == "NO")
+		if (this->params_BFER_std.src->type == "AZCW")
 		{
-			chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::Y_N](mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N2]);
-			auto chn_data = (uint8_t*)(chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::H_N].get_dataptr());
-			auto chn_bytes = chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::H_N].get_databytes();
-			std::fill(chn_data, chn_data + chn_bytes, 0);
+			auto src_data = (uint8_t*)(src[src::tsk::generate][src::sck::generate::U_K ].get_dataptr());
+			auto crc_data = (uint8_t*)(crg[crc::tsk::build   ][crc::sck::build   ::U_K2].get_dataptr());
+			auto enc_data = (uint8_t*)(eng[enc::tsk::encode  ][enc::sck::encode  ::X_N ].get_dataptr());
+			auto pct_data = (uint8_t*)(pct[pct::tsk::puncture][pct::sck::puncture::X_N2].get_dataptr());
+
+			auto src_bytes = src[src::tsk::generate][src::sck::generate::U_K ].get_databytes();
+			auto crc_bytes = crg[crc::tsk::build   ][crc::sck::build   ::U_K2].get_databytes();
+			auto enc_bytes = eng[enc::tsk::encode  ][enc::sck::encode  ::X_N ].get_databytes();
+			auto pct_bytes = pct[pct::tsk::puncture][pct::sck::puncture::X_N2].get_databytes();
+
+			std::fill(src_data, src_data + src_bytes, 0);
+			std::fill(crc_data, crc_data + crc_bytes, 0);
+			std::fill(enc_data, enc_data + enc_bytes, 0);
+			std::fill(pct_data, pct_data + pct_bytes, 0);
+
+			if (fus == nullptr)
+			{
+				mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N1](pct[pct::tsk::puncture][pct::sck::puncture::X_N2]);
+				mdm[mdm::tsk::modulate].exec();
+				mdm[mdm::tsk::modulate].reset_stats();
+			}
 		}
-		if (!mdm.is_filter())
-			mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2](chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::Y_N]);
-		if (!mdm.is_demodulator())
-			mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2](mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2]);
-		if (this->params_BFER_std.qnt->type == "NO")
-			qnt[qnt::tsk::process][qnt::sck::process::Y_N2](mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
-
-		chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::X_N ](mdm[mdm::tsk::modulate     ][mdm::sck::modulate     ::X_N2]);
-		mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::H_N ](chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::H_N ]);
-		mdm[mdm::tsk::filter       ][mdm::sck::filter       ::Y_N1](chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::Y_N ]);
-		mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N1](mdm[mdm::tsk::filter       ][mdm::sck::filter       ::Y_N2]);
-		qnt[qnt::tsk::process      ][qnt::sck::process      ::Y_N1](mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
-	}
-	else
-	{
-		if (this->params_BFER_std.chn->type == "NO")
-			chn[chn::tsk::add_noise][chn::sck::add_noise::Y_N](mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N2]);
-		if (!mdm.is_filter())
-			mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2](chn[chn::tsk::add_noise][chn::sck::add_noise::Y_N]);
-		if (!mdm.is_demodulator())
-			mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2](mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2]);
-		if (this->params_BFER_std.qnt->type == "NO")
-			qnt[qnt::tsk::process][qnt::sck::process::Y_N2](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
-
-		chn[chn::tsk::add_noise ][chn::sck::add_noise ::X_N ](mdm[mdm::tsk::modulate  ][mdm::sck::modulate  ::X_N2]);
-		mdm[mdm::tsk::filter    ][mdm::sck::filter    ::Y_N1](chn[chn::tsk::add_noise ][chn::sck::add_noise ::Y_N ]);
-		mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N1](mdm[mdm::tsk::filter    ][mdm::sck::filter    ::Y_N2]);
-		qnt[qnt::tsk::process   ][qnt::sck::process   ::Y_N1](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
-	}
+		else
+		{
+			if (this->params_BFER_std.crc->type == "NO")
+				crg[crc::tsk::build][crc::sck::build::U_K2](src[src::tsk::generate][src::sck::generate::U_K]);
+			if (this->params_BFER_std.cdc->enc->type == "NO")
+				eng[enc::tsk::encode][enc::sck::encode::X_N](crg[crc::tsk::build][crc::sck::build::U_K2]);
+			if (this->params_BFER_std.cdc->pct == nullptr || this->params_BFER_std.cdc->pct->type == "NO")
+				pct[pct::tsk::puncture][pct::sck::puncture::X_N2](eng[enc::tsk::encode][enc::sck::encode::X_N]);
+
+			crg[crc::tsk::build   ][crc::sck::build   ::U_K1](src[src::tsk::generate][src::sck::generate::U_K ]);
+			eng[enc::tsk::encode  ][enc::sck::encode  ::U_K ](crg[crc::tsk::build   ][crc::sck::build   ::U_K2]);
+			pct[pct::tsk::puncture][pct::sck::puncture::X_N1](eng[enc::tsk::encode  ][enc::sck::encode  ::X_N ]);
+			if (fus == nullptr)
+				mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N1](pct[pct::tsk::puncture][pct::sck::puncture::X_N2]);
+		}
+
+		if (fus != nullptr)
+		{
+			// the modem, the channel and the quantizer are replaced by the fused module (they are not executed)
+			(*fus)[fus::tsk::transmit][fus::sck::transmit::X_N](pct[pct::tsk::puncture][pct::sck::puncture::X_N2]);
+		}
+		else if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
+		{
+			if (this->params_BFER_std.chn->type == "NO")
+			{
+				chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::Y_N](mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N2]);
+				auto chn_data = (uint8_t*)(chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::H_N].get_dataptr());
+				auto chn_bytes = chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::H_N].get_databytes();
+				std::fill(chn_data, chn_data + chn_bytes, 0);
+			}
+			if (!mdm.is_filter())
+				mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2](chn[chn::tsk::add_noise_wg][chn::sck::add_noise_wg::Y_N]);
+			if (!mdm.is_demodulator())
+				mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2](mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2]);
+			if (this->params_BFER_std.qnt->type == "NO")
+				qnt[qnt::tsk::process][qnt::sck::process::Y_N2](mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
+
+			chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::X_N ](mdm[mdm::tsk::modulate     ][mdm::sck::modulate     ::X_N2]);
+			mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::H_N ](chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::H_N ]);
+			mdm[mdm::tsk::filter       ][mdm::sck::filter       ::Y_N1](chn[chn::tsk::add_noise_wg ][chn::sck::add_noise_wg ::Y_N ]);
+			mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N1](mdm[mdm::tsk::filter       ][mdm::sck::filter       ::Y_N2]);
+			qnt[qnt::tsk::process      ][qnt::sck::process      ::Y_N1](mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2]);
+		}
+		else
+		{
+			if (this->params_BFER_std.chn->type == "NO")
+				chn[chn::tsk::add_noise][chn::sck::add_noise::Y_N](mdm[mdm::tsk::modulate][mdm::sck::modulate::X_N2]);
+			if (!mdm.is_filter())
+				mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2](chn[chn::tsk::add_noise][chn::sck::add_noise::Y_N]);
+			if (!mdm.is_demodulator())
+				mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2](mdm[mdm::tsk::filter][mdm::sck::filter::Y_N2]);
+			if (this->params_BFER_std.qnt->type == "NO")
+				qnt[qnt::tsk::process][qnt::sck::process::Y_N2](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
+
+			chn[chn::tsk::add_noise ][chn::sck::add_noise ::X_N ](mdm[mdm::tsk::modulate  ][mdm::sck::modulate  ::X_N2]);
+			mdm[mdm::tsk::filter    ][mdm::sck::filter    ::Y_N1](chn[chn::tsk::add_noise ][chn::sck::add_noise ::Y_N ]);
+			mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N1](mdm[mdm::tsk::filter    ][mdm::sck::filter    ::Y_N2]);
+			qnt[qnt::tsk::process   ][qnt::sck::process   ::Y_N1](mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2]);
+		}
+
+		auto &llr = fus != nullptr ? (*fus)[fus::tsk::transmit][fus::sck::transmit::Y_N ] :
+		                                qnt [qnt::tsk::process ][qnt::sck::process ::Y_N2];
 
-	if (this->params_BFER_std.cdc->pct == nullptr || this->params_BFER_std.cdc->pct->type == "NO")
-		pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
+		if (this->params_BFER_std.cdc->pct == nullptr || this->params_BFER_std.cdc->pct->type == "NO")
+			pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2](llr);
 
-	pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N1](qnt[qnt::tsk::process][qnt::sck::process::Y_N2]);
+		pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N1](llr);
+	}
 
 	if (this->params_BFER_std.coset)
 	{
-		csr[cst::tsk::apply][cst::sck::apply::ref](enc[enc::tsk::encode    ][enc::sck::encode    ::X_N ]);
+		csr[cst::tsk::apply][cst::sck::apply::ref](eng[enc::tsk::encode    ][enc::sck::encode    ::X_N ]);
 		csr[cst::tsk::apply][cst::sck::apply::in ](pct[pct::tsk::depuncture][pct::sck::depuncture::Y_N2]);
 
 		if (this->params_BFER_std.coded_monitoring)
 		{
 			dec[dec::tsk::decode_siho_cw][dec::sck::decode_siho_cw::Y_N](csr[cst::tsk::apply         ][cst::sck::apply         ::out]);
-			csb[cst::tsk::apply         ][cst::sck::apply         ::ref](enc[enc::tsk::encode        ][enc::sck::encode        ::X_N]);
+			csb[cst::tsk::apply         ][cst::sck::apply         ::ref](eng[enc::tsk::encode        ][enc::sck::encode        ::X_N]);
 			csb[cst::tsk::apply         ][cst::sck::apply         ::in ](dec[dec::tsk::decode_siho_cw][dec::sck::decode_siho_cw::V_N]);
 		}
 		else
@@ -192,7 +585,7 @@ void BFER_std_threads<B,R,Q>
 				crc[crc::tsk::extract][crc::sck::extract::V_K2](csb[cst::tsk::apply][cst::sck::apply::out]);
 
 			dec[dec::tsk::decode_siho][dec::sck::decode_siho::Y_N ](csr[cst::tsk::apply      ][cst::sck::apply      ::out ]);
-			csb[cst::tsk::apply      ][cst::sck::apply      ::ref ](crc[crc::tsk::build      ][crc::sck::build      ::U_K2]);
+			csb[cst::tsk::apply      ][cst::sck::apply      ::ref ](crg[crc::tsk::build      ][crc::sck::build      ::U_K2]);
 			csb[cst::tsk::apply      ][cst::sck::apply      ::in  ](dec[dec::tsk::decode_siho][dec::sck::decode_siho::V_K ]);
 			crc[crc::tsk::extract    ][crc::sck::extract    ::V_K1](csb[cst::tsk::apply      ][cst::sck::apply      ::out ]);
 		}
@@ -215,7 +608,7 @@ void BFER_std_threads<B,R,Q>
 
 	if (this->params_BFER_std.coded_monitoring)
 	{
-		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::U](enc[enc::tsk::encode][enc::sck::encode::X_N]);
+		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::U](eng[enc::tsk::encode][enc::sck::encode::X_N]);
 
 		if (this->params_BFER_std.coset)
 		{
@@ -231,33 +624,60 @@ void BFER_std_threads<B,R,Q>
 		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::U](src[src::tsk::generate][src::sck::generate::U_K ]);
 		mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V](crc[crc::tsk::extract ][crc::sck::extract ::V_K2]);
 	}
+
+	// compile the execution plan from the bound sockets (the AZCW frames are generated once and for all)
+	auto &first = this->params_BFER_std.src->type != "AZCW" ? src[src::tsk::generate] :
+	              fus != nullptr ? (*fus)[fus::tsk::transmit] :
+	              this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos ? chn[chn::tsk::add_noise_wg] :
+	                                                                                         chn[chn::tsk::add_noise   ];
+
+	if (this->params_BFER_std.crn)
+	{
+		// the frames are generated once with a unit-variance noise, the rest of the chain is executed for each SNR
+		// point, the monitor of the chain is excluded (each point has its own)
+		auto &last_gen  = chn[chn::tsk::add_noise    ];
+		auto &first_dec = mdm[mdm::tsk::filter       ];
+		auto &excluded  = mnt[mnt::tsk::check_errors];
+
+		if (this->sequence_gen[tid] != nullptr) delete this->sequence_gen[tid];
+		if (this->sequence_dec[tid] != nullptr) delete this->sequence_dec[tid];
+		this->sequence_gen[tid] = new tools::Sequence(first, last_gen);
+		this->sequence_dec[tid] = new tools::Sequence({&first_dec}, {}, {&excluded});
+	}
+	else if (this->params_BFER_std.n_threads_gen)
+	{
+		auto &first_dec = this->params_BFER_std.coset            ? csr[cst::tsk::apply         ] :
+		                  this->params_BFER_std.coded_monitoring ? dec[dec::tsk::decode_siho_cw] :
+		                                                           dec[dec::tsk::decode_siho   ];
+
+		if (gen)
+		{
+			if (this->sequence_gen[tid] != nullptr) delete this->sequence_gen[tid];
+			this->sequence_gen[tid] = new tools::Sequence(first, pct[pct::tsk::depuncture]);
+		}
+		if (this->sequence_dec[tid] != nullptr) delete this->sequence_dec[tid];
+		this->sequence_dec[tid] = new tools::Sequence(first_dec, mnt[mnt::tsk::check_errors]);
+	}
+	else
+	{
+		if (this->sequence[tid] != nullptr) delete this->sequence[tid];
+		this->sequence[tid] = new tools::Sequence(first, mnt[mnt::tsk::check_errors]);
+	}
 }
 
 template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
 ::simulation_loop(const int tid)
 {
-	auto &source     = *this->source    [tid];
-	auto &crc        = *this->crc       [tid];
-	auto &encoder    = *this->codec     [tid]->get_encoder();
-	auto &puncturer  = *this->codec     [tid]->get_puncturer();
-	auto &modem      = *this->modem     [tid];
-	auto &channel    = *this->channel   [tid];
-	auto &quantizer  = *this->quantizer [tid];
-	auto &coset_real = *this->coset_real[tid];
-	auto &decoder    = *this->codec     [tid]->get_decoder_siho();
-	auto &coset_bit  = *this->coset_bit [tid];
-	auto &monitor    = *this->monitor   [tid];
+	auto &monitor  = *this->monitor [tid];
+	auto &sequence = *this->sequence[tid];
 
 	using namespace module;
 	using namespace std::chrono;
 	auto t_snr = steady_clock::now();
 
 	// communication chain execution
-	while (!this->monitor_red->fe_limit_achieved() && // while max frame error count has not been reached
-	       (this->params_BFER_std.stop_time == seconds(0) || 
-	       (steady_clock::now() - t_snr) < this->params_BFER_std.stop_time) &&
-	       (this->monitor_red->get_n_analyzed_fra() < this->max_fra || this->max_fra == 0))
+	while (!this->is_done(tid, t_snr))
 	{
 		if (this->params_BFER_std.debug)
 		{
@@ -270,77 +690,33 @@ void BFER_std_threads<B,R,Q>
 			std::cout << "#" << std::endl;
 		}
 
-		if (this->params_BFER_std.src->type != "AZCW")
-		{
-			source[src::tsk::generate].exec();
-			if (this->params_BFER_std.crc->type != "NO")
-				crc[crc::tsk::build].exec();
-			if (this->params_BFER_std.cdc->enc->type != "NO")
-				encoder[enc::tsk::encode].exec();
-			if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-				puncturer[pct::tsk::puncture].exec();
-			modem[mdm::tsk::modulate].exec();
-		}
+		// the threads take the next frames in the global order
+		if (this->params_BFER_std.cbrng)
+			this->set_counter(this->frame_counter.fetch_add(this->params_BFER_std.src->n_frames), tid);
 
-		if (this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos)
-		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise_wg].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate_wg].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-		}
-		else
-		{
-			if (this->params_BFER_std.chn->type != "NO")
-				channel[chn::tsk::add_noise].exec();
-			if (modem.is_filter())
-				modem[mdm::tsk::filter].exec();
-			if (modem.is_demodulator())
-				modem[mdm::tsk::demodulate].exec();
-			if (this->params_BFER_std.qnt->type != "NO")
-				quantizer[qnt::tsk::process].exec();
-		}
+		sequence.exec();
 
-		if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-			puncturer[pct::tsk::depuncture].exec();
+		// the state of the thread is consistent between two frames
+		if (this->checkpoint != nullptr && this->checkpoint->is_requested(tid))
+			this->checkpoint->submit(tid, this->save_state(tid));
+	}
 
-		if (this->params_BFER_std.coset)
-		{
-			coset_real[cst::tsk::apply].exec();
+	if (this->checkpoint != nullptr)
+		this->checkpoint->leave(tid);
+}
 
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder  [dec::tsk::decode_siho_cw].exec();
-				coset_bit[cst::tsk::apply         ].exec();
-			}
-			else
-			{
-				decoder  [dec::tsk::decode_siho].exec();
-				coset_bit[cst::tsk::apply      ].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
-		else
-		{
-			if (this->params_BFER_std.coded_monitoring)
-			{
-				decoder[dec::tsk::decode_siho_cw].exec();
-			}
-			else
-			{
-				decoder[dec::tsk::decode_siho].exec();
-				if (this->params_BFER_std.crc->type != "NO")
-					crc[crc::tsk::extract].exec();
-			}
-		}
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::is_done(const int tid, const std::chrono::steady_clock::time_point &t_snr)
+{
+	using namespace std::chrono;
 
-		monitor[mnt::tsk::check_errors].exec();
-	}
+	// the generation threads (tid = -1) have no monitor, they only read the flag updated by the decoding threads
+	const auto fe_done = tid >= 0 ? this->monitor_red->is_done(tid) : this->monitor_red->is_done();
+
+	return fe_done || // the max frame error count or the max number of frames has been reached
+	       (this->params_BFER_std.stop_time != seconds(0) &&
+	       (steady_clock::now() - t_snr) >= this->params_BFER_std.stop_time);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -1,6 +1,19 @@
 #ifndef SIMULATION_BFER_STD_THREADS_HPP_
 #define SIMULATION_BFER_STD_THREADS_HPP_
 
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <utility>
+#include <mipp.h>
+
+#include "Tools/Sequence/Sequence.hpp"
+#include "Tools/Threads/Ring_buffer.hpp"
+
 #include "../BFER_std.hpp"
 
 namespace aff3ct
@@ -10,18 +23,133 @@ namespace simulation
 template <typename B = int, typename R = float, typename Q = R>
 class BFER_std_threads : public BFER_std<B,R,Q>
 {
+protected:
+	// the execution plan of the communication chain (one per thread)
+	std::vector<tools::Sequence*> sequence;
+
+	// the pipeline mode: the frames are generated by dedicated threads and sent to the decoding threads
+	std::vector<tools::Sequence*>         sequence_gen; // generation stage (source -> depuncturer), one per chain
+	std::vector<tools::Sequence*>         sequence_dec; // decoding stage (decoder -> monitor), one per chain
+	std::vector<tools::Ring_buffer*>      ring;         // the frames queue of each decoding thread
+	std::vector<std::pair<size_t,size_t>> crossing;     // the (task, socket) ids in the generation stage of the buffers
+	                                                    // read by the decoding stage
+	std::vector<std::vector<std::vector<module::Socket*>>> crossing_sockets; // [chain][buffer] the sockets of the
+	                                                                         // decoding stage bound on the buffer
+	std::vector<module::CRC    <B>*>      crc_gen;      // the CRC and the encoder of the generation stage, the
+	std::vector<module::Encoder<B>*>      encoder_gen;  // decoder of the chain may use the ones of its codec
+
+	// the parallel SNR sweep: several SNR points are simulated at the same time by groups of threads (with the common
+	// random numbers, all the points are simulated by all the threads on the same frames)
+	struct snr_point
+	{
+		float snr_s;
+		float snr_b;
+		float sigma;
+
+		std::vector<module::Monitor_BFER<B>*> monitor;     // one per thread, counts the errors of the point only
+		module::Monitor_BFER_reduction<B>*    monitor_red;
+		tools::Terminal_BFER<B>*              terminal;    // built when the point starts
+		std::stringstream                     report;      // the final line, displayed in the SNR order
+
+		std::chrono::steady_clock::time_point t_start;
+		int  n_threads; // the number of threads currently working on the point
+		bool started;
+		bool done;      // no thread can join the point anymore
+		bool reported;  // the last thread has left the point
+	};
+	std::vector<snr_point*>   points;
+	std::vector<snr_point*>   points_thread; // the point of each thread
+	std::mutex                mutex_points;
+	size_t                    n_started;
+	size_t                    n_displayed;
+	bool                      sweep_stopped;
+	bool                      sweep_over;    // stops the live display of the running points
+	std::condition_variable   cond_points;
+	size_t                    n_live_lines;  // the number of lines of the live display currently on the screen
+
+	// the decoder benchmark: the decoder inputs of the pre-generated frames, shared by all the threads (one aligned
+	// slot per call to the decoder)
+	mipp::vector<Q>                       bench_bank;
+	size_t                                bench_slot_size; // in number of elements
+	size_t                                bench_n_slots;
+	std::vector<unsigned long long>       bench_n_calls;   // the number of calls to the decoder of each thread
+	std::vector<unsigned long long>       bench_n_ite;     // the number of iterations performed by each thread
+	std::vector<std::chrono::nanoseconds> bench_time;      // the decoding time of each thread
+
+	// the counter-based PRNGs: the global index of the next frames, shared by the threads and reset for each SNR point
+	std::atomic<uint64_t> frame_counter;
+
 public:
 	explicit BFER_std_threads(const factory::BFER_std::parameters &params_BFER_std);
 	virtual ~BFER_std_threads();
+	virtual void launch();
+
+	/*!
+	 * \brief Simulates the first SNR point on all the threads during "duration" without any display.
+	 *
+	 * \return the number of simulated frames per second.
+	 */
+	double calibrate(const std::chrono::milliseconds duration);
+
+	/*!
+	 * \brief Throws if a simulation mode is enabled with an incompatible feature.
+	 *
+	 * \param mode:     the name of the mode (beginning of the error message).
+	 * \param features: the {enabled, name} pairs of the features incompatible with the mode.
+	 */
+	static void check_compatibility(const std::string &mode, const std::vector<std::pair<bool,std::string>> &features);
 
 protected:
+	virtual void __build_communication_chain(const int tid = 0);
 	virtual void _launch();
+	virtual void release_objects();
+	virtual bool has_generation(const int tid) const;
 
 private:
-	void sockets_binding(const int tid = 0);
-	void simulation_loop(const int tid = 0);
+	/*!
+	 * \brief The chain which generates the frames decoded by the chain "tid" ("tid" itself out of the pipeline mode).
+	 */
+	int generation_chain(const int tid) const;
+
+	void sockets_binding (const int tid = 0);
+	void pipeline_binding(const int tid = 0);
+	void simulation_loop (const int tid = 0);
+	void generation_loop (const int gid = 0);
+	void decoding_loop   (const int tid = 0);
+	void launch_pipeline (                 );
+
+	bool is_done(const int tid, const std::chrono::steady_clock::time_point &t_snr);
+
+	void       launch_sweep   (                                  );
+	void       sweep_loop     (const int tid, snr_point &point   );
+	snr_point* switch_point   (const int tid, snr_point *previous);
+	bool       is_done        (snr_point &point, const int tid = -1);
+	void       display_reports(const bool all = false            );
+	void       display_live   (                                  );
+	void       live_loop      (                                  );
+
+	void crn_loop   (const int tid = 0 );
+	void leave_point(snr_point &point  );
+
+	void calibration_loop(const int tid, const std::chrono::steady_clock::time_point t_stop);
+
+	void launch_bench    (                 );
+	void bench_generation(const int tid = 0);
+	void bench_loop      (const int tid = 0);
+
+	/*!
+	 * \brief Runs "body" in a simulation thread: pins the thread on "core" (if enabled) and records the exceptions.
+	 */
+	template <class F>
+	static void run_thread(BFER_std_threads<B,R,Q> *simu, const int core, F &&body);
 
-	static void start_thread(BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+	static void start_thread         (BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+	static void start_thread_pipeline(BFER_std_threads<B,R,Q> *simu, const int tid, const bool generation);
+	static void start_thread_sweep   (BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+	static void start_thread_crn     (BFER_std_threads<B,R,Q> *simu, const int tid = 0);
+	static void start_thread_bench   (BFER_std_threads<B,R,Q> *simu, const int tid, const bool generation);
+	static void start_thread_calib   (BFER_std_threads<B,R,Q> *simu, const int tid,
+	                                  const std::chrono::steady_clock::time_point t_stop);
 };
 }
 }
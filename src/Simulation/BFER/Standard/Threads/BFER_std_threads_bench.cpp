@@ -0,0 +1,249 @@
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+#include "Tools/general_utils.h"
+#include "Tools/system_functions.h"
+#include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Display/Timeline/Timeline.hpp"
+#include "Tools/Display/bash_tools.h"
+
+#include "BFER_std_threads.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::simulation;
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::launch_bench()
+{
+	const auto &params = this->params_BFER_std;
+	const auto n_threads = params.n_threads;
+
+	this->build_communication_chain();
+
+	if (module::Monitor::is_over())
+	{
+		this->release_objects();
+		return;
+	}
+
+	// one slot of the bank per call to the decoder, the slots start on a SIMD register boundary
+	auto &dec = *this->codec[0]->get_decoder_siho();
+	auto &tsk = params.coded_monitoring ? dec[module::dec::tsk::decode_siho_cw] : dec[module::dec::tsk::decode_siho];
+	const auto n_elmts   = tsk[module::dec::sck::decode_siho::Y_N].get_databytes() / sizeof(Q);
+	const auto n_frames  = (size_t)dec.get_n_frames();
+	const auto n_ite_fra = (size_t)(dec.get_n_dec_waves() * dec.get_simd_inter_frame_level()); // with the padding
+	const auto n_reg     = (size_t)mipp::nElReg<Q>();
+	this->bench_slot_size = ((n_elmts + n_reg -1) / n_reg) * n_reg;
+	this->bench_n_slots   = ((size_t)params.n_bench_frames + n_frames -1) / n_frames;
+	this->bench_bank.resize(this->bench_slot_size * this->bench_n_slots);
+
+	using namespace tools;
+	if (!params.ter->disabled)
+	{
+		std::cout << "# " << format("------------------------------------------------||------------------------------------------------------", Style::BOLD) << std::endl;
+		std::cout << "# " << format("    Errors on the bank of pre-generated frames  ||        Decoding only of the bank (all the threads)   ", Style::BOLD) << std::endl;
+		std::cout << "# " << format("------------------------------------------------||------------------------------------------------------", Style::BOLD) << std::endl;
+		std::cout << "# " << format("-------|-------|----------|----------|----------||----------|----------|----------|----------|----------", Style::BOLD) << std::endl;
+		std::cout << "# " << format(" Es/N0 | Eb/N0 |       FE |      BER |      FER ||      FRA |  AVG_ITE | INFO_THR | CODE_THR |  LATENCY ", Style::BOLD) << std::endl;
+		std::cout << "# " << format("  (dB) |  (dB) |          |          |          ||          |          |   (Mb/s) |   (Mb/s) |     (us) ", Style::BOLD) << std::endl;
+		std::cout << "# " << format("-------|-------|----------|----------|----------||----------|----------|----------|----------|----------", Style::BOLD) << std::endl;
+	}
+
+	for (this->snr = params.snr_min; this->snr <= params.snr_max; this->snr += params.snr_step)
+	{
+		if (params.snr_type == "EB")
+		{
+			this->snr_b = this->snr;
+			this->snr_s = tools::ebn0_to_esn0(this->snr_b, this->bit_rate, params.mdm->bps);
+		}
+		else // if (params.snr_type == "ES")
+		{
+			this->snr_s = this->snr;
+			this->snr_b = tools::esn0_to_ebn0(this->snr_s, this->bit_rate, params.mdm->bps);
+		}
+		this->sigma = tools::esn0_to_sigma(this->snr_s, params.mdm->upf);
+
+		for (auto tid = 0; tid < n_threads; tid++)
+			this->set_sigma(this->sigma, tid);
+		this->monitor_red->reset();
+
+		// fill the bank with the whole chain (the frames of the bank are also checked once), then only decode it
+		for (auto generation : {true, false})
+		{
+			std::vector<std::thread> threads(n_threads -1);
+			for (auto tid = 1; tid < n_threads; tid++)
+				threads[tid -1] = std::thread(BFER_std_threads<B,R,Q>::start_thread_bench, this, tid, generation);
+
+			BFER_std_threads<B,R,Q>::start_thread_bench(this, 0, generation);
+
+			for (auto tid = 1; tid < n_threads; tid++)
+				threads[tid -1].join();
+
+			if (module::Monitor::is_interrupt())
+				break;
+		}
+
+		// one timeline per SNR point, with both the filling and the decoding of the bank
+		if (!params.trace_path.empty())
+		{
+			std::stringstream s_snr_b;
+			s_snr_b << std::setprecision(2) << std::fixed << this->snr_b;
+			tools::Timeline::flush(params.trace_path + "_" + s_snr_b.str() + ".json");
+		}
+
+		if (module::Monitor::is_interrupt())
+			break;
+
+		unsigned long long n_calls = 0, n_ite = 0;
+		std::chrono::nanoseconds t_max(0);
+		double latency = 0.;
+		for (auto tid = 0; tid < n_threads; tid++)
+		{
+			n_calls += this->bench_n_calls[tid];
+			n_ite   += this->bench_n_ite  [tid];
+			t_max    = std::max(t_max, this->bench_time[tid]);
+			latency += (double)this->bench_time[tid].count() * 1e-3 / (double)this->bench_n_calls[tid];
+		}
+		latency /= (double)n_threads;
+
+		const auto n_fra    = n_calls * n_frames;
+		const auto info_thr = (double)n_fra * (double)params.src->K / ((double)t_max.count() * 1e-3);
+		const auto code_thr = (double)n_fra * (double)params.cdc->N / ((double)t_max.count() * 1e-3);
+		const auto avg_ite  = (double)n_ite / (double)(n_calls * n_ite_fra);
+
+		if (!params.ter->disabled)
+		{
+			std::stringstream str_ber, str_fer, str_ite;
+			str_ber << std::setprecision(2) << std::scientific << std::setw(8) << this->monitor_red->get_ber();
+			str_fer << std::setprecision(2) << std::scientific << std::setw(8) << this->monitor_red->get_fer();
+			if (n_ite)
+				str_ite << std::setprecision(2) << std::fixed << std::setw(8) << avg_ite;
+			else
+				str_ite << "       -";
+
+			std::cout << "  " << std::setprecision(2) << std::fixed << std::setw(6) << this->snr_s  << format(" | ",  Style::BOLD)
+			                  << std::setprecision(2) << std::fixed << std::setw(5) << this->snr_b  << format(" | ",  Style::BOLD)
+			                                                        << std::setw(8) << this->monitor_red->get_n_fe()
+			                                                                                       << format(" | ",  Style::BOLD)
+			                                                                        << str_ber.str() << format(" | ",  Style::BOLD)
+			                                                                        << str_fer.str() << format(" || ", Style::BOLD)
+			                                                        << std::setw(8) << n_fra        << format(" | ",  Style::BOLD)
+			                                                                        << str_ite.str() << format(" | ",  Style::BOLD)
+			                  << std::setprecision(2) << std::fixed << std::setw(8) << info_thr     << format(" | ",  Style::BOLD)
+			                  << std::setprecision(2) << std::fixed << std::setw(8) << code_thr     << format(" | ",  Style::BOLD)
+			                  << std::setprecision(2) << std::fixed << std::setw(8) << latency      << std::endl;
+		}
+	}
+
+	if (!this->prev_err_messages.empty())
+	{
+		std::cerr << tools::apply_on_each_line(tools::addr2line(this->prev_err_messages.back()), &tools::format_error)
+		          << std::endl;
+		this->simu_error = true;
+	}
+
+	if (params.statistics && !params.ter->disabled && !this->simu_error)
+	{
+		std::vector<std::vector<const module::Module*>> mod_vec;
+		for (auto &vm : this->modules)
+		{
+			std::vector<const module::Module*> sub_mod_vec;
+			for (auto *m : vm.second)
+				sub_mod_vec.push_back(m);
+			mod_vec.push_back(sub_mod_vec);
+		}
+
+		std::cout << "#" << std::endl;
+		tools::Stats::show(mod_vec, true, std::cout);
+		std::cout << "#" << std::endl;
+	}
+
+	mipp::vector<Q>().swap(this->bench_bank);
+	this->release_objects();
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::bench_generation(const int tid)
+{
+	auto &sequence = *this->sequence[tid];
+	auto &dec      = *this->codec   [tid]->get_decoder_siho();
+	auto &tsk      = this->params_BFER_std.coded_monitoring ? dec[module::dec::tsk::decode_siho_cw] :
+	                                                          dec[module::dec::tsk::decode_siho   ];
+	auto &Y_N      = tsk[module::dec::sck::decode_siho::Y_N]; // same id in the "decode_siho_cw" task
+
+	// the slots of the bank are shared between the threads
+	for (auto s = (size_t)tid; s < this->bench_n_slots && !module::Monitor::is_interrupt();
+	     s += this->params_BFER_std.n_threads)
+	{
+		sequence.exec();
+
+		const auto data = static_cast<const Q*>(Y_N.get_dataptr());
+		std::copy(data, data + Y_N.get_databytes() / sizeof(Q), this->bench_bank.begin() + s * this->bench_slot_size);
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::bench_loop(const int tid)
+{
+	auto &dec = *this->codec[tid]->get_decoder_siho();
+	auto &tsk = this->params_BFER_std.coded_monitoring ? dec[module::dec::tsk::decode_siho_cw] :
+	                                                     dec[module::dec::tsk::decode_siho   ];
+	auto &Y_N = tsk[module::dec::sck::decode_siho::Y_N]; // same id in the "decode_siho_cw" task
+
+	// the statistics and the iterations of the bank generation are not counted
+	tsk.reset_stats();
+	dec.reset_n_ite_done();
+
+	// without stop time, each thread decodes the whole bank once (the threads start on different slots)
+	const auto stop_time = this->params_BFER_std.stop_time;
+	auto s = (size_t)tid % this->bench_n_slots;
+	unsigned long long n_calls = 0;
+
+	using namespace std::chrono;
+	const auto t_start = steady_clock::now();
+	auto t_cur = t_start;
+	do
+	{
+		Y_N.bind(this->bench_bank.data() + s * this->bench_slot_size);
+		tsk.exec();
+		n_calls++;
+
+		s = (s +1) % this->bench_n_slots;
+		t_cur = steady_clock::now();
+	}
+	while (!module::Monitor::is_interrupt() &&
+	       (stop_time == seconds(0) ? n_calls < this->bench_n_slots : (t_cur - t_start) < stop_time));
+
+	this->bench_n_calls[tid] = n_calls;
+	this->bench_n_ite  [tid] = dec.get_n_ite_done();
+	this->bench_time   [tid] = duration_cast<nanoseconds>(t_cur - t_start);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::launch_bench();
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::bench_generation(const int);
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::bench_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::launch_bench();
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::bench_generation(const int);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::bench_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::launch_bench();
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::bench_generation(const int);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::bench_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::launch_bench();
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::bench_generation(const int);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::bench_loop(const int);
+#else
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::launch_bench();
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::bench_generation(const int);
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::bench_loop(const int);
+#endif
+// ==================================================================================== explicit template instantiation
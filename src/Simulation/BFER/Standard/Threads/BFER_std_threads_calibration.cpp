@@ -0,0 +1,103 @@
+#include <vector>
+#include <chrono>
+#include <thread>
+
+#include "Tools/general_utils.h"
+#include "Tools/Display/Timeline/Timeline.hpp"
+
+#include "BFER_std_threads.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::simulation;
+
+template <typename B, typename R, typename Q>
+double BFER_std_threads<B,R,Q>
+::calibrate(const std::chrono::milliseconds duration)
+{
+	const auto &params = this->params_BFER_std;
+
+	this->build_communication_chain();
+
+	if (module::Monitor::is_over())
+	{
+		this->release_objects();
+		return 0.;
+	}
+
+	this->snr = params.snr_min;
+	if (params.snr_type == "EB")
+	{
+		this->snr_b = this->snr;
+		this->snr_s = tools::ebn0_to_esn0(this->snr_b, this->bit_rate, params.mdm->bps);
+	}
+	else // if (params.snr_type == "ES")
+	{
+		this->snr_s = this->snr;
+		this->snr_b = tools::esn0_to_ebn0(this->snr_s, this->bit_rate, params.mdm->bps);
+	}
+	this->sigma = tools::esn0_to_sigma(this->snr_s, params.mdm->upf);
+
+	for (auto tid = 0; tid < params.n_threads; tid++)
+		this->set_sigma(this->sigma, tid);
+
+	using namespace std::chrono;
+	const auto t_start = steady_clock::now();
+	const auto t_stop  = t_start + duration;
+
+	std::vector<std::thread> threads(params.n_threads -1);
+	for (auto tid = 1; tid < params.n_threads; tid++)
+		threads[tid -1] = std::thread(BFER_std_threads<B,R,Q>::start_thread_calib, this, tid, t_stop);
+
+	BFER_std_threads<B,R,Q>::start_thread_calib(this, 0, t_stop);
+
+	for (auto tid = 1; tid < params.n_threads; tid++)
+		threads[tid -1].join();
+
+	const auto elapsed = duration_cast<nanoseconds>(steady_clock::now() - t_start);
+
+	unsigned long long n_fra = 0;
+	for (auto tid = 0; tid < params.n_threads; tid++)
+		n_fra += this->monitor[tid]->get_n_analyzed_fra();
+
+	// the events of the calibration refer to the Tasks of the released chains
+	tools::Timeline::clear();
+	this->release_objects();
+
+	if (!this->prev_err_messages.empty())
+		throw std::runtime_error(this->prev_err_messages.back());
+
+	return (double)n_fra / ((double)elapsed.count() * 1e-9);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::calibration_loop(const int tid, const std::chrono::steady_clock::time_point t_stop)
+{
+	auto &sequence = *this->sequence[tid];
+
+	// the frame errors limit is ignored, only the number of simulated frames matters
+	while (!module::Monitor::is_interrupt() && std::chrono::steady_clock::now() < t_stop)
+	{
+		if (this->params_BFER_std.cbrng)
+			this->set_counter(this->frame_counter.fetch_add(this->params_BFER_std.src->n_frames), tid);
+
+		sequence.exec();
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template double aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::calibrate(const std::chrono::milliseconds);
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::calibration_loop(const int, const std::chrono::steady_clock::time_point);
+template double aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::calibrate(const std::chrono::milliseconds);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::calibration_loop(const int, const std::chrono::steady_clock::time_point);
+template double aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::calibrate(const std::chrono::milliseconds);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::calibration_loop(const int, const std::chrono::steady_clock::time_point);
+template double aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::calibrate(const std::chrono::milliseconds);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::calibration_loop(const int, const std::chrono::steady_clock::time_point);
+#else
+template double aff3ct::simulation::BFER_std_threads<B,R,Q>::calibrate(const std::chrono::milliseconds);
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::calibration_loop(const int, const std::chrono::steady_clock::time_point);
+#endif
+// ==================================================================================== explicit template instantiation
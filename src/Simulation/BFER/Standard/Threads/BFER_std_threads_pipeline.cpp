@@ -0,0 +1,233 @@
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <map>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "BFER_std_threads.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::simulation;
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::launch_pipeline()
+{
+	// the chains are bound sequentially, the sockets of the decoding stage are then re-bound on the queues
+	for (auto tid = 0; tid < this->params_BFER_std.n_threads; tid++)
+	{
+		this->sockets_binding (tid);
+		this->pipeline_binding(tid);
+	}
+
+	// launch the generation threads and the decoding threads (the master thread decodes)
+	std::vector<std::thread> threads_gen(this->params_BFER_std.n_threads_gen);
+	for (auto gid = 0; gid < this->params_BFER_std.n_threads_gen; gid++)
+		threads_gen[gid] = std::thread(BFER_std_threads<B,R,Q>::start_thread_pipeline, this, gid, true);
+
+	std::vector<std::thread> threads_dec(this->params_BFER_std.n_threads -1);
+	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
+		threads_dec[tid -1] = std::thread(BFER_std_threads<B,R,Q>::start_thread_pipeline, this, tid, false);
+
+	BFER_std_threads<B,R,Q>::start_thread_pipeline(this, 0, false);
+
+	for (auto tid = 1; tid < this->params_BFER_std.n_threads; tid++)
+		threads_dec[tid -1].join();
+	for (auto gid = 0; gid < this->params_BFER_std.n_threads_gen; gid++)
+		threads_gen[gid].join();
+
+	if (!this->prev_err_messages.empty())
+		throw std::runtime_error(this->prev_err_messages.back());
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::pipeline_binding(const int tid)
+{
+	const auto gid = this->generation_chain(tid);
+
+	auto tasks_gen = this->sequence_gen[gid]->get_tasks();
+	auto tasks_dec = this->sequence_dec[tid]->get_tasks();
+	const auto &tasks_gen_bypassed = this->sequence_gen[gid]->get_tasks_bypassed();
+	const auto &tasks_dec_bypassed = this->sequence_dec[tid]->get_tasks_bypassed();
+	tasks_gen.insert(tasks_gen.end(), tasks_gen_bypassed.begin(), tasks_gen_bypassed.end());
+	tasks_dec.insert(tasks_dec.end(), tasks_dec_bypassed.begin(), tasks_dec_bypassed.end());
+
+	// look for the sockets of the decoding stage which point on a buffer of the generation stage (the outputs of the
+	// bypassed tasks are aliases of their inputs and have to follow them)
+	std::map<std::pair<size_t,size_t>, std::vector<module::Socket*>> groups;
+	for (auto *t : tasks_dec)
+	{
+		const auto is_bypassed = std::find(tasks_dec_bypassed.begin(), tasks_dec_bypassed.end(), t) !=
+		                         tasks_dec_bypassed.end();
+
+		for (auto *s : t->sockets)
+		{
+			if (t->get_socket_type(*s) == module::OUT && !is_bypassed)
+				continue;
+
+			auto found = false;
+			for (size_t k = 0; k < tasks_gen.size() && !found; k++)
+				for (size_t ss = 0; ss < tasks_gen[k]->sockets.size() && !found; ss++)
+					if (tasks_gen[k]->sockets[ss]->get_dataptr() == s->get_dataptr())
+					{
+						groups[std::make_pair(k, ss)].push_back(s);
+						found = true;
+					}
+		}
+	}
+
+	// all the chains have the same structure, the crossing buffers are the same
+	std::vector<size_t> buffers_bytes;
+	std::vector<std::pair<size_t,size_t>> crossing;
+	this->crossing_sockets[tid].clear();
+	for (auto &g : groups)
+	{
+		crossing.push_back(g.first);
+		buffers_bytes.push_back(tasks_gen[g.first.first]->sockets[g.first.second]->get_databytes());
+		this->crossing_sockets[tid].push_back(g.second);
+	}
+
+	if (tid == 0)
+		this->crossing = crossing;
+	else if (crossing != this->crossing)
+	{
+		std::stringstream message;
+		message << "The communication chains do not share the same structure ('tid' = " << tid << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the frames in the queue of the previous SNR are dropped
+	if (this->ring[tid] != nullptr) delete this->ring[tid];
+	this->ring[tid] = new tools::Ring_buffer(buffers_bytes);
+
+	// unbind from the generation stage, the decoding thread binds its sockets on the queue slots from now
+	auto &slot = this->ring[tid]->get_slot_pop();
+	for (size_t b = 0; b < slot.size(); b++)
+		for (auto *s : this->crossing_sockets[tid][b])
+			s->bind((void*)slot[b].data());
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::generation_loop(const int gid)
+{
+	auto &sequence = *this->sequence_gen[gid];
+
+	auto tasks = sequence.get_tasks();
+	const auto &tasks_bypassed = sequence.get_tasks_bypassed();
+	tasks.insert(tasks.end(), tasks_bypassed.begin(), tasks_bypassed.end());
+
+	std::vector<const uint8_t*> buffers;
+	std::vector<size_t> buffers_bytes;
+	for (auto &c : this->crossing)
+	{
+		buffers      .push_back((const uint8_t*)tasks[c.first]->sockets[c.second]->get_dataptr  ());
+		buffers_bytes.push_back(                tasks[c.first]->sockets[c.second]->get_databytes());
+	}
+
+	// the decoding threads fed by this generation thread
+	std::vector<tools::Ring_buffer*> rings;
+	for (auto tid = gid; tid < this->params_BFER_std.n_threads; tid += this->params_BFER_std.n_threads_gen)
+		rings.push_back(this->ring[tid]);
+
+	using namespace std::chrono;
+	auto t_snr = steady_clock::now();
+
+	size_t r = 0;
+	while (!this->is_done(-1, t_snr))
+	{
+		sequence.exec();
+
+		// give the frame to the next decoding thread which has room in its queue
+		auto pushed = false;
+		while (!pushed && !this->is_done(-1, t_snr))
+		{
+			for (size_t n = 0; n < rings.size() && !pushed; n++, r = (r +1) % rings.size())
+				if (!rings[r]->is_full())
+				{
+					auto &slot = rings[r]->get_slot_push();
+					for (size_t b = 0; b < buffers.size(); b++)
+						std::copy(buffers[b], buffers[b] + buffers_bytes[b], slot[b].begin());
+					rings[r]->push();
+					pushed = true;
+				}
+
+			if (!pushed)
+				std::this_thread::yield();
+		}
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::decoding_loop(const int tid)
+{
+	auto &monitor  = *this->monitor     [tid];
+	auto &sequence = *this->sequence_dec[tid];
+	auto &ring     = *this->ring        [tid];
+	auto &crossing_sockets = this->crossing_sockets[tid];
+
+	using namespace module;
+	using namespace std::chrono;
+	auto t_snr = steady_clock::now();
+
+	while (!this->is_done(tid, t_snr))
+	{
+		if (ring.is_empty())
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		// the decoding stage works directly in the queue slot
+		auto &slot = ring.get_slot_pop();
+		for (size_t b = 0; b < slot.size(); b++)
+			for (auto *s : crossing_sockets[b])
+				s->bind((void*)slot[b].data());
+
+		if (this->params_BFER_std.debug)
+		{
+			if (!monitor[mnt::tsk::check_errors].get_n_calls())
+				std::cout << "#" << std::endl;
+
+			std::cout << "# -------------------------------" << std::endl;
+			std::cout << "# New communication (n°" << monitor[mnt::tsk::check_errors].get_n_calls() << ")" << std::endl;
+			std::cout << "# -------------------------------" << std::endl;
+			std::cout << "#" << std::endl;
+		}
+
+		sequence.exec();
+		ring.pop();
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::launch_pipeline();
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::pipeline_binding(const int);
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::generation_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::decoding_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::launch_pipeline();
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::pipeline_binding(const int);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::generation_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::decoding_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::launch_pipeline();
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::pipeline_binding(const int);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::generation_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::decoding_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::launch_pipeline();
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::pipeline_binding(const int);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::generation_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::decoding_loop(const int);
+#else
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::launch_pipeline();
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::pipeline_binding(const int);
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::generation_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::decoding_loop(const int);
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,471 @@
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+
+#include "Tools/general_utils.h"
+#include "Tools/system_functions.h"
+#include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Display/Timeline/Timeline.hpp"
+#include "Tools/Display/bash_tools.h"
+
+#include "Factory/Tools/Display/Terminal/BFER/Terminal_BFER.hpp"
+
+#include "BFER_std_threads.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::simulation;
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::launch_sweep()
+{
+	const auto &params = this->params_BFER_std;
+
+	this->terminal = this->build_terminal();
+
+	this->build_communication_chain();
+
+	if (module::Monitor::is_over())
+	{
+		this->release_objects();
+		return;
+	}
+
+	// each SNR point has its own monitors, the chain of a thread is bound on the ones of its current point
+	for (auto snr = params.snr_min; snr <= params.snr_max; snr += params.snr_step)
+	{
+		auto p = new snr_point();
+
+		if (params.snr_type == "EB")
+		{
+			p->snr_b = snr;
+			p->snr_s = tools::ebn0_to_esn0(p->snr_b, this->bit_rate, params.mdm->bps);
+		}
+		else // if (params.snr_type == "ES")
+		{
+			p->snr_s = snr;
+			p->snr_b = tools::esn0_to_ebn0(p->snr_s, this->bit_rate, params.mdm->bps);
+		}
+		p->sigma = tools::esn0_to_sigma(p->snr_s, params.mdm->upf);
+
+		for (auto tid = 0; tid < params.n_threads; tid++)
+		{
+			auto m = this->build_monitor(tid);
+			for (size_t t = 0; t < m->tasks.size(); t++)
+			{
+				m->tasks[t]->set_autoalloc(this->monitor[tid]->tasks[t]->is_autoalloc());
+				m->tasks[t]->set_stats    (this->monitor[tid]->tasks[t]->is_stats    ());
+				m->tasks[t]->set_perf     (this->monitor[tid]->tasks[t]->is_perf     ());
+				m->tasks[t]->set_fast     (this->monitor[tid]->tasks[t]->is_fast     ());
+			}
+			m->set_is_weights(this->monitor[tid]->get_is_weights());
+			// the decoder reset and the interleaver refresh follow each checked frame as in the sequential sweep (with
+			// the common random numbers, a frame is checked once per point and the crn_loop calls them once per frame)
+			if (!params.crn)
+				m->add_handlers(*this->monitor[tid]);
+			p->monitor.push_back(m);
+		}
+
+		p->monitor_red = new module::Monitor_BFER_reduction<B>(p->monitor);
+		p->terminal    = nullptr;
+		p->n_threads   = 0;
+		p->started     = false;
+		p->done        = false;
+		p->reported    = false;
+
+		this->points.push_back(p);
+	}
+
+	if (!params.ter->disabled)
+		this->terminal->legend(std::cout);
+
+	if (params.crn)
+	{
+		// all the points are started at once, each thread works on all of them
+		for (auto *p : this->points)
+		{
+			p->started   = true;
+			p->t_start   = std::chrono::steady_clock::now();
+			p->n_threads = params.n_threads;
+
+			if (!params.ter->disabled)
+			{
+				p->terminal = factory::Terminal_BFER::build<B>(*params.ter, *p->monitor_red);
+				p->terminal->set_esn0(p->snr_s);
+				p->terminal->set_ebn0(p->snr_b);
+			}
+		}
+		this->n_started = this->points.size();
+	}
+	else
+		// the first points are shared between the threads
+		for (auto tid = 0; tid < params.n_threads; tid++)
+			this->points_thread[tid] = this->switch_point(tid, nullptr);
+
+	const auto start_thread = params.crn ? BFER_std_threads<B,R,Q>::start_thread_crn :
+	                                       BFER_std_threads<B,R,Q>::start_thread_sweep;
+
+	// the live display of the running points replaces the temporary report of the sequential sweep
+	std::thread live;
+	this->sweep_over = false;
+	if (!params.ter->disabled && params.ter->frequency != std::chrono::nanoseconds(0))
+		live = std::thread(&BFER_std_threads<B,R,Q>::live_loop, this);
+
+	std::vector<std::thread> threads(params.n_threads -1);
+	for (auto tid = 1; tid < params.n_threads; tid++)
+		threads[tid -1] = std::thread(start_thread, this, tid);
+
+	start_thread(this, 0);
+
+	for (auto tid = 1; tid < params.n_threads; tid++)
+		threads[tid -1].join();
+
+	if (live.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->mutex_points);
+			this->sweep_over = true;
+		}
+		this->cond_points.notify_all();
+		live.join();
+	}
+
+	this->display_reports(true);
+
+	if (!this->prev_err_messages.empty())
+	{
+		std::cerr << tools::apply_on_each_line(tools::addr2line(this->prev_err_messages.back()), &tools::format_error)
+		          << std::endl;
+		this->simu_error = true;
+	}
+
+	if (params.statistics && !params.ter->disabled && !this->simu_error)
+	{
+		std::vector<std::vector<const module::Module*>> mod_vec;
+		for (auto &vm : this->modules)
+		{
+			std::vector<const module::Module*> sub_mod_vec;
+			for (auto *m : vm.second)
+				sub_mod_vec.push_back(m);
+			mod_vec.push_back(sub_mod_vec);
+		}
+
+		std::cout << "#" << std::endl;
+		tools::Stats::show(mod_vec, true, std::cout);
+		std::cout << "#" << std::endl;
+	}
+
+	// the timeline of the sweep is not split by SNR point
+	if (!params.trace_path.empty())
+		tools::Timeline::flush(params.trace_path + "_sweep.json");
+
+	this->release_objects();
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::sweep_loop(const int tid, snr_point &point)
+{
+	auto &sequence = *this->sequence[tid];
+
+	while (!this->is_done(point, tid))
+		sequence.exec();
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::crn_loop(const int tid)
+{
+	using namespace module;
+
+	auto &chn          = *this->channel     [tid];
+	auto &mnt          = *this->monitor     [tid];
+	auto &sequence_gen = *this->sequence_gen[tid];
+	auto &sequence_dec = *this->sequence_dec[tid];
+
+	const auto X_N = static_cast<const R*>(chn[chn::tsk::add_noise   ][chn::sck::add_noise   ::X_N].get_dataptr());
+	const auto Y_N = static_cast<      R*>(chn[chn::tsk::add_noise   ][chn::sck::add_noise   ::Y_N].get_dataptr());
+	const auto U   = static_cast<const B*>(mnt[mnt::tsk::check_errors][mnt::sck::check_errors::U  ].get_dataptr());
+	const auto V   = static_cast<const B*>(mnt[mnt::tsk::check_errors][mnt::sck::check_errors::V  ].get_dataptr());
+	const auto &noise = chn.get_noise();
+
+	std::vector<snr_point*> running = this->points;
+	while (true)
+	{
+		// a thread leaves a point as soon as the point is over from its point of view
+		for (auto p = running.begin(); p != running.end();)
+			if (this->is_done(**p, tid))
+			{
+				this->leave_point(**p);
+				p = running.erase(p);
+			}
+			else
+				p++;
+
+		if (running.empty())
+			break;
+
+		// source, encoder, modulation and noise are shared by all the points
+		chn.set_sigma(1.f);
+		sequence_gen.exec();
+
+		for (auto *p : running)
+		{
+			const auto sigma = (R)p->sigma;
+			for (size_t i = 0; i < noise.size(); i++)
+				Y_N[i] = X_N[i] + sigma * noise[i];
+
+			this->set_sigma(p->sigma, tid);
+			sequence_dec.exec();
+			p->monitor[tid]->check_errors(U, V);
+			this->codec[tid]->reset();
+		}
+
+		// the handlers of the chain (refresh of the uniform interleavers, ...) are called once per generated frame
+		mnt[mnt::tsk::check_errors].exec();
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::leave_point(snr_point &point)
+{
+	std::lock_guard<std::mutex> lock(this->mutex_points);
+
+	point.n_threads--;
+	point.done = true;
+
+	// the last thread leaving the point displays its results
+	if (point.n_threads == 0 && !point.reported)
+	{
+		if (point.terminal != nullptr)
+			point.terminal->final_report(point.report);
+		point.reported = true;
+
+		this->display_reports();
+	}
+}
+
+template <typename B, typename R, typename Q>
+typename BFER_std_threads<B,R,Q>::snr_point* BFER_std_threads<B,R,Q>
+::switch_point(const int tid, snr_point *previous)
+{
+	std::lock_guard<std::mutex> lock(this->mutex_points);
+
+	if (previous != nullptr)
+	{
+		previous->n_threads--;
+		if (this->is_done(*previous))
+			previous->done = true;
+
+		// the last thread leaving the point displays its results
+		if (previous->done && previous->n_threads == 0 && !previous->reported)
+		{
+			// as in the sequential sweep, the points after one which did not reach the frame errors limit are skipped
+			if (!module::Monitor::is_interrupt() && !previous->monitor_red->fe_limit_achieved())
+				this->sweep_stopped = true;
+
+			if (previous->terminal != nullptr)
+				previous->terminal->final_report(previous->report);
+			previous->reported = true;
+
+			this->display_reports();
+		}
+	}
+
+	// an interruption (ctrl+c) stops the whole sweep
+	if (module::Monitor::is_interrupt() || this->sweep_stopped)
+		return nullptr;
+
+	std::vector<snr_point*> running;
+	for (size_t p = 0; p < this->n_started; p++)
+		if (!this->points[p]->done)
+		{
+			if (this->is_done(*this->points[p]))
+				this->points[p]->done = true;
+			else
+				running.push_back(this->points[p]);
+		}
+
+	snr_point *next = nullptr;
+	if ((int)running.size() < this->params_BFER_std.n_snr_groups && this->n_started < this->points.size())
+	{
+		// start the next SNR point
+		next = this->points[this->n_started++];
+		next->started = true;
+		next->t_start = std::chrono::steady_clock::now();
+
+		if (!this->params_BFER_std.ter->disabled)
+		{
+			next->terminal = factory::Terminal_BFER::build<B>(*this->params_BFER_std.ter, *next->monitor_red);
+			next->terminal->set_esn0(next->snr_s);
+			next->terminal->set_ebn0(next->snr_b);
+		}
+	}
+	else if (!running.empty())
+	{
+		if (this->n_started < this->points.size())
+		{
+			// balance the threads between the running points (the highest SNR first)
+			next = running.back();
+			for (auto *p : running)
+				if (p->n_threads < next->n_threads)
+					next = p;
+		}
+		else
+			// all the points have been started: help the slowest one (the highest SNR)
+			next = running.back();
+	}
+
+	if (next != nullptr)
+		next->n_threads++;
+
+	return next;
+}
+
+template <typename B, typename R, typename Q>
+bool BFER_std_threads<B,R,Q>
+::is_done(snr_point &point, const int tid)
+{
+	using namespace std::chrono;
+
+	// the simulation threads read the flag of the reduction, the points switching aggregates all the counters
+	const auto fe_done = tid >= 0 ? point.monitor_red->is_done(tid) : point.monitor_red->fe_limit_achieved();
+
+	return fe_done || // the max frame error count has been reached
+	       (this->params_BFER_std.stop_time != seconds(0) &&
+	       (steady_clock::now() - point.t_start) >= this->params_BFER_std.stop_time);
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::display_reports(const bool all)
+{
+	// the final lines overwrite the live display
+	if (this->n_live_lines && this->n_displayed < this->n_started)
+	{
+		if (tools::enable_bash_tools)
+			std::clog << "\033[J";
+		this->n_live_lines = 0;
+	}
+
+	// the results are displayed in the SNR order, a point waits for the lower ones
+	for (; this->n_displayed < this->n_started; this->n_displayed++)
+	{
+		auto *p = this->points[this->n_displayed];
+		if (!p->reported)
+		{
+			if (!all)
+				break;
+
+			if (p->terminal != nullptr)
+				p->terminal->final_report(p->report);
+			p->reported = true;
+		}
+
+		std::cout << p->report.str();
+		std::cout.flush();
+	}
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::display_live()
+{
+	// one line per running point below the final lines, the cursor goes back to the first one after the display (the
+	// cursor moves need the bash tools, otherwise only the lowest running point is displayed)
+	std::stringstream live;
+	size_t n_lines = 0;
+	for (auto p = this->n_displayed; p < this->n_started; p++)
+	{
+		auto *point = this->points[p];
+		if (point->reported || point->terminal == nullptr)
+			continue;
+
+		if (n_lines)
+		{
+			if (!tools::enable_bash_tools)
+				break;
+			live << std::endl;
+		}
+		point->terminal->temp_report(live);
+		n_lines++;
+	}
+
+	if (tools::enable_bash_tools)
+	{
+		std::clog << "\033[J" << live.str();
+		if (n_lines > 1)
+			std::clog << "\033[" << (n_lines -1) << "A";
+	}
+	else
+		std::clog << live.str();
+	std::clog.flush();
+
+	this->n_live_lines = n_lines;
+}
+
+template <typename B, typename R, typename Q>
+void BFER_std_threads<B,R,Q>
+::live_loop()
+{
+	const auto freq = this->params_BFER_std.ter->frequency;
+
+	std::unique_lock<std::mutex> lock(this->mutex_points);
+	while (!this->sweep_over)
+		if (this->cond_points.wait_for(lock, freq) == std::cv_status::timeout)
+			this->display_live();
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::launch_sweep();
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::sweep_loop(const int, snr_point&);
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::crn_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::leave_point(snr_point&);
+template aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::snr_point* aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::switch_point(const int, snr_point*);
+template bool aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::is_done(snr_point&, const int);
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::display_reports(const bool);
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::display_live();
+template void aff3ct::simulation::BFER_std_threads<B_8 ,R_8 ,Q_8 >::live_loop();
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::launch_sweep();
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::sweep_loop(const int, snr_point&);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::crn_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::leave_point(snr_point&);
+template aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::snr_point* aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::switch_point(const int, snr_point*);
+template bool aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::is_done(snr_point&, const int);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::display_reports(const bool);
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::display_live();
+template void aff3ct::simulation::BFER_std_threads<B_16,R_16,Q_16>::live_loop();
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::launch_sweep();
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::sweep_loop(const int, snr_point&);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::crn_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::leave_point(snr_point&);
+template aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::snr_point* aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::switch_point(const int, snr_point*);
+template bool aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::is_done(snr_point&, const int);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::display_reports(const bool);
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::display_live();
+template void aff3ct::simulation::BFER_std_threads<B_32,R_32,Q_32>::live_loop();
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::launch_sweep();
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::sweep_loop(const int, snr_point&);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::crn_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::leave_point(snr_point&);
+template aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::snr_point* aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::switch_point(const int, snr_point*);
+template bool aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::is_done(snr_point&, const int);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::display_reports(const bool);
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::display_live();
+template void aff3ct::simulation::BFER_std_threads<B_64,R_64,Q_64>::live_loop();
+#else
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::launch_sweep();
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::sweep_loop(const int, snr_point&);
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::crn_loop(const int);
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::leave_point(snr_point&);
+template aff3ct::simulation::BFER_std_threads<B,R,Q>::snr_point* aff3ct::simulation::BFER_std_threads<B,R,Q>::switch_point(const int, snr_point*);
+template bool aff3ct::simulation::BFER_std_threads<B,R,Q>::is_done(snr_point&, const int);
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::display_reports(const bool);
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::display_live();
+template void aff3ct::simulation::BFER_std_threads<B,R,Q>::live_loop();
+#endif
+// ==================================================================================== explicit template instantiation
@@ -1,11 +1,16 @@
 #if !defined(PREC_8_BIT) && !defined(PREC_16_BIT)
 
 #include <cmath>
+#include <thread>
+#include <sstream>
+#include <iomanip>
 #include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Threads/Thread_pinning.hpp"
 #include "Tools/Display/bash_tools.h"
 #include "Tools/Display/Statistics/Statistics.hpp"
+#include "Tools/Display/Timeline/Timeline.hpp"
 #include "Tools/general_utils.h"
 #include "Tools/Math/utils.h"
 
@@ -25,23 +30,35 @@ EXIT<B,R>
   ebn0 (0.f),
   esn0 (0.f),
 
-  source   (nullptr),
-  codec    (nullptr),
-  modem    (nullptr),
-  modem_a  (nullptr),
-  channel  (nullptr),
-  channel_a(nullptr),
-  siso     (nullptr),
-  monitor  (nullptr),
-  terminal (nullptr)
+  rd_engine_seed(params_EXIT.n_threads),
+
+  source     (params_EXIT.n_threads, nullptr),
+  codec      (params_EXIT.n_threads, nullptr),
+  modem      (params_EXIT.n_threads, nullptr),
+  modem_a    (params_EXIT.n_threads, nullptr),
+  channel    (params_EXIT.n_threads, nullptr),
+  channel_a  (params_EXIT.n_threads, nullptr),
+  monitor    (params_EXIT.n_threads, nullptr),
+  monitor_red(                       nullptr),
+  terminal   (                       nullptr),
+
+  sequence     (params_EXIT.n_threads, nullptr),
+  sequence_no_a(params_EXIT.n_threads, nullptr)
 {
 #ifdef ENABLE_MPI
 	std::clog << tools::format_warning("This simulation is not MPI ready, the same computations will be launched "
 	                                   "on each MPI processes.") << std::endl;
 #endif
 
-	if (params_EXIT.n_threads > 1)
-		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "EXIT simu does not support the multi-threading.");
+	if (params_EXIT.n_threads < 1)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << params_EXIT.n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+		rd_engine_seed[tid].seed(params_EXIT.local_seed + tid);
 
 	this->modules["source"   ] = std::vector<module::Module*>(params_EXIT.n_threads, nullptr);
 	this->modules["codec"    ] = std::vector<module::Module*>(params_EXIT.n_threads, nullptr);
@@ -53,17 +70,24 @@ EXIT<B,R>
 	this->modules["channel_a"] = std::vector<module::Module*>(params_EXIT.n_threads, nullptr);
 	this->modules["monitor"  ] = std::vector<module::Module*>(params_EXIT.n_threads, nullptr);
 
-	this->monitor = this->build_monitor();
+	for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+	{
+		this->monitor[tid] = this->build_monitor(tid);
+		this->modules["monitor"][tid] = this->monitor[tid];
+	}
 
-	this->modules["monitor"][0] = this->monitor;
+	this->monitor_red = new module::Monitor_EXIT_reduction<B,R>(this->monitor);
 }
 
 template <typename B, typename R>
 EXIT<B,R>
 ::~EXIT()
 {
-	if (monitor != nullptr) { delete monitor; monitor = nullptr; }
 	release_objects();
+
+	if (monitor_red != nullptr) { delete monitor_red; monitor_red = nullptr; }
+	for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+		if (monitor[tid] != nullptr) { delete monitor[tid]; monitor[tid] = nullptr; }
 }
 
 template <typename B, typename R>
@@ -72,34 +96,47 @@ void EXIT<B,R>
 {
 	release_objects();
 
-	const auto N_mod = params_EXIT.mdm->N_mod;
-	const auto K_mod = factory::Modem::get_buffer_size_after_modulation(params_EXIT.mdm->type,
-	                                                                    params_EXIT.cdc->K,
-	                                                                    params_EXIT.mdm->bps,
-	                                                                    params_EXIT.mdm->upf,
-	                                                                    params_EXIT.mdm->cpm_L);
+	// build the communication chain in multi-threaded mode
+	std::vector<std::thread> threads(params_EXIT.n_threads -1);
+	for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+		threads[tid -1] = std::thread(EXIT<B,R>::start_thread_build_comm_chain, this, tid);
 
+	EXIT<B,R>::start_thread_build_comm_chain(this, 0);
+
+	// join the slave threads with the master thread
+	for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+		threads[tid -1].join();
+
+	if (!this->prev_err_messages.empty())
+		throw std::runtime_error(this->prev_err_messages.back());
+
+	terminal = build_terminal();
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::__build_communication_chain(const int tid)
+{
 	// build the objects
-	source    = build_source   (     );
-	codec     = build_codec    (     );
-	modem     = build_modem    (     );
-	modem_a   = build_modem_a  (     );
-	channel   = build_channel  (N_mod);
-	channel_a = build_channel_a(K_mod);
-	terminal  = build_terminal (     );
-
-	this->modules["source"   ][0] = source;
-	this->modules["codec"    ][0] = codec;
-	this->modules["encoder"  ][0] = codec->get_encoder();
-	this->modules["decoder"  ][0] = codec->get_decoder_siso();
-	this->modules["modem"    ][0] = modem;
-	this->modules["modem_a"  ][0] = modem_a;
-	this->modules["channel"  ][0] = channel;
-	this->modules["channel_a"][0] = channel_a;
-
-	this->monitor->add_handler_measure(std::bind(&module::Codec_SISO<B,R>::reset, codec));
-
-	if (codec->get_decoder_siso()->get_n_frames() > 1)
+	source   [tid] = build_source   (tid);
+	codec    [tid] = build_codec    (tid);
+	modem    [tid] = build_modem    (tid);
+	modem_a  [tid] = build_modem_a  (tid);
+	channel  [tid] = build_channel  (tid);
+	channel_a[tid] = build_channel_a(tid);
+
+	this->modules["source"   ][tid] = source   [tid];
+	this->modules["codec"    ][tid] = codec    [tid];
+	this->modules["encoder"  ][tid] = codec    [tid]->get_encoder();
+	this->modules["decoder"  ][tid] = codec    [tid]->get_decoder_siso();
+	this->modules["modem"    ][tid] = modem    [tid];
+	this->modules["modem_a"  ][tid] = modem_a  [tid];
+	this->modules["channel"  ][tid] = channel  [tid];
+	this->modules["channel_a"][tid] = channel_a[tid];
+
+	this->monitor[tid]->add_handler_measure(std::bind(&module::Codec_SISO<B,R>::reset, codec[tid]));
+
+	if (codec[tid]->get_decoder_siso()->get_n_frames() > 1)
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, "The inter frame is not supported.");
 }
 
@@ -109,7 +146,15 @@ void EXIT<B,R>
 {
 	// allocate and build all the communication chain to generate EXIT chart
 	this->build_communication_chain();
-	this->sockets_binding();
+
+	if (module::Monitor::is_over())
+	{
+		this->release_objects();
+		return;
+	}
+
+	for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+		this->sockets_binding(tid);
 
 	// for each channel SNR to be simulated	
 	for (ebn0 = params_EXIT.snr_min; ebn0 <= params_EXIT.snr_max; ebn0 += params_EXIT.snr_step)
@@ -122,32 +167,39 @@ void EXIT<B,R>
 		terminal->set_esn0(esn0);
 		terminal->set_ebn0(ebn0);
 
-		channel->set_sigma(sigma);
-		modem  ->set_sigma(sigma);
-		codec  ->set_sigma(sigma);
+		for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
+		{
+			channel[tid]->set_sigma(sigma);
+			modem  [tid]->set_sigma(sigma);
+			codec  [tid]->set_sigma(sigma);
+		}
 
 		// for each "a" standard deviation (sig_a) to be simulated
 		using namespace module;
 		for (sig_a = params_EXIT.sig_a_min; sig_a <= params_EXIT.sig_a_max; sig_a += params_EXIT.sig_a_step)
 		{
-			terminal ->set_sig_a(sig_a      );
-			channel_a->set_sigma(2.f / sig_a);
-			modem_a  ->set_sigma(2.f / sig_a);
+			terminal->set_sig_a(sig_a);
 
-			if (sig_a == 0.f) // if sig_a = 0, La_K2 = 0
+			for (auto tid = 0; tid < params_EXIT.n_threads; tid++)
 			{
-				auto &mdm = *this->modem_a;
-				if (params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos)
-				{
-					auto mdm_data  = (uint8_t*)(mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2].get_dataptr());
-					auto mdm_bytes =            mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2].get_databytes();
-					std::fill(mdm_data, mdm_data + mdm_bytes, 0);
-				}
-				else
+				channel_a[tid]->set_sigma(2.f / sig_a);
+				modem_a  [tid]->set_sigma(2.f / sig_a);
+
+				if (sig_a == 0.f) // if sig_a = 0, La_K2 = 0
 				{
-					auto mdm_data  = (uint8_t*)(mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2].get_dataptr());
-					auto mdm_bytes =            mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2].get_databytes();
-					std::fill(mdm_data, mdm_data + mdm_bytes, 0);
+					auto &mdm = *this->modem_a[tid];
+					if (params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos)
+					{
+						auto mdm_data  = (uint8_t*)(mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2].get_dataptr());
+						auto mdm_bytes =            mdm[mdm::tsk::demodulate_wg][mdm::sck::demodulate_wg::Y_N2].get_databytes();
+						std::fill(mdm_data, mdm_data + mdm_bytes, 0);
+					}
+					else
+					{
+						auto mdm_data  = (uint8_t*)(mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2].get_dataptr());
+						auto mdm_bytes =            mdm[mdm::tsk::demodulate][mdm::sck::demodulate::Y_N2].get_databytes();
+						std::fill(mdm_data, mdm_data + mdm_bytes, 0);
+					}
 				}
 			}
 
@@ -160,7 +212,23 @@ void EXIT<B,R>
 				!params_EXIT.debug)
 				this->terminal->start_temp_report(params_EXIT.ter->frequency);
 
-			this->simulation_loop();
+			// launch a group of slave threads (there is "n_threads -1" slave threads)
+			std::vector<std::thread> threads(params_EXIT.n_threads -1);
+			for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+				threads[tid -1] = std::thread(EXIT<B,R>::start_thread, this, tid);
+
+			// launch the master thread
+			EXIT<B,R>::start_thread(this, 0);
+
+			// join the slave threads with the master thread
+			for (auto tid = 1; tid < params_EXIT.n_threads; tid++)
+				threads[tid -1].join();
+
+			if (!this->prev_err_messages.empty())
+			{
+				this->terminal->stop_temp_report();
+				throw std::runtime_error(this->prev_err_messages.back());
+			}
 
 			if (!params_EXIT.ter->disabled)
 			{
@@ -186,7 +254,15 @@ void EXIT<B,R>
 				}
 			}
 
-			this->monitor->reset();
+			if (!params_EXIT.trace_path.empty())
+			{
+				std::stringstream s_snr;
+				s_snr << std::setprecision(2) << std::fixed << ebn0 << "_" << sig_a;
+
+				tools::Timeline::flush(params_EXIT.trace_path + "_" + s_snr.str() + ".json");
+			}
+
+			this->monitor_red->reset();
 			for (auto &m : modules)
 				for (auto mm : m.second)
 					if (mm != nullptr)
@@ -204,17 +280,17 @@ void EXIT<B,R>
 
 template <typename B, typename R>
 void EXIT<B,R>
-::sockets_binding()
+::sockets_binding(const int tid)
 {
-	auto &src = *this->source;
-	auto &cdc = *this->codec;
-	auto &enc = *this->codec->get_encoder();
-	auto &dec = *this->codec->get_decoder_siso();
-	auto &mdm = *this->modem;
-	auto &mda = *this->modem_a;
-	auto &chn = *this->channel;
-	auto &cha = *this->channel_a;
-	auto &mnt = *this->monitor;
+	auto &src = *this->source   [tid];
+	auto &cdc = *this->codec    [tid];
+	auto &enc = *this->codec    [tid]->get_encoder();
+	auto &dec = *this->codec    [tid]->get_decoder_siso();
+	auto &mdm = *this->modem    [tid];
+	auto &mda = *this->modem_a  [tid];
+	auto &chn = *this->channel  [tid];
+	auto &cha = *this->channel_a[tid];
+	auto &mnt = *this->monitor  [tid];
 
 	using namespace module;
 
@@ -259,25 +335,30 @@ void EXIT<B,R>
 
 	cdc[cdc::tsk::extract_sys_llr  ][cdc::sck::extract_sys_llr  ::Y_N   ](dec[dec::tsk::decode_siso    ][dec::sck::decode_siso    ::Y_N2]);
 	mnt[mnt::tsk::check_mutual_info][mnt::sck::check_mutual_info::llrs_e](cdc[cdc::tsk::extract_sys_llr][cdc::sck::extract_sys_llr::Y_K ]);
+
+	// compile the execution plans, if sig_a = 0 there is no noise to add and La_K = 0
+	auto &cha_add_noise  = params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos ? cha[chn::tsk::add_noise_wg ] :
+	                                                                                      cha[chn::tsk::add_noise    ];
+	auto &mda_demodulate = params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos ? mda[mdm::tsk::demodulate_wg] :
+	                                                                                      mda[mdm::tsk::demodulate   ];
+
+	this->sequence     [tid] = new tools::Sequence(src[src::tsk::generate], mnt[mnt::tsk::check_mutual_info]);
+	this->sequence_no_a[tid] = new tools::Sequence({&src[src::tsk::generate]},
+	                                               {&mnt[mnt::tsk::check_mutual_info]},
+	                                               {&cha_add_noise, &mda_demodulate});
 }
 
 template <typename B, typename R>
 void EXIT<B,R>
-::simulation_loop()
+::simulation_loop(const int tid)
 {
-	auto &source    = *this->source;
-	auto &codec     = *this->codec;
-	auto &encoder   = *this->codec->get_encoder();
-	auto &decoder   = *this->codec->get_decoder_siso();
-	auto &modem     = *this->modem;
-	auto &modem_a   = *this->modem_a;
-	auto &channel   = *this->channel;
-	auto &channel_a = *this->channel_a;
-	auto &monitor   = *this->monitor;
+	auto &monitor  = *this->monitor[tid];
+	auto &sequence = sig_a != 0 ? *this->sequence[tid] : *this->sequence_no_a[tid];
 
 	using namespace module;
 
-	while (!monitor.n_trials_achieved())
+	// the stop criterion is evaluated on the frames of all the threads
+	while (!this->monitor_red->n_trials_achieved())
 	{
 		if (params_EXIT.debug)
 		{
@@ -290,43 +371,7 @@ void EXIT<B,R>
 			std::cout << "#" << std::endl;
 		}
 
-		source [src::tsk::generate].exec();
-		modem_a[mdm::tsk::modulate].exec();
-		encoder[enc::tsk::encode  ].exec();
-		modem  [mdm::tsk::modulate].exec();
-
-		//if sig_a = 0, La_K = 0, no noise to add
-		if (sig_a != 0)
-		{
-			// Rayleigh channel
-			if (params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos)
-			{
-				channel_a[chn::tsk::add_noise_wg ].exec();
-				modem_a  [mdm::tsk::demodulate_wg].exec();
-			}
-			else // additive channel (AWGN, USER, NO)
-			{
-				channel_a[chn::tsk::add_noise ].exec();
-				modem_a  [mdm::tsk::demodulate].exec();
-			}
-		}
-
-		// Rayleigh channel
-		if (params_EXIT.chn->type.find("RAYLEIGH") != std::string::npos)
-		{
-			channel[chn::tsk::add_noise_wg ].exec();
-			modem  [mdm::tsk::demodulate_wg].exec();
-		}
-		else // additive channel (AWGN, USER, NO)
-		{
-			channel[chn::tsk::add_noise ].exec();
-			modem  [mdm::tsk::demodulate].exec();
-		}
-
-		codec  [cdc::tsk::add_sys_ext      ].exec();
-		decoder[dec::tsk::decode_siso      ].exec();
-		codec  [cdc::tsk::extract_sys_llr  ].exec();
-		monitor[mnt::tsk::check_mutual_info].exec();
+		sequence.exec();
 	}
 }
 
@@ -334,39 +379,54 @@ template <typename B, typename R>
 void EXIT<B,R>
 ::release_objects()
 {
-	if (source    != nullptr) { delete source;    source    = nullptr; }
-	if (codec     != nullptr) { delete codec;     codec     = nullptr; }
-	if (modem     != nullptr) { delete modem;     modem     = nullptr; }
-	if (modem_a   != nullptr) { delete modem_a;   modem_a   = nullptr; }
-	if (channel   != nullptr) { delete channel;   channel   = nullptr; }
-	if (channel_a != nullptr) { delete channel_a; channel_a = nullptr; }
-	if (terminal  != nullptr) { delete terminal;  terminal  = nullptr; }
+	const auto nthr = params_EXIT.n_threads;
+	for (auto i = 0; i < nthr; i++) if (sequence     [i] != nullptr) { delete sequence     [i]; sequence     [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (sequence_no_a[i] != nullptr) { delete sequence_no_a[i]; sequence_no_a[i] = nullptr; }
+
+	for (auto i = 0; i < nthr; i++) if (source   [i] != nullptr) { delete source   [i]; source   [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (codec    [i] != nullptr) { delete codec    [i]; codec    [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (modem    [i] != nullptr) { delete modem    [i]; modem    [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (modem_a  [i] != nullptr) { delete modem_a  [i]; modem_a  [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (channel  [i] != nullptr) { delete channel  [i]; channel  [i] = nullptr; }
+	for (auto i = 0; i < nthr; i++) if (channel_a[i] != nullptr) { delete channel_a[i]; channel_a[i] = nullptr; }
+
+	if (terminal != nullptr) { delete terminal; terminal = nullptr; }
 }
 
 template <typename B, typename R>
 module::Source<B>* EXIT<B,R>
-::build_source()
+::build_source(const int tid)
 {
-	return params_EXIT.src->template build<B>();
+	auto params_src = params_EXIT.src->clone();
+	params_src->seed = rd_engine_seed[tid]();
+	auto s = params_src->template build<B>();
+	delete params_src;
+	return s;
 }
 
 template <typename B, typename R>
 module::Codec_SISO<B,R>* EXIT<B,R>
-::build_codec()
+::build_codec(const int tid)
 {
-	return params_EXIT.cdc->template build<B,R>();
+	auto params_cdc = params_EXIT.cdc->clone();
+	params_cdc->enc->seed = rd_engine_seed[tid]();
+	if (params_cdc->itl != nullptr && params_cdc->itl->core->uniform)
+		params_cdc->itl->core->seed = rd_engine_seed[tid]();
+	auto c = dynamic_cast<factory::Codec_SISO::parameters*>(params_cdc)->template build<B,R>();
+	delete params_cdc;
+	return c;
 }
 
 template <typename B, typename R>
 module::Modem<B,R,R>* EXIT<B,R>
-::build_modem()
+::build_modem(const int tid)
 {
 	return params_EXIT.mdm->template build<B,R>();
 }
 
 template <typename B, typename R>
 module::Modem<B,R>* EXIT<B,R>
-::build_modem_a()
+::build_modem_a(const int tid)
 {
 	auto mdm_params = params_EXIT.mdm->clone();
 	mdm_params->N   = params_EXIT.cdc->K;
@@ -377,21 +437,26 @@ module::Modem<B,R>* EXIT<B,R>
 
 template <typename B, typename R>
 module::Channel<R>* EXIT<B,R>
-::build_channel(const int size)
+::build_channel(const int tid)
 {
-	return params_EXIT.chn->template build<R>();
+	auto chn_params  = params_EXIT.chn->clone();
+	chn_params->seed = rd_engine_seed[tid]();
+	auto c = chn_params->template build<R>();
+	delete chn_params;
+	return c;
 }
 
 template <typename B, typename R>
 module::Channel<R>* EXIT<B,R>
-::build_channel_a(const int size)
+::build_channel_a(const int tid)
 {
-	auto chn_params = params_EXIT.chn->clone();
-	chn_params->N   = factory::Modem::get_buffer_size_after_modulation(params_EXIT.mdm->type,
-	                                                                   params_EXIT.cdc->K,
-	                                                                   params_EXIT.mdm->bps,
-	                                                                   params_EXIT.mdm->upf,
-	                                                                   params_EXIT.mdm->cpm_L);
+	auto chn_params  = params_EXIT.chn->clone();
+	chn_params->seed = rd_engine_seed[tid]();
+	chn_params->N    = factory::Modem::get_buffer_size_after_modulation(params_EXIT.mdm->type,
+	                                                                    params_EXIT.cdc->K,
+	                                                                    params_EXIT.mdm->bps,
+	                                                                    params_EXIT.mdm->upf,
+	                                                                    params_EXIT.mdm->cpm_L);
 
 	auto c = chn_params->template build<R>();
 	delete chn_params;
@@ -400,7 +465,7 @@ module::Channel<R>* EXIT<B,R>
 
 template <typename B, typename R>
 module::Monitor_EXIT<B,R>* EXIT<B,R>
-::build_monitor()
+::build_monitor(const int tid)
 {
 	return params_EXIT.mnt->template build<B,R>();
 }
@@ -409,7 +474,61 @@ template <typename B, typename R>
 tools::Terminal_EXIT<B,R>* EXIT<B,R>
 ::build_terminal()
 {
-	return params_EXIT.ter->template build<B,R>(*this->monitor);
+	return params_EXIT.ter->template build<B,R>(*this->monitor_red);
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::start_thread_build_comm_chain(EXIT<B,R> *simu, const int tid)
+{
+	try
+	{
+		// the modules and their buffers are first written by the thread which will use them, on its NUMA node
+		if (simu->params_EXIT.pin_threads)
+			tools::Thread_pinning::pin(tid);
+
+		simu->__build_communication_chain(tid);
+	}
+	catch (std::exception const& e)
+	{
+		module::Monitor::stop();
+		simu->simu_error = true;
+
+		simu->mutex_exception.lock();
+		if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), e.what()) == simu->prev_err_messages.end())
+			simu->prev_err_messages.push_back(e.what());
+		simu->mutex_exception.unlock();
+	}
+
+	// the thread 0 is the main thread, the threads it starts later (terminal, ...) must not inherit its core
+	if (simu->params_EXIT.pin_threads)
+		tools::Thread_pinning::unpin();
+}
+
+template <typename B, typename R>
+void EXIT<B,R>
+::start_thread(EXIT<B,R> *simu, const int tid)
+{
+	try
+	{
+		if (simu->params_EXIT.pin_threads)
+			tools::Thread_pinning::pin(tid);
+
+		simu->simulation_loop(tid);
+	}
+	catch (std::exception const& e)
+	{
+		module::Monitor::stop();
+
+		simu->mutex_exception.lock();
+		if (std::find(simu->prev_err_messages.begin(), simu->prev_err_messages.end(), e.what()) == simu->prev_err_messages.end())
+			simu->prev_err_messages.push_back(e.what());
+		simu->mutex_exception.unlock();
+	}
+
+	// the thread 0 is the main thread, the threads it starts later (terminal, ...) must not inherit its core
+	if (simu->params_EXIT.pin_threads)
+		tools::Thread_pinning::unpin();
 }
 
 // ==================================================================================== explicit template instantiation
@@ -3,6 +3,9 @@
 #ifndef SIMULATION_EXIT_HPP_
 #define SIMULATION_EXIT_HPP_
 
+#include <mutex>
+#include <random>
+#include <string>
 #include <vector>
 #include <mipp.h>
 
@@ -12,8 +15,10 @@
 #include "Module/Channel/Channel.hpp"
 #include "Module/Decoder/Decoder_SISO.hpp"
 #include "Module/Monitor/EXIT/Monitor_EXIT.hpp"
+#include "Module/Monitor/EXIT/Monitor_EXIT_reduction.hpp"
 
 #include "Tools/Display/Terminal/EXIT/Terminal_EXIT.hpp"
+#include "Tools/Sequence/Sequence.hpp"
 
 #include "Factory/Simulation/EXIT/EXIT.hpp"
 
@@ -35,16 +40,26 @@ protected:
 	float ebn0;
 	float esn0;
 
-	// communication chain
-	module::Source      <B  > *source;
-	module::Codec_SISO  <B,R> *codec;
-	module::Modem       <B,R> *modem;
-	module::Modem       <B,R> *modem_a;
-	module::Channel     <  R> *channel;
-	module::Channel     <  R> *channel_a;
-	module::Decoder_SISO<  R> *siso;
-	module::Monitor_EXIT<B,R> *monitor;
-	tools::Terminal_EXIT<B,R> *terminal;
+	std::mutex               mutex_exception;
+	std::vector<std::string> prev_err_messages;
+
+	// a vector of random number generators (one per thread) to seed the modules
+	std::vector<std::mt19937> rd_engine_seed;
+
+	// communication chain (one per thread)
+	std::vector<module::Source      <B  >*> source;
+	std::vector<module::Codec_SISO  <B,R>*> codec;
+	std::vector<module::Modem       <B,R>*> modem;
+	std::vector<module::Modem       <B,R>*> modem_a;
+	std::vector<module::Channel     <  R>*> channel;
+	std::vector<module::Channel     <  R>*> channel_a;
+	std::vector<module::Monitor_EXIT<B,R>*> monitor;
+	            module::Monitor_EXIT_reduction<B,R>* monitor_red;
+	            tools::Terminal_EXIT<B,R>*  terminal;
+
+	// execution plans of the communication chain (with and without the a priori channel)
+	std::vector<tools::Sequence*> sequence;
+	std::vector<tools::Sequence*> sequence_no_a;
 
 public:
 	explicit EXIT(const factory::EXIT::parameters &params_EXIT);
@@ -54,18 +69,23 @@ public:
 
 protected:
 	void _build_communication_chain();
-	void sockets_binding           ();
-	void simulation_loop           ();
-	void release_objects           ();
-
-	module::Source      <B  >* build_source   (              );
-	module::Codec_SISO  <B,R>* build_codec    (              );
-	module::Modem       <B,R>* build_modem    (              );
-	module::Modem       <B,R>* build_modem_a  (              );
-	module::Channel     <  R>* build_channel  (const int size);
-	module::Channel     <  R>* build_channel_a(const int size);
-	module::Monitor_EXIT<B,R>* build_monitor  (              );
-	tools::Terminal_EXIT<B,R>* build_terminal (              );
+	void __build_communication_chain(const int tid);
+	void sockets_binding            (const int tid);
+	void simulation_loop            (const int tid);
+	void release_objects            (             );
+
+	module::Source      <B  >* build_source   (const int tid);
+	module::Codec_SISO  <B,R>* build_codec    (const int tid);
+	module::Modem       <B,R>* build_modem    (const int tid);
+	module::Modem       <B,R>* build_modem_a  (const int tid);
+	module::Channel     <  R>* build_channel  (const int tid);
+	module::Channel     <  R>* build_channel_a(const int tid);
+	module::Monitor_EXIT<B,R>* build_monitor  (const int tid);
+	tools::Terminal_EXIT<B,R>* build_terminal (             );
+
+private:
+	static void start_thread_build_comm_chain(EXIT<B,R> *simu, const int tid);
+	static void start_thread                 (EXIT<B,R> *simu, const int tid);
 };
 }
 }
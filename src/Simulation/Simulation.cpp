@@ -1,3 +1,10 @@
+#include <iostream>
+
+#include "Tools/Display/bash_tools.h"
+#include "Tools/Perf/Hardware_counters/Hardware_counters.hpp"
+#include "Tools/Perf/Huge_pages/Huge_pages.hpp"
+#include "Tools/Display/Timeline/Timeline.hpp"
+
 #include "Simulation.hpp"
 
 using namespace aff3ct;
@@ -23,8 +30,18 @@ bool Simulation
 void Simulation
 ::build_communication_chain()
 {
+	tools::Huge_pages::set_mode(params.huge_pages);
+
 	_build_communication_chain();
 
+	if (!params.trace_path.empty())
+		tools::Timeline::enable();
+
+	if (params.statistics_hw && !tools::Hardware_counters::is_available())
+		std::clog << tools::format_warning("The hardware performance counters are unavailable on this system (see "
+		                                   "'/proc/sys/kernel/perf_event_paranoid'), they will be displayed as 0.")
+		          << std::endl;
+
 	for (auto &m : modules)
 		for (auto mm : m.second)
 			if (mm != nullptr)
@@ -35,6 +52,9 @@ void Simulation
 					if (params.statistics)
 						t->set_stats(true);
 
+					if (params.statistics_hw)
+						t->set_perf(true);
+
 					// enable the debug mode in the modules
 					if (params.debug)
 					{
@@ -46,7 +66,8 @@ void Simulation
 							t->set_debug_precision((uint8_t)params.debug_precision);
 					}
 
-					if (!t->is_stats() && !t->is_debug())
+					// the fast mode skips the timeline recording
+					if (!t->is_stats() && !t->is_debug() && params.trace_path.empty())
 						t->set_fast(true);
 				}
 }
@@ -0,0 +1,126 @@
+/*!
+ * \file
+ * \brief Shares the frames recorded in a file between several instances.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef FRAME_PARTITION_HPP
+#define FRAME_PARTITION_HPP
+
+#include <sstream>
+#include <iostream>
+
+#include "Tools/Exception/exception.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Frame_partition
+ *
+ * \brief Iterates over the frames "part_id", "part_id + n_parts", "part_id + 2 * n_parts", ... of "n_fra" recorded
+ *        frames, and goes back to "part_id" after the last one.
+ *
+ * A part without any frame ("part_id" >= "n_fra") is idle: its instance must not play frames, otherwise the frames
+ * of another part would be counted twice.
+ */
+class Frame_partition
+{
+private:
+	int n_fra;
+	int part_id;
+	int n_parts;
+	int counter;
+
+public:
+	/*!
+	 * \brief Constructor, a single part with all the frames.
+	 *
+	 * \param n_fra: the number of recorded frames.
+	 */
+	explicit Frame_partition(const int n_fra = 0)
+	: n_fra(n_fra), part_id(0), n_parts(1), counter(0)
+	{
+	}
+
+	/*!
+	 * \brief Sets the number of recorded frames (the partition is not changed).
+	 */
+	void set_n_fra(const int n_fra)
+	{
+		this->n_fra = n_fra;
+	}
+
+	/*!
+	 * \brief Selects the part of the frames, the next frame is the first one of the part.
+	 *
+	 * \param part_id: the id of the part in [0, n_parts[.
+	 * \param n_parts: the number of parts.
+	 */
+	void set_partition(const int part_id, const int n_parts)
+	{
+		if (n_parts <= 0 || part_id < 0 || part_id >= n_parts)
+		{
+			std::stringstream message;
+			message << "'part_id' has to be in [0, 'n_parts'[ ('part_id' = " << part_id << ", 'n_parts' = "
+			        << n_parts << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->part_id = part_id;
+		this->n_parts = n_parts;
+		this->counter = part_id;
+	}
+
+	/*!
+	 * \brief Returns true if the part has no frame.
+	 */
+	bool is_idle() const
+	{
+		return this->part_id >= this->n_fra;
+	}
+
+	/*!
+	 * \brief Returns the id of the next frame of the part and moves to the following one.
+	 */
+	int next()
+	{
+		if (this->is_idle())
+		{
+			std::stringstream message;
+			message << "This part has no frame to play ('part_id' = " << this->part_id << ", 'n_fra' = "
+			        << this->n_fra << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		const auto cur = this->counter;
+
+		this->counter += this->n_parts;
+		if (this->counter >= this->n_fra)
+			this->counter = this->part_id;
+
+		return cur;
+	}
+
+	/*!
+	 * \brief Writes the id of the next frame (see Module::save_state).
+	 */
+	void save_state(std::ostream &os) const
+	{
+		os << this->counter << " ";
+	}
+
+	/*!
+	 * \brief Restores the id of the next frame (see Module::load_state).
+	 */
+	void load_state(std::istream &is)
+	{
+		is >> this->counter;
+	}
+};
+}
+}
+
+#endif /* FRAME_PARTITION_HPP */
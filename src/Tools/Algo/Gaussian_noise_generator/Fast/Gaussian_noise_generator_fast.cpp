@@ -1,4 +1,5 @@
 #include <cmath>
+#include <cstdint>
 #include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
@@ -12,7 +13,9 @@ Gaussian_noise_generator_fast<R>
 ::Gaussian_noise_generator_fast(const int seed)
 : Gaussian_noise_generator<R>(),
   mt19937(seed),
-  mt19937_simd()
+  mt19937_simd(),
+  simd_bits(mipp::nElReg<int>()),
+  simd_uniforms(mipp::nElReg<R>())
 {
 	this->set_seed(seed);
 }
@@ -23,6 +26,13 @@ Gaussian_noise_generator_fast<R>
 {
 }
 
+template <typename R>
+Gaussian_noise_generator_fast<R>* Gaussian_noise_generator_fast<R>
+::clone() const
+{
+	return new Gaussian_noise_generator_fast<R>(*this);
+}
+
 template <typename R>
 void Gaussian_noise_generator_fast<R>
 ::set_seed(const int seed)
@@ -33,6 +43,22 @@ void Gaussian_noise_generator_fast<R>
 	mt19937_simd.seed(seeds.data());
 }
 
+template <typename R>
+void Gaussian_noise_generator_fast<R>
+::save_state(std::ostream &os) const
+{
+	mt19937     .save_state(os);
+	mt19937_simd.save_state(os);
+}
+
+template <typename R>
+void Gaussian_noise_generator_fast<R>
+::load_state(std::istream &is)
+{
+	mt19937     .load_state(is);
+	mt19937_simd.load_state(is);
+}
+
 template <typename R>
 mipp::Reg<R> Gaussian_noise_generator_fast<R>
 ::get_random_simd()
@@ -61,6 +87,28 @@ mipp::Reg<float> Gaussian_noise_generator_fast<float>
 }
 }
 
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+mipp::Reg<double> Gaussian_noise_generator_fast<double>
+::get_random_simd()
+{
+	// return a vector of numbers between ]0,1[, each one is built from 2 random integers (53-bit mantissa)
+	mt19937_simd.rand_s32().store(simd_bits.data());
+	for (auto i = 0; i < mipp::nElReg<double>(); i++)
+	{
+		const auto hi = (uint64_t)(uint32_t)simd_bits[2*i +0];
+		const auto lo = (uint64_t)(uint32_t)simd_bits[2*i +1];
+		simd_uniforms[i] = ((double)((hi << 21) | (lo >> 11)) + 0.5) * (1.0 / 9007199254740992.0);
+	}
+
+	return mipp::Reg<double>(simd_uniforms.data());
+}
+}
+}
+
 namespace aff3ct
 {
 namespace tools
@@ -75,6 +123,20 @@ float Gaussian_noise_generator_fast<float>
 }
 }
 
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+double Gaussian_noise_generator_fast<double>
+::get_random()
+{
+	// return a number between ]0,1[ (53-bit mantissa)
+	return ((double)(mt19937.rand_u64() >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+}
+}
+
 template <typename R>
 void Gaussian_noise_generator_fast<R>
 ::generate(R *noise, const unsigned length, const R sigma, const R mu) //TODO: integrate mu in the computation
@@ -136,6 +198,49 @@ void Gaussian_noise_generator_fast<R>
 	}
 }
 
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Gaussian_noise_generator_fast<double>
+::generate(double *noise, const unsigned length, const double sigma, const double mu)
+{
+	if (!mipp::isAligned(noise))
+		throw runtime_error(__FILE__, __LINE__, __func__, "'noise' is misaligned memory.");
+
+	const auto twopi = 2.0 * 3.14159265358979323846;
+
+	// MIPP does not provide the double precision "log" and "sincos" on all the architectures: the uniform numbers are
+	// drawn with the SIMD PRNG directly in the noise buffer, then the Box Muller method is applied in place
+	const auto vec_loop_size = (int)((length / mipp::nElReg<double>()) * mipp::nElReg<double>());
+	for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<double>())
+		get_random_simd().store(&noise[i]);
+	for (auto i = vec_loop_size; i < (int)length; i++)
+		noise[i] = get_random();
+
+	const auto seq_loop_size = (int)(length / 2) * 2;
+	for (auto i = 0; i < seq_loop_size; i += 2)
+	{
+		const auto radius = std::sqrt(std::log(noise[i +0]) * -2.0) * sigma;
+		const auto theta  = noise[i +1] * twopi;
+
+		noise[i +0] = radius * std::cos(theta) + mu;
+		noise[i +1] = radius * std::sin(theta) + mu;
+	}
+
+	// distribute the last odd element
+	if ((int)length != seq_loop_size)
+	{
+		const auto radius = std::sqrt(std::log(noise[length -1]) * -2.0) * sigma;
+		const auto theta  = twopi * get_random();
+
+		noise[length -1] = radius * std::sin(theta) + mu;
+	}
+}
+}
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
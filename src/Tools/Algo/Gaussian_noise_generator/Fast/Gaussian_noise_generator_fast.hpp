@@ -2,6 +2,7 @@
 #define GAUSSIAN_NOISE_GENERATOR_FAST_HPP_
 
 #include <random>
+#include <mipp.h>
 
 #include "Tools/Algo/PRNG/PRNG_MT19937.hpp"
 #include "Tools/Algo/PRNG/PRNG_MT19937_simd.hpp"
@@ -12,6 +13,15 @@ namespace aff3ct
 {
 namespace tools
 {
+/*!
+ * \class Gaussian_noise_generator_fast
+ *
+ * \brief Gaussian noise generator based on the Box Muller method and on the SIMD Mersenne Twister.
+ *
+ * In single precision the whole Box Muller transform is computed in SIMD. In double precision only the uniform numbers
+ * are drawn in SIMD (their 53-bit mantissa is built in scalar from the 32-bit integers), the logarithm and the sine and
+ * cosine are scalar since MIPP does not provide them in double precision on all the architectures.
+ */
 template <typename R = float>
 class Gaussian_noise_generator_fast : public Gaussian_noise_generator<R>
 {
@@ -19,11 +29,17 @@ private:
 	tools::PRNG_MT19937      mt19937;      // Mersenne Twister 19937 (scalar)
 	tools::PRNG_MT19937_simd mt19937_simd; // Mersenne Twister 19937 (SIMD)
 
+	mipp::vector<int> simd_bits;     // the random bits of a SIMD draw (double precision only)
+	mipp::vector<R>   simd_uniforms; // the uniform numbers built from them
+
 public:
 	explicit Gaussian_noise_generator_fast(const int seed = 0);
 	virtual ~Gaussian_noise_generator_fast();
 
+	virtual Gaussian_noise_generator_fast<R>* clone() const;
 	virtual void set_seed(const int seed);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
 	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0);
 
 private:
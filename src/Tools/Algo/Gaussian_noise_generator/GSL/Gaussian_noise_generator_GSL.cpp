@@ -32,6 +32,15 @@ Gaussian_noise_generator_GSL<R>
 	gsl_rng_free(rng);
 }
 
+template <typename R>
+Gaussian_noise_generator_GSL<R>* Gaussian_noise_generator_GSL<R>
+::clone() const
+{
+	auto g = new Gaussian_noise_generator_GSL<R>();
+	gsl_rng_memcpy(g->rng, this->rng);
+	return g;
+}
+
 template <typename R>
 void Gaussian_noise_generator_GSL<R>
 ::generate(R *noise, const unsigned length, const R sigma, const R mu)
@@ -2,6 +2,11 @@
 #define GAUSSIAN_NOISE_GENERATOR_HPP_
 
 #include <vector>
+#include <cstdint>
+#include <sstream>
+#include <iostream>
+
+#include "Tools/Exception/exception.hpp"
 
 namespace aff3ct
 {
@@ -25,7 +30,41 @@ public:
 		this->generate(noise.data(), (unsigned)noise.size(), sigma, mu);
 	}
 
+	/*!
+	 * \brief Returns a copy of the generator (in the same internal state), owned by the caller.
+	 */
+	virtual Gaussian_noise_generator<R>* clone() const = 0;
+
 	virtual void set_seed(const int seed) = 0;
+
+	/*!
+	 * \brief Sets the global index of the frames of the next call to "generate", for the generators based on a
+	 *        counter-based PRNG (does nothing for the other generators).
+	 */
+	virtual void set_counter(const uint64_t)
+	{
+	}
+
+	/*!
+	 * \brief Writes the internal state of the generator (to checkpoint a simulation).
+	 */
+	virtual void save_state(std::ostream &) const
+	{
+		std::stringstream message;
+		message << "The state of this Gaussian noise generator can't be saved.";
+		throw unimplemented_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	/*!
+	 * \brief Restores an internal state written by "save_state".
+	 */
+	virtual void load_state(std::istream &)
+	{
+		std::stringstream message;
+		message << "The state of this Gaussian noise generator can't be loaded.";
+		throw unimplemented_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0) = 0;
 };
 
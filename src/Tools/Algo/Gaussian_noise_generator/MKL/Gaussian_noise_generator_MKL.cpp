@@ -22,6 +22,16 @@ Gaussian_noise_generator_MKL<R>
 		vslDeleteStream(&stream_state);
 }
 
+template <typename R>
+Gaussian_noise_generator_MKL<R>* Gaussian_noise_generator_MKL<R>
+::clone() const
+{
+	auto g = new Gaussian_noise_generator_MKL<R>();
+	vslDeleteStream(&g->stream_state);
+	vslCopyStream(&g->stream_state, this->stream_state);
+	return g;
+}
+
 template <typename R>
 void Gaussian_noise_generator_MKL<R>
 ::set_seed(const int seed)
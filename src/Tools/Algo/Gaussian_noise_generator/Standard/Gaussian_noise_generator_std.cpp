@@ -19,6 +19,13 @@ Gaussian_noise_generator_std<R>
 {
 }
 
+template <typename R>
+Gaussian_noise_generator_std<R>* Gaussian_noise_generator_std<R>
+::clone() const
+{
+	return new Gaussian_noise_generator_std<R>(*this);
+}
+
 template <typename R>
 void Gaussian_noise_generator_std<R>
 ::set_seed(const int seed)
@@ -26,6 +33,20 @@ void Gaussian_noise_generator_std<R>
 	rd_engine.seed(seed);
 }
 
+template <typename R>
+void Gaussian_noise_generator_std<R>
+::save_state(std::ostream &os) const
+{
+	os << rd_engine << " " << normal_dist << " ";
+}
+
+template <typename R>
+void Gaussian_noise_generator_std<R>
+::load_state(std::istream &is)
+{
+	is >> rd_engine >> normal_dist;
+}
+
 template <typename R>
 void Gaussian_noise_generator_std<R>
 ::generate(R *noise, const unsigned length, const R sigma, const R mu)
@@ -21,7 +21,10 @@ public:
 	explicit Gaussian_noise_generator_std(const int seed = 0);
 	virtual ~Gaussian_noise_generator_std();
 
+	virtual Gaussian_noise_generator_std<R>* clone() const;
 	virtual void set_seed(const int seed);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
 	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0);
 };
 
@@ -0,0 +1,202 @@
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Gaussian_noise_generator_threefry.hpp"
+
+using namespace aff3ct::tools;
+
+template <typename R>
+Gaussian_noise_generator_threefry<R>
+::Gaussian_noise_generator_threefry(const int seed)
+: Gaussian_noise_generator<R>(),
+  threefry(seed, PRNG_Threefry::CHANNEL)
+{
+}
+
+template <typename R>
+Gaussian_noise_generator_threefry<R>
+::~Gaussian_noise_generator_threefry()
+{
+}
+
+template <typename R>
+Gaussian_noise_generator_threefry<R>* Gaussian_noise_generator_threefry<R>
+::clone() const
+{
+	return new Gaussian_noise_generator_threefry<R>(*this);
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::set_seed(const int seed)
+{
+	threefry.seed(seed);
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::set_counter(const uint64_t counter)
+{
+	threefry.set_counter(counter);
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::save_state(std::ostream &os) const
+{
+	threefry.save_state(os);
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::load_state(std::istream &is)
+{
+	threefry.load_state(is);
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Gaussian_noise_generator_threefry<float>
+::generate_uniforms(float *uniforms, const unsigned length)
+{
+	// numbers between ]0,1[ from the 24 upper bits
+	this->words.resize(length);
+	threefry.generate(this->words.data(), length);
+	for (unsigned i = 0; i < length; i++)
+		uniforms[i] = ((float)(this->words[i] >> 8) + 0.5f) * (1.f / 16777216.f);
+}
+}
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Gaussian_noise_generator_threefry<double>
+::generate_uniforms(double *uniforms, const unsigned length)
+{
+	// numbers between ]0,1[ from 2 random integers (53-bit mantissa)
+	this->words.resize(2 * length);
+	threefry.generate(this->words.data(), 2 * length);
+	for (unsigned i = 0; i < length; i++)
+	{
+		const auto hi = (uint64_t)this->words[2*i +0];
+		const auto lo = (uint64_t)this->words[2*i +1];
+		uniforms[i] = ((double)((hi << 21) | (lo >> 11)) + 0.5) * (1.0 / 9007199254740992.0);
+	}
+}
+}
+}
+
+template <typename R>
+void Gaussian_noise_generator_threefry<R>
+::generate(R *noise, const unsigned length, const R sigma, const R mu)
+{
+	if (!mipp::isAligned(noise))
+		throw runtime_error(__FILE__, __LINE__, __func__, "'noise' is misaligned memory.");
+
+	const auto twopi = (R)(2.0 * 3.14159265358979323846);
+
+	// the uniform numbers are drawn directly in the noise buffer, the last odd element needs one more
+	generate_uniforms(noise, length);
+	R u_odd = (R)0.5;
+	if (length % 2)
+		generate_uniforms(&u_odd, 1);
+
+	// SIMD version of the Box Muller method in the polar form (in place)
+	const auto vec_loop_size = (int)(((int)length / (mipp::nElReg<R>() * 2)) * mipp::nElReg<R>() * 2);
+	for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<R>() * 2)
+	{
+		const auto u1 = mipp::Reg<R>(&noise[i                    ]);
+		const auto u2 = mipp::Reg<R>(&noise[i + mipp::nElReg<R>()]);
+
+		const auto radius = mipp::sqrt(mipp::log(u1) * (R)-2.0) * sigma;
+		const auto theta  = u2 * twopi;
+
+		mipp::Reg<R> sintheta, costheta;
+		mipp::sincos(theta, sintheta, costheta);
+
+		auto awgn1 = radius * costheta + mu;
+		auto awgn2 = radius * sintheta + mu;
+
+		awgn1.store(&noise[i                    ]);
+		awgn2.store(&noise[i + mipp::nElReg<R>()]);
+	}
+
+	// seq version of the Box Muller method in the polar form
+	const auto seq_loop_size = (int)(length / 2) * 2;
+	for (auto i = vec_loop_size; i < seq_loop_size; i += 2)
+	{
+		const auto radius = (R)std::sqrt(std::log(noise[i +0]) * (R)-2.0) * sigma;
+		const auto theta  = noise[i +1] * twopi;
+
+		noise[i +0] = radius * std::cos(theta) + mu;
+		noise[i +1] = radius * std::sin(theta) + mu;
+	}
+
+	// distribute the last odd element
+	if ((int)length != seq_loop_size)
+	{
+		const auto radius = (R)std::sqrt(std::log(noise[length -1]) * (R)-2.0) * sigma;
+		const auto theta  = twopi * u_odd;
+
+		noise[length -1] = radius * std::sin(theta) + mu;
+	}
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template <>
+void Gaussian_noise_generator_threefry<double>
+::generate(double *noise, const unsigned length, const double sigma, const double mu)
+{
+	if (!mipp::isAligned(noise))
+		throw runtime_error(__FILE__, __LINE__, __func__, "'noise' is misaligned memory.");
+
+	const auto twopi = 2.0 * 3.14159265358979323846;
+
+	// MIPP does not provide the double precision "log" and "sincos" on all the architectures, the Box Muller method
+	// is applied in scalar on the uniform numbers drawn in the noise buffer
+	generate_uniforms(noise, length);
+	double u_odd = 0.5;
+	if (length % 2)
+		generate_uniforms(&u_odd, 1);
+
+	const auto seq_loop_size = (int)(length / 2) * 2;
+	for (auto i = 0; i < seq_loop_size; i += 2)
+	{
+		const auto radius = std::sqrt(std::log(noise[i +0]) * -2.0) * sigma;
+		const auto theta  = noise[i +1] * twopi;
+
+		noise[i +0] = radius * std::cos(theta) + mu;
+		noise[i +1] = radius * std::sin(theta) + mu;
+	}
+
+	if ((int)length != seq_loop_size)
+	{
+		const auto radius = std::sqrt(std::log(noise[length -1]) * -2.0) * sigma;
+		const auto theta  = twopi * u_odd;
+
+		noise[length -1] = radius * std::sin(theta) + mu;
+	}
+}
+}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Gaussian_noise_generator_threefry<R_32>;
+template class aff3ct::tools::Gaussian_noise_generator_threefry<R_64>;
+#else
+template class aff3ct::tools::Gaussian_noise_generator_threefry<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,49 @@
+#ifndef GAUSSIAN_NOISE_GENERATOR_THREEFRY_HPP_
+#define GAUSSIAN_NOISE_GENERATOR_THREEFRY_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/PRNG/PRNG_Threefry.hpp"
+
+#include "../Gaussian_noise_generator.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Gaussian_noise_generator_threefry
+ *
+ * \brief Gaussian noise generator based on the counter-based Threefry PRNG (Box Muller method): after a call to
+ *        "set_counter" (the index of the first frame of the next call to "generate"), the noise only depends on the
+ *        seed and on this counter.
+ */
+template <typename R = float>
+class Gaussian_noise_generator_threefry : public Gaussian_noise_generator<R>
+{
+private:
+	tools::PRNG_Threefry  threefry;
+	std::vector<uint32_t> words; // the random numbers of a call to "generate"
+
+public:
+	explicit Gaussian_noise_generator_threefry(const int seed = 0);
+	virtual ~Gaussian_noise_generator_threefry();
+
+	virtual Gaussian_noise_generator_threefry<R>* clone() const;
+	virtual void set_seed(const int seed);
+	virtual void set_counter(const uint64_t counter);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0);
+
+private:
+	void generate_uniforms(R *uniforms, const unsigned length);
+};
+
+template <typename R = float>
+using Gaussian_gen_threefry = Gaussian_noise_generator_threefry<R>;
+}
+}
+
+#endif /* GAUSSIAN_NOISE_GENERATOR_THREEFRY_HPP_ */
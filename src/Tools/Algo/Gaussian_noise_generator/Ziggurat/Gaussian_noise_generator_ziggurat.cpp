@@ -0,0 +1,179 @@
+#include <cmath>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Gaussian_noise_generator_ziggurat.hpp"
+
+using namespace aff3ct::tools;
+
+static const int    zig_n_layers = 128;
+static const double zig_dn       = 3.442619855899;       // the start of the tail
+static const double zig_vn       = 9.91256303526217e-3;  // the area of each layer
+static const double zig_m1       = 2147483648.0;         // 2^31
+
+template <typename R>
+Gaussian_noise_generator_ziggurat<R>
+::Gaussian_noise_generator_ziggurat(const int seed)
+: Gaussian_noise_generator<R>(),
+  mt19937(seed),
+  mt19937_simd(),
+  kn(zig_n_layers),
+  wn(zig_n_layers),
+  fn(zig_n_layers),
+  simd_bits(mipp::nElReg<int>())
+{
+	// build the tables of the ziggurat (from the top of the tail to the top layer)
+	auto dn = zig_dn, tn = zig_dn;
+	const auto q = zig_vn / std::exp(-0.5 * dn * dn);
+
+	kn[0] = (uint32_t)((dn / q) * zig_m1);
+	kn[1] = 0;
+
+	wn[0]                = (R)(q  / zig_m1);
+	wn[zig_n_layers -1] = (R)(dn / zig_m1);
+
+	fn[0]                = 1.0;
+	fn[zig_n_layers -1] = std::exp(-0.5 * dn * dn);
+
+	for (auto i = zig_n_layers -2; i >= 1; i--)
+	{
+		dn = std::sqrt(-2.0 * std::log(zig_vn / dn + std::exp(-0.5 * dn * dn)));
+		kn[i +1] = (uint32_t)((dn / tn) * zig_m1);
+		tn = dn;
+		fn[i] = std::exp(-0.5 * dn * dn);
+		wn[i] = (R)(dn / zig_m1);
+	}
+
+	this->set_seed(seed);
+}
+
+template <typename R>
+Gaussian_noise_generator_ziggurat<R>
+::~Gaussian_noise_generator_ziggurat()
+{
+}
+
+template <typename R>
+Gaussian_noise_generator_ziggurat<R>* Gaussian_noise_generator_ziggurat<R>
+::clone() const
+{
+	return new Gaussian_noise_generator_ziggurat<R>(*this);
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::set_seed(const int seed)
+{
+	mt19937.seed(seed);
+
+	mipp::vector<int> seeds(mipp::nElReg<int>());
+	for (auto i = 0; i < mipp::nElReg<int>(); i++)
+		seeds[i] = mt19937.rand();
+	mt19937_simd.seed(seeds.data());
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::save_state(std::ostream &os) const
+{
+	mt19937     .save_state(os);
+	mt19937_simd.save_state(os);
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::load_state(std::istream &is)
+{
+	mt19937     .load_state(is);
+	mt19937_simd.load_state(is);
+}
+
+template <typename R>
+double Gaussian_noise_generator_ziggurat<R>
+::get_random()
+{
+	// return a number between ]0,1[
+	return ((double)mt19937.rand_u32() + 0.5) * (1.0 / 4294967296.0);
+}
+
+template <typename R>
+R Gaussian_noise_generator_ziggurat<R>
+::normal(int32_t hz)
+{
+	const auto iz  = hz & (zig_n_layers -1);
+	const auto ahz = (uint32_t)(hz < 0 ? -(int64_t)hz : (int64_t)hz);
+
+	return (ahz < kn[iz]) ? (R)hz * wn[iz] : normal_fix(hz);
+}
+
+template <typename R>
+R Gaussian_noise_generator_ziggurat<R>
+::normal_fix(int32_t hz)
+{
+	const auto r = zig_dn;
+
+	while (true)
+	{
+		const auto iz = hz & (zig_n_layers -1);
+		const auto x  = (double)hz * (double)wn[iz];
+
+		// the tail of the distribution (Marsaglia's method)
+		if (iz == 0)
+		{
+			double xt, yt;
+			do
+			{
+				xt = -std::log(get_random()) / r;
+				yt = -std::log(get_random());
+			}
+			while (yt + yt < xt * xt);
+
+			return (R)(hz > 0 ? r + xt : -r - xt);
+		}
+
+		// the wedges
+		if (fn[iz] + get_random() * (fn[iz -1] - fn[iz]) < std::exp(-0.5 * x * x))
+			return (R)x;
+
+		// try a new candidate
+		hz = (int32_t)mt19937.rand_u32();
+		const auto jz  = hz & (zig_n_layers -1);
+		const auto ahz = (uint32_t)(hz < 0 ? -(int64_t)hz : (int64_t)hz);
+		if (ahz < kn[jz])
+			return (R)hz * wn[jz];
+	}
+}
+
+template <typename R>
+void Gaussian_noise_generator_ziggurat<R>
+::generate(R *noise, const unsigned length, const R sigma, const R mu)
+{
+	// the layers are looked up in scalar: there is no portable gather instruction in MIPP, the random integers are
+	// drawn with the SIMD PRNG
+	const auto n_bits = mipp::nElReg<int>();
+	const auto vec_loop_size = (int)((length / n_bits) * n_bits);
+	for (auto i = 0; i < vec_loop_size; i += n_bits)
+	{
+		mt19937_simd.rand_s32().store(simd_bits.data());
+		for (auto j = 0; j < n_bits; j++)
+			noise[i +j] = normal((int32_t)simd_bits[j]) * sigma + mu;
+	}
+
+	if (vec_loop_size < (int)length)
+	{
+		mt19937_simd.rand_s32().store(simd_bits.data());
+		for (auto i = vec_loop_size; i < (int)length; i++)
+			noise[i] = normal((int32_t)simd_bits[i - vec_loop_size]) * sigma + mu;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::tools::Gaussian_noise_generator_ziggurat<R_32>;
+template class aff3ct::tools::Gaussian_noise_generator_ziggurat<R_64>;
+#else
+template class aff3ct::tools::Gaussian_noise_generator_ziggurat<R>;
+#endif
+// ==================================================================================== explicit template instantiation
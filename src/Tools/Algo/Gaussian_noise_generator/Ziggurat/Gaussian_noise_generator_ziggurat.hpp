@@ -0,0 +1,64 @@
+#ifndef GAUSSIAN_NOISE_GENERATOR_ZIGGURAT_HPP_
+#define GAUSSIAN_NOISE_GENERATOR_ZIGGURAT_HPP_
+
+#include <vector>
+#include <cstdint>
+#include <mipp.h>
+
+#include "Tools/Algo/PRNG/PRNG_MT19937.hpp"
+#include "Tools/Algo/PRNG/PRNG_MT19937_simd.hpp"
+
+#include "../Gaussian_noise_generator.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Gaussian_noise_generator_ziggurat
+ *
+ * \brief Gaussian noise generator based on the Ziggurat method of Marsaglia and Tsang (128 layers).
+ *
+ * The 32-bit random integers are drawn by the SIMD Mersenne Twister. Each integer gives a layer of the ziggurat (its 7
+ * lower bits) and a candidate value which is accepted in about 98.8% of the cases with a single multiplication: there
+ * is no logarithm and no trigonometric function on the fast path. The rejected candidates go through the scalar slow
+ * path (wedges and tail).
+ *
+ * Only the random integers are drawn in SIMD: MIPP has no portable gather instruction, so the layer lookups, the
+ * acceptance test and the scaling are scalar.
+ */
+template <typename R = float>
+class Gaussian_noise_generator_ziggurat : public Gaussian_noise_generator<R>
+{
+private:
+	tools::PRNG_MT19937      mt19937;      // Mersenne Twister 19937 (scalar), used by the slow path
+	tools::PRNG_MT19937_simd mt19937_simd; // Mersenne Twister 19937 (SIMD), used by the fast path
+
+	std::vector<uint32_t> kn; // the thresholds of the fast path in each layer
+	std::vector<R>        wn; // the widths of the layers (scaled by 2^-31)
+	std::vector<double>   fn; // the values of the density at the edge of the layers
+
+	mipp::vector<int> simd_bits; // the random integers of a SIMD draw
+
+public:
+	explicit Gaussian_noise_generator_ziggurat(const int seed = 0);
+	virtual ~Gaussian_noise_generator_ziggurat();
+
+	virtual Gaussian_noise_generator_ziggurat<R>* clone() const;
+	virtual void set_seed(const int seed);
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+	virtual void generate(R *noise, const unsigned length, const R sigma, const R mu = 0.0);
+
+private:
+	inline R normal(int32_t hz);
+	R        normal_fix(int32_t hz);
+	inline double get_random();
+};
+
+template <typename R = float>
+using Gaussian_gen_ziggurat = Gaussian_noise_generator_ziggurat<R>;
+}
+}
+
+#endif /* GAUSSIAN_NOISE_GENERATOR_ZIGGURAT_HPP_ */
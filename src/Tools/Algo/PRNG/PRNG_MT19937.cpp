@@ -95,6 +95,21 @@ void PRNG_MT19937::seed(const uint32_t seed)
 		MT[i] = 0x6c078965 * (MT[i-1] ^ MT[i-1] >> 30) +i;
 }
 
+void PRNG_MT19937::save_state(std::ostream &os) const
+{
+	os << index;
+	for (unsigned i = 0; i < SIZE; ++i)
+		os << " " << MT[i];
+	os << " ";
+}
+
+void PRNG_MT19937::load_state(std::istream &is)
+{
+	is >> index;
+	for (unsigned i = 0; i < SIZE; ++i)
+		is >> MT[i];
+}
+
 void PRNG_MT19937::generate_numbers()
 {
 	/*
@@ -28,6 +28,7 @@
 #define __STDC_LIMIT_MACROS
 #include <cstdint>
 #include <vector>
+#include <iostream>
 
 namespace aff3ct
 {
@@ -63,6 +64,21 @@ public:
 	 */
 	void seed(const uint32_t seed);
 
+	/*!
+	 * \brief Writes the internal state of the PRNG (text format).
+	 *
+	 * \param os: the output stream.
+	 */
+	void save_state(std::ostream &os) const;
+
+	/*!
+	 * \brief Restores an internal state written by "save_state", the next numbers are the same as the ones which
+	 *        followed the save.
+	 *
+	 * \param is: the input stream.
+	 */
+	void load_state(std::istream &is);
+
 	/*!
 	 * \brief Extract a pseudo-random integer in the range 0 ... RAND_MAX. (LIBC REPLACEMENT FUNCTION).
 	 *
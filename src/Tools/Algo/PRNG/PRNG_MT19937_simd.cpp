@@ -81,6 +81,41 @@ void PRNG_MT19937_simd::seed(const mipp::Reg<int> seed)
 		MT[i] = (MT[i-1] ^ MT[i-1] >> 30) * 0x6c078965 +i;
 }
 
+void PRNG_MT19937_simd::save_state(std::ostream &os) const
+{
+	mipp::vector<int> lanes(mipp::nElReg<int>());
+
+	os << index << " " << mipp::nElReg<int>();
+	for (unsigned i = 0; i < SIZE; ++i)
+	{
+		MT[i].store(lanes.data());
+		for (auto l = 0; l < mipp::nElReg<int>(); l++)
+			os << " " << lanes[l];
+	}
+	os << " ";
+}
+
+void PRNG_MT19937_simd::load_state(std::istream &is)
+{
+	mipp::vector<int> lanes(mipp::nElReg<int>());
+
+	int n_lanes = 0;
+	is >> index >> n_lanes;
+	if (n_lanes != mipp::nElReg<int>())
+	{
+		// the state has been saved with another SIMD register size
+		is.setstate(std::ios::failbit);
+		return;
+	}
+
+	for (unsigned i = 0; i < SIZE; ++i)
+	{
+		for (auto l = 0; l < mipp::nElReg<int>(); l++)
+			is >> lanes[l];
+		MT[i] = mipp::Reg<int>(lanes.data());
+	}
+}
+
 void PRNG_MT19937_simd::generate_numbers()
 {
 	/*
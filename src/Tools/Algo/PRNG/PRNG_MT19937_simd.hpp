@@ -21,6 +21,7 @@
 #define PRNG_MT19937_SIMD_HPP
 
 #include <vector>
+#include <iostream>
 #include <mipp.h>
 
 namespace aff3ct
@@ -49,6 +50,20 @@ public:
 	 */
 	void seed(const mipp::Reg<int> seed);
 
+	/*!
+	 * \brief Writes the internal state of the PRNG (text format).
+	 *
+	 * \param os: the output stream.
+	 */
+	void save_state(std::ostream &os) const;
+
+	/*!
+	 * \brief Restores an internal state written by "save_state" (with the same SIMD register size).
+	 *
+	 * \param is: the input stream.
+	 */
+	void load_state(std::istream &is);
+
 	/*!
 	 * \brief Extracts a pseudo-random signed 32-bit integer in the range INT32_MIN ... INT32_MAX.
 	 *
@@ -0,0 +1,195 @@
+#include "Tools/Exception/exception.hpp"
+
+#include "PRNG_Threefry.hpp"
+
+using namespace aff3ct::tools;
+
+// the rotations of the Threefry-4x32 rounds (from Random123)
+static const int threefry_rot[8][2] = {{10, 26}, {11, 21}, {13, 27}, {23,  5},
+                                       { 6, 20}, {17, 11}, {25, 10}, {18, 20}};
+static const uint32_t threefry_parity = 0x1BD11BDA;
+static const int      threefry_rounds = 20;
+
+static inline uint32_t rotl(const uint32_t x, const int r)
+{
+	return (x << r) | (x >> (32 - r));
+}
+
+static inline mipp::Reg<int> rotl(const mipp::Reg<int> x, const int r)
+{
+	// the right shift is masked, it may be an arithmetic shift on some architectures
+	return (x << r) | ((x >> (32 - r)) & mipp::Reg<int>((int)((1u << r) -1)));
+}
+
+template <typename W>
+static inline void threefry_4x32_20(W X[4], const W ks[5])
+{
+	for (auto k = 0; k < 4; k++)
+		X[k] += ks[k];
+
+	for (auto r = 0; r < threefry_rounds; r++)
+	{
+		const auto *rot = threefry_rot[r % 8];
+		if (r % 2 == 0)
+		{
+			X[0] += X[1]; X[1] = rotl(X[1], rot[0]); X[1] = X[1] ^ X[0];
+			X[2] += X[3]; X[3] = rotl(X[3], rot[1]); X[3] = X[3] ^ X[2];
+		}
+		else
+		{
+			X[0] += X[3]; X[3] = rotl(X[3], rot[0]); X[3] = X[3] ^ X[0];
+			X[2] += X[1]; X[1] = rotl(X[1], rot[1]); X[1] = X[1] ^ X[2];
+		}
+
+		// key injection every 4 rounds
+		if (r % 4 == 3)
+		{
+			const auto i = (r +1) / 4;
+			X[0] += ks[(i +0) % 5];
+			X[1] += ks[(i +1) % 5];
+			X[2] += ks[(i +2) % 5];
+			X[3] += ks[(i +3) % 5];
+			X[3] += W((uint32_t)i);
+		}
+	}
+}
+
+PRNG_Threefry
+::PRNG_Threefry(const uint32_t seed, const uint32_t stream)
+: key{seed, stream, 0, 0}, counter(0), position(0),
+  simd_ctr(2 * mipp::nElReg<int>()),
+  simd_out(4 * mipp::nElReg<int>())
+{
+	this->update_block();
+}
+
+PRNG_Threefry
+::~PRNG_Threefry()
+{
+}
+
+void PRNG_Threefry
+::seed(const uint32_t seed)
+{
+	this->key[0] = seed;
+	this->set_counter(0);
+}
+
+void PRNG_Threefry
+::set_counter(const uint64_t counter)
+{
+	this->counter  = counter;
+	this->position = 0;
+	this->update_block();
+}
+
+uint64_t PRNG_Threefry
+::get_counter() const
+{
+	return this->counter;
+}
+
+void PRNG_Threefry
+::save_state(std::ostream &os) const
+{
+	os << key[0] << " " << key[1] << " " << counter << " " << position << " ";
+}
+
+void PRNG_Threefry
+::load_state(std::istream &is)
+{
+	is >> key[0] >> key[1] >> counter >> position;
+
+	if (is.fail())
+		throw runtime_error(__FILE__, __LINE__, __func__, "The state of the Threefry PRNG can't be read.");
+
+	this->update_block();
+}
+
+void PRNG_Threefry
+::update_block()
+{
+	const auto b = this->position / 4;
+	const uint32_t ctr[4] = {(uint32_t)b, (uint32_t)(b >> 32), (uint32_t)this->counter, (uint32_t)(this->counter >> 32)};
+	compute_block(ctr, this->key, this->block);
+}
+
+uint32_t PRNG_Threefry
+::rand_u32()
+{
+	const auto r = this->block[this->position % 4];
+	this->position++;
+	if (this->position % 4 == 0)
+		this->update_block();
+	return r;
+}
+
+void PRNG_Threefry
+::generate(uint32_t *out, const size_t size)
+{
+	size_t i = 0;
+
+	// complete the current block
+	for (; i < size && this->position % 4; i++)
+		out[i] = this->rand_u32();
+
+	// vectorized loop: a block per lane
+	const auto n_lanes = (size_t)mipp::nElReg<int>();
+	if (size >= i + 4 * n_lanes)
+	{
+		mipp::Reg<int> ks[5];
+		ks[4] = mipp::Reg<int>((int)threefry_parity);
+		for (auto k = 0; k < 4; k++)
+		{
+			ks[k]  = mipp::Reg<int>((int)this->key[k]);
+			ks[4] = ks[4] ^ ks[k];
+		}
+
+		const auto ctr_lo = mipp::Reg<int>((int)(uint32_t)(this->counter      ));
+		const auto ctr_hi = mipp::Reg<int>((int)(uint32_t)(this->counter >> 32));
+
+		for (; i + 4 * n_lanes <= size; i += 4 * n_lanes)
+		{
+			const auto b = this->position / 4;
+			for (size_t l = 0; l < n_lanes; l++)
+			{
+				simd_ctr[          l] = (int)(uint32_t)((b + l)      );
+				simd_ctr[n_lanes + l] = (int)(uint32_t)((b + l) >> 32);
+			}
+
+			mipp::Reg<int> X[4] = {mipp::Reg<int>(&simd_ctr[0]), mipp::Reg<int>(&simd_ctr[n_lanes]), ctr_lo, ctr_hi};
+			threefry_4x32_20(X, ks);
+
+			for (auto k = 0; k < 4; k++)
+				X[k].store(&simd_out[k * n_lanes]);
+
+			// the numbers are given in the order of the blocks (independent of the SIMD register size)
+			for (size_t l = 0; l < n_lanes; l++)
+				for (size_t k = 0; k < 4; k++)
+					out[i + 4 * l + k] = (uint32_t)simd_out[k * n_lanes + l];
+
+			this->position += 4 * n_lanes;
+		}
+
+		this->update_block();
+	}
+
+	// remaining scalar operations
+	for (; i < size; i++)
+		out[i] = this->rand_u32();
+}
+
+void PRNG_Threefry
+::compute_block(const uint32_t ctr[4], const uint32_t key[4], uint32_t out[4])
+{
+	uint32_t ks[5];
+	ks[4] = threefry_parity;
+	for (auto k = 0; k < 4; k++)
+	{
+		ks[k]  = key[k];
+		ks[4] ^= key[k];
+		out[k] = ctr[k];
+	}
+
+	threefry_4x32_20(out, ks);
+}
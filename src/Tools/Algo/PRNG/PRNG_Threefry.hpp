@@ -0,0 +1,125 @@
+/*!
+ * \file
+ * \brief The Threefry-4x32-20 counter-based pseudo-random number generator (PRNG).
+ *
+ * Threefry is a counter-based PRNG from the Random123 library (Salmon et al., "Parallel random numbers: as easy as
+ * 1, 2, 3", SC'11): each block of four 32-bit numbers is a bijection of a 128-bit counter keyed by a 128-bit key, there
+ * is no state to update from a number to the next. A number can then be regenerated independently from the others
+ * by knowing its key and its counter, and many blocks can be computed at the same time in the lanes of the SIMD
+ * registers (only additions, rotations and xor are required).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef PRNG_THREEFRY_HPP
+#define PRNG_THREEFRY_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class PRNG_Threefry
+ * \brief The Threefry-4x32-20 counter-based pseudo-random number generator (PRNG).
+ *
+ * The key is made of a seed and of a stream (to give different numbers to the modules sharing the same seed). The
+ * counter of the blocks is made of the global index of a frame (set with "set_counter") and of the position of the
+ * block in the numbers drawn for this frame: the numbers of a frame only depend on the seed, on the stream and on
+ * the index of the frame.
+ */
+class PRNG_Threefry
+{
+public:
+	// the streams of the modules of a communication chain, they can then share the same seed
+	enum stream_t : uint32_t { SOURCE = 0, CHANNEL = 1, INTERLEAVER = 2 };
+
+protected:
+	uint32_t key[4];
+	uint64_t counter;  // the global index of the frame
+	uint64_t position; // the index of the next 32-bit number in the stream of the frame
+	uint32_t block[4]; // the current block (the one of "position")
+
+	mipp::vector<int> simd_ctr; // the counters of the SIMD lanes (low and high words)
+	mipp::vector<int> simd_out; // the blocks computed in the SIMD lanes
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param seed:   the first part of the key.
+	 * \param stream: the second part of the key.
+	 */
+	explicit PRNG_Threefry(const uint32_t seed = 0, const uint32_t stream = 0);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	virtual ~PRNG_Threefry();
+
+	/*!
+	 * \brief Changes the seed (the stream is kept), the counter and the position are reset.
+	 *
+	 * \param seed: the new seed.
+	 */
+	void seed(const uint32_t seed);
+
+	/*!
+	 * \brief Moves to the numbers of a frame (from its first number).
+	 *
+	 * \param counter: the global index of the frame.
+	 */
+	void set_counter(const uint64_t counter);
+
+	uint64_t get_counter() const;
+
+	/*!
+	 * \brief Writes the internal state of the PRNG (text format).
+	 *
+	 * \param os: the output stream.
+	 */
+	void save_state(std::ostream &os) const;
+
+	/*!
+	 * \brief Restores an internal state written by "save_state".
+	 *
+	 * \param is: the input stream.
+	 */
+	void load_state(std::istream &is);
+
+	/*!
+	 * \brief Extracts the next pseudo-random unsigned 32-bit integer of the current frame.
+	 *
+	 * \return a pseudo random number.
+	 */
+	uint32_t rand_u32();
+
+	/*!
+	 * \brief Extracts the next pseudo-random unsigned 32-bit integers of the current frame, the blocks are computed
+	 *        in the SIMD lanes. The numbers are the same as the ones of successive calls to "rand_u32" (whatever the
+	 *        SIMD register size).
+	 *
+	 * \param out:  the extracted numbers.
+	 * \param size: the number of extracted numbers.
+	 */
+	void generate(uint32_t *out, const size_t size);
+
+	/*!
+	 * \brief Computes a block of Threefry-4x32-20.
+	 *
+	 * \param ctr: the 128-bit counter.
+	 * \param key: the 128-bit key.
+	 * \param out: the four 32-bit pseudo random numbers.
+	 */
+	static void compute_block(const uint32_t ctr[4], const uint32_t key[4], uint32_t out[4]);
+
+private:
+	void update_block();
+};
+}
+}
+
+#endif /* PRNG_THREEFRY_HPP */
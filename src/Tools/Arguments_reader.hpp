@@ -143,6 +143,17 @@ public:
 	 */
 	float get_arg_float(const std::vector<std::string> &tags) const;
 
+	/*!
+	 * \brief Overrides the value of an argument as if it had been given on the command line.
+	 *
+	 * \param tags:  list of tags associated to an argument, tags = {"Key1", "Key2", [...]}.
+	 * \param value: the new string value of the argument.
+	 */
+	void set_argument(const std::vector<std::string> &tags, const std::string &value)
+	{
+		this->m_args[tags] = value;
+	}
+
 	/*!
 	 * \brief Prints the traditional usage.
 	 */
@@ -0,0 +1,229 @@
+#include <cstdio>
+#include <limits>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "Tools/Display/bash_tools.h"
+#include "Tools/Exception/exception.hpp"
+
+#include "Checkpoint.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static const std::string checkpoint_magic   = "aff3ct_checkpoint";
+static const int         checkpoint_version = 1;
+
+Checkpoint
+::Checkpoint(const std::string &path, const int n_threads, const std::chrono::seconds frequency)
+: path(path), n_threads(n_threads), frequency(frequency), request(0), served(n_threads, 0), states(n_threads),
+  n_submitted(0), n_left(0), snr_id(0), snr(0.f), stopping(true)
+{
+	if (path.empty())
+	{
+		std::stringstream message;
+		message << "'path' cannot be empty.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (frequency <= std::chrono::seconds(0))
+	{
+		std::stringstream message;
+		message << "'frequency' has to be greater than 0 ('frequency' = " << frequency.count() << " s).";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+Checkpoint
+::~Checkpoint()
+{
+	this->stop();
+}
+
+const std::string& Checkpoint
+::get_path() const
+{
+	return this->path;
+}
+
+void Checkpoint
+::start(const size_t snr_id, const float snr)
+{
+	this->stop();
+
+	const auto r = this->request.load();
+	for (auto &s : this->served)
+		s = r;
+
+	this->snr_id      = snr_id;
+	this->snr         = snr;
+	this->n_submitted = 0;
+	this->n_left      = 0;
+	this->stopping    = false;
+
+	this->writer = std::thread(&Checkpoint::writer_loop, this);
+}
+
+void Checkpoint
+::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_states);
+		this->stopping = true;
+	}
+	this->cv_states.notify_all();
+
+	if (this->writer.joinable())
+		this->writer.join();
+}
+
+void Checkpoint
+::submit(const int tid, const std::string &state)
+{
+	const auto r = this->request.load();
+	this->served[tid] = r;
+
+	std::lock_guard<std::mutex> lock(this->mutex_states);
+	if (r == this->request.load() && !this->stopping)
+	{
+		this->states[tid] = state;
+		this->n_submitted++;
+		if (this->n_submitted == this->n_threads)
+			this->cv_states.notify_all();
+	}
+}
+
+void Checkpoint
+::leave(const int)
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mutex_states);
+		this->n_left++;
+	}
+	this->cv_states.notify_all();
+}
+
+void Checkpoint
+::writer_loop()
+{
+	std::unique_lock<std::mutex> lock(this->mutex_states);
+	while (!this->stopping)
+	{
+		if (this->cv_states.wait_for(lock, this->frequency, [this]() { return this->stopping; }))
+			break;
+
+		// a thread has left the point, the snapshot would mix frames from different points
+		if (this->n_left)
+			continue;
+
+		// ask for a new snapshot, each thread answers after its current frame
+		this->n_submitted = 0;
+		this->request++;
+		this->cv_states.wait(lock, [this]()
+		{
+			return this->stopping || this->n_left || this->n_submitted == this->n_threads;
+		});
+
+		if (this->n_submitted == this->n_threads)
+		{
+			std::vector<std::string> snapshot;
+			snapshot.swap(this->states);
+			this->states.resize(this->n_threads);
+			const auto id = this->snr_id;
+			const auto s  = this->snr;
+
+			lock.unlock();
+			try
+			{
+				this->write(id, s, snapshot);
+			}
+			catch (std::exception const& e)
+			{
+				// the simulation goes on, the next snapshot may succeed
+				std::cerr << apply_on_each_line(e.what(), &format_warning) << std::endl;
+			}
+			lock.lock();
+		}
+	}
+}
+
+void Checkpoint
+::write(const size_t snr_id, const float snr, const std::vector<std::string> &states) const
+{
+	const auto tmp_path = this->path + ".tmp";
+
+	std::ofstream file(tmp_path, std::ios::out | std::ios::trunc | std::ios::binary);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the checkpoint file ('tmp_path' = " << tmp_path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	file.precision(std::numeric_limits<float>::max_digits10);
+	file << checkpoint_magic << " " << checkpoint_version << std::endl;
+	file << "snr_id "    << snr_id        << std::endl;
+	file << "snr "       << snr           << std::endl;
+	file << "n_threads " << states.size() << std::endl;
+	for (auto &s : states)
+		file << s.size() << std::endl << s << std::endl;
+	file.close();
+
+	if (file.fail() || std::rename(tmp_path.c_str(), this->path.c_str()))
+	{
+		std::stringstream message;
+		message << "Impossible to write the checkpoint file ('path' = " << this->path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+bool Checkpoint
+::read(const std::string &path, size_t &snr_id, float &snr, std::vector<std::string> &states)
+{
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	std::string magic, key_snr_id, key_snr, key_n_threads;
+	int version = 0;
+	size_t n_threads = 0;
+
+	file >> magic >> version;
+	file >> key_snr_id >> snr_id >> key_snr >> snr >> key_n_threads >> n_threads;
+
+	if (file.fail() || magic != checkpoint_magic || version != checkpoint_version || key_snr_id != "snr_id" ||
+	    key_snr != "snr" || key_n_threads != "n_threads")
+	{
+		std::stringstream message;
+		message << "The checkpoint file is corrupted ('path' = " << path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	states.resize(n_threads);
+	for (auto &s : states)
+	{
+		size_t size = 0;
+		file >> size;
+		file.get(); // the end of line after the size
+
+		s.resize(size);
+		file.read(&s[0], size);
+
+		if (file.fail())
+		{
+			std::stringstream message;
+			message << "The checkpoint file is corrupted ('path' = " << path << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	return true;
+}
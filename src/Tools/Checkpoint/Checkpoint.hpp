@@ -0,0 +1,135 @@
+/*!
+ * \file
+ * \brief Periodic snapshots of the simulation state, written by a background thread.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef CHECKPOINT_HPP_
+#define CHECKPOINT_HPP_
+
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <condition_variable>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Checkpoint
+ *
+ * \brief Periodic snapshots of the simulation state, written by a background thread.
+ *
+ * Every "frequency" the writer thread asks the simulation threads for their state. Each thread serializes its own
+ * state (its PRNGs, its error counters, ...) between two frames with "submit" and goes on, the file is written by the
+ * writer thread once all the threads have answered: the simulation threads never wait for the I/O. A thread which
+ * leaves the current SNR point cancels the pending snapshot (the end of the point is saved by the master thread with
+ * "write").
+ *
+ * The file is first written next to the previous one and then renamed, a crash during the write can't corrupt the
+ * last checkpoint.
+ */
+class Checkpoint
+{
+private:
+	const std::string          path;
+	const int                  n_threads;
+	const std::chrono::seconds frequency;
+
+	std::atomic<unsigned>    request;   // incremented by the writer thread to ask for a snapshot
+	std::vector<unsigned>    served;    // the last request served by each thread (only used by this thread)
+	std::vector<std::string> states;    // the states of the pending snapshot
+	int                      n_submitted;
+	int                      n_left;    // the number of threads which have left the current SNR point
+	size_t                   snr_id;
+	float                    snr;
+	bool                     stopping;
+
+	std::mutex              mutex_states;
+	std::condition_variable cv_states;
+	std::thread             writer;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param path:      the path of the checkpoint file.
+	 * \param n_threads: the number of simulation threads.
+	 * \param frequency: the time between two snapshots.
+	 */
+	Checkpoint(const std::string &path, const int n_threads, const std::chrono::seconds frequency);
+
+	/*!
+	 * \brief Destructor, stops the writer thread.
+	 */
+	~Checkpoint();
+
+	const std::string& get_path() const;
+
+	/*!
+	 * \brief Starts the writer thread for a new SNR point (no simulation thread has to be running).
+	 *
+	 * \param snr_id: the index of the SNR point in the simulated range.
+	 * \param snr:    the SNR value (to check the consistency when resuming).
+	 */
+	void start(const size_t snr_id, const float snr);
+
+	/*!
+	 * \brief Stops the writer thread (a pending snapshot is dropped).
+	 */
+	void stop();
+
+	/*!
+	 * \brief Simulation thread side, returns true when the writer thread is waiting for the state of the thread.
+	 */
+	inline bool is_requested(const int tid) const
+	{
+		return this->request.load(std::memory_order_relaxed) != this->served[tid];
+	}
+
+	/*!
+	 * \brief Simulation thread side, gives the state of the thread for the pending snapshot.
+	 *
+	 * \param tid:   the thread id.
+	 * \param state: the serialized state of the thread.
+	 */
+	void submit(const int tid, const std::string &state);
+
+	/*!
+	 * \brief Simulation thread side, the thread does not simulate the current SNR point anymore.
+	 */
+	void leave(const int tid);
+
+	/*!
+	 * \brief Writes a checkpoint file synchronously.
+	 *
+	 * \param snr_id: the index of the SNR point to resume.
+	 * \param snr:    the SNR value of this point.
+	 * \param states: the serialized state of each thread.
+	 */
+	void write(const size_t snr_id, const float snr, const std::vector<std::string> &states) const;
+
+	/*!
+	 * \brief Reads a checkpoint file.
+	 *
+	 * \param path:   the path of the checkpoint file.
+	 * \param snr_id: the index of the SNR point to resume.
+	 * \param snr:    the SNR value of this point.
+	 * \param states: the serialized state of each thread.
+	 *
+	 * \return false if there is no checkpoint file, an exception is raised if the file is corrupted.
+	 */
+	static bool read(const std::string &path, size_t &snr_id, float &snr, std::vector<std::string> &states);
+
+private:
+	void writer_loop();
+};
+}
+}
+
+#endif /* CHECKPOINT_HPP_ */
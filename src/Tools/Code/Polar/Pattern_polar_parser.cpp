@@ -51,6 +51,41 @@ Pattern_polar_parser
 	this->generate_nodes_indexes           (this->polar_tree->get_root());
 }
 
+static std::vector<Pattern_polar_i*> clone_patterns(const std::vector<Pattern_polar_i*> &patterns)
+{
+	std::vector<Pattern_polar_i*> clones;
+	for (auto *p : patterns)
+		clones.push_back(p->clone());
+	return clones;
+}
+
+// the terminal patterns are usually contained in the patterns vector, in this case their clone is reused
+static const Pattern_polar_i* clone_pattern(const Pattern_polar_i *pattern,
+                                            const std::vector<Pattern_polar_i*> &patterns,
+                                            const std::vector<Pattern_polar_i*> &clones)
+{
+	for (size_t i = 0; i < patterns.size(); i++)
+		if (patterns[i] == pattern)
+			return clones[i];
+	return pattern->clone();
+}
+
+Pattern_polar_parser
+::Pattern_polar_parser(const Pattern_polar_parser &p)
+: N(p.N),
+  m(p.m),
+  frozen_bits(p.frozen_bits),
+  patterns(clone_patterns(p.patterns)),
+  pattern_rate0(clone_pattern(p.pattern_rate0, p.patterns, this->patterns)),
+  pattern_rate1(clone_pattern(p.pattern_rate1, p.patterns, this->patterns)),
+  polar_tree(new Binary_tree<Pattern_polar_i>(m +1)),
+  pattern_types(),
+  leaves_pattern_types()
+{
+	this->recursive_allocate_nodes_patterns(this->polar_tree->get_root());
+	this->generate_nodes_indexes           (this->polar_tree->get_root());
+}
+
 Pattern_polar_parser
 ::~Pattern_polar_parser()
 {
@@ -71,6 +71,12 @@ public:
 	                     const int pattern_rate0_id,
 	                     const int pattern_rate1_id);
 
+	/*!
+	 * \brief Copy constructor, the patterns are cloned (they have to be released with "release_patterns") and the
+	 *        tree of patterns is rebuilt.
+	 */
+	Pattern_polar_parser(const Pattern_polar_parser &p);
+
 	/*!
 	 * \brief Destructor.
 	 */
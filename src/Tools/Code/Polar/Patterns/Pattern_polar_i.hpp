@@ -142,6 +142,7 @@ public:
 	inline int get_max_lvl() { return max_level; }
 
 	virtual Pattern_polar_i* alloc(const int &n, const Binary_node<Pattern_polar_i>* node) const = 0;
+	virtual Pattern_polar_i* clone(                                                       ) const = 0;
 
 	virtual polar_node_t type()       const = 0;
 	virtual std::string  name()       const = 0;
@@ -33,6 +33,11 @@ public:
 		return new Pattern_polar_r0(N, node, min_level, max_level);
 	}
 
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_r0(*this);
+	}
+
 	virtual ~Pattern_polar_r0() {}
 
 	virtual polar_node_t type()       const { return polar_node_t::RATE_0; }
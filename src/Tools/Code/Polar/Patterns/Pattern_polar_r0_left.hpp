@@ -49,6 +49,11 @@ public:
 		return new Pattern_polar_r0_left(N, node, min_level, max_level);
 	}
 
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_r0_left(*this);
+	}
+
 	virtual ~Pattern_polar_r0_left() {}
 
 	virtual polar_node_t type()       const { return polar_node_t::RATE_0_LEFT; }
@@ -33,6 +33,11 @@ public:
 		return new Pattern_polar_r1(N, node, min_level, max_level);
 	}
 
+	virtual Pattern_polar_i* clone() const
+	{
+		return new Pattern_polar_r1(*this);
+	}
+
 	virtual ~Pattern_polar_r1() {}
 
 	virtual polar_node_t type()       const { return polar_node_t::RATE_1; }
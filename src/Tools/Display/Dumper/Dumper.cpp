@@ -1,9 +1,15 @@
+#include <cstdio>
 #include <string>
 #include <vector>
+#include <iomanip>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
+#include <type_traits>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
+#include "Tools/Math/utils.h"
 
 #include "Dumper.hpp"
 
@@ -11,6 +17,10 @@ using namespace aff3ct;
 using namespace aff3ct::tools;
 
 const std::string aff3ct::tools::Dumper::default_ext = "dump";
+const std::string aff3ct::tools::Dumper::bits_magic  = "BITS";
+
+// the number of frames is written on a fixed width in the text files, it is updated when the file is closed
+static const int n_data_width = 10;
 
 Dumper
 ::Dumper()
@@ -21,12 +31,14 @@ Dumper
 Dumper
 ::~Dumper()
 {
+	this->drop_files();
 }
 
 template <typename T>
 void Dumper
 ::register_data(const T *ptr, const unsigned size, const unsigned add_threshold, const std::string &file_ext,
-                const bool binary_mode, const unsigned n_frames, std::vector<unsigned> headers)
+                const bool binary_mode, const unsigned n_frames, std::vector<unsigned> headers,
+                const packing_t packing, const bool once)
 {
 	if (ptr == nullptr)
 		throw invalid_argument(__FILE__, __LINE__, __func__, "'ptr' can't be null.");
@@ -48,16 +60,58 @@ void Dumper
 		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	this->buffer.push_back(std::vector<std::vector<char>>());
+	if (packing == packing_t::BITS && !std::is_integral<T>::value)
+		throw invalid_argument(__FILE__, __LINE__, __func__, "Only the integers can be bit-packed.");
+
+	if (packing == packing_t::HALF && !std::is_floating_point<T>::value)
+		throw invalid_argument(__FILE__, __LINE__, __func__, "Only the floating-point numbers can be stored in half "
+		                                                     "precision.");
+
+	unsigned bytes;
+	std::function<void(const char*,char*)> store;
+	switch (packing)
+	{
+		case packing_t::BITS:
+			bytes = (size + 7) / 8;
+			store = [size](const char *in, char *out)
+			{
+				Bit_packer<T>::pack((const T*)in, (T*)out, (int)size);
+			};
+			break;
+		case packing_t::HALF:
+			bytes = size * (unsigned)sizeof(uint16_t);
+			store = [size](const char *in, char *out)
+			{
+				for (unsigned i = 0; i < size; i++)
+				{
+					const auto h = float_to_half((float)((const T*)in)[i]);
+					std::copy((const char*)&h, (const char*)&h + sizeof(h), out + i * sizeof(h));
+				}
+			};
+			break;
+		default:
+			bytes = size * (unsigned)sizeof(T);
+			store = [bytes](const char *in, char *out)
+			{
+				std::copy(in, in + bytes, out);
+			};
+			break;
+	}
+
+	this->buffer.push_back(std::vector<char>());
 
 	this->registered_data_ptr     .push_back((char*)ptr );
 	this->registered_data_size    .push_back(size       );
 	this->registered_data_sizeof  .push_back(sizeof(T)  );
 	this->registered_data_type    .push_back(typeid(T)  );
 	this->registered_data_ext     .push_back(file_ext   );
-	this->registered_data_bin     .push_back(binary_mode);
+	this->registered_data_bin     .push_back(binary_mode || packing != packing_t::NONE);
 	this->registered_data_head    .push_back(headers    );
 	this->registered_data_n_frames.push_back(n_frames   );
+	this->registered_data_pack    .push_back(packing    );
+	this->registered_data_once    .push_back(once       );
+	this->registered_data_bytes   .push_back(bytes      );
+	this->registered_data_store   .push_back(store      );
 
 	this->add_threshold = add_threshold;
 }
@@ -65,7 +119,8 @@ void Dumper
 template <typename T, class A>
 void Dumper
 ::register_data(const std::vector<T,A> &data, const unsigned add_threshold, const std::string &file_ext,
-                const bool binary_mode, const unsigned n_frames, std::vector<unsigned> headers)
+                const bool binary_mode, const unsigned n_frames, std::vector<unsigned> headers,
+                const packing_t packing, const bool once)
 {
 	if (n_frames == 0)
 	{
@@ -75,7 +130,7 @@ void Dumper
 	};
 
 	this->register_data(data.data(), (unsigned)(data.size() / n_frames), add_threshold,
-	                    file_ext, binary_mode, n_frames, headers);
+	                    file_ext, binary_mode, n_frames, headers, packing, once);
 }
 
 
@@ -92,18 +147,18 @@ void Dumper
 	if (n_err < this->add_threshold)
 		return;
 
+	// the buffers can be emptied by a writer thread (see Dumper_reduction)
+	std::lock_guard<std::mutex> lock(this->mutex_buffer);
 	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
 	{
 		if ((unsigned)frame_id < this->registered_data_n_frames[i])
 		{
-			const auto ptr   = this->registered_data_ptr [i];
-			const auto bytes = this->registered_data_size[i] * this->registered_data_sizeof[i];
+			const auto ptr   = this->registered_data_ptr   [i];
+			const auto bytes = this->registered_data_size  [i] * this->registered_data_sizeof[i];
+			const auto size  = this->buffer[i].size();
 
-			this->buffer[i].push_back(std::vector<char>(bytes));
-
-			std::copy(ptr + bytes * (frame_id +0),
-			          ptr + bytes * (frame_id +1),
-			          this->buffer[i][this->buffer[i].size() -1].begin());
+			this->buffer[i].resize(size + this->registered_data_bytes[i]);
+			this->registered_data_store[i](ptr + bytes * frame_id, this->buffer[i].data() + size);
 		}
 	}
 }
@@ -114,40 +169,19 @@ void Dumper
 	if (base_path.empty())
 		throw invalid_argument(__FILE__, __LINE__, __func__, "'base_path' can't be empty.");
 
-	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
-	{
-		const auto size    = this->registered_data_size  [i];
-		const auto size_of = this->registered_data_sizeof[i];
-		const auto type    = this->registered_data_type  [i];
-		const auto ext     = this->registered_data_ext   [i];
-		const auto bin     = this->registered_data_bin   [i];
-		const auto head    = this->registered_data_head  [i];
-
-		const std::string path = base_path + "." + ext;
-
-		std::ofstream file;
-		if (bin)
-		{
-			file.open(path, std::ofstream::out | std::ios_base::binary);
+	this->open_files(base_path);
 
-			this->write_header_binary(file, (unsigned)this->buffer[i].size(), size, head);
-			this->write_body_binary  (file, this->buffer[i], size * size_of);
-		}
-		else
-		{
-			file.open(path, std::ofstream::out);
-
-			this->write_header_text(file, (unsigned)this->buffer[i].size(), size, head);
-			this->write_body_text  (file, this->buffer[i], size, type);
-		}
+	std::lock_guard<std::mutex> lock(this->mutex_buffer);
+	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
+		this->write_data(i, this->buffer[i]);
 
-		file.close();
-	}
+	this->close_files();
 }
 
 void Dumper
 ::clear()
 {
+	std::lock_guard<std::mutex> lock(this->mutex_buffer);
 	for (auto &b : this->buffer)
 		b.clear();
 //	this->buffer.clear();
@@ -162,46 +196,170 @@ void Dumper
 }
 
 void Dumper
-::write_header_text(std::ofstream &file, const unsigned n_data, const unsigned data_size,
-                    const std::vector<unsigned> &headers)
+::open_files(const std::string& base_path)
 {
-	file << n_data    << std::endl << std::endl;
-	file << data_size << std::endl << std::endl;
-	for (auto h : headers)
-		file << h << " ";
-	if (headers.size())
-		file << std::endl << std::endl;
+	this->close_files();
+
+	this->files.resize(this->registered_data_ptr.size());
+	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
+	{
+		auto &f = this->files[i];
+
+		f.path       = base_path + "." + this->registered_data_ext[i];
+		f.n_data     = 0;
+		f.n_repeated = 0;
+		f.constant   = true;
+		f.first.clear();
+
+		if (this->registered_data_bin[i])
+		{
+			f.stream.open(f.path, std::ofstream::out | std::ios_base::binary);
+			if (this->registered_data_pack[i] == packing_t::BITS)
+				f.stream.write(bits_magic.data(), bits_magic.size());
+			f.n_data_pos = f.stream.tellp();
+			this->write_header_binary(f.stream, 0, this->registered_data_size[i], this->registered_data_head[i]);
+		}
+		else
+		{
+			f.stream.open(f.path, std::ofstream::out);
+			f.n_data_pos = f.stream.tellp();
+			this->write_header_text(f.stream, 0, this->registered_data_size[i], this->registered_data_head[i]);
+		}
+
+		if (!f.stream.is_open() || f.stream.fail())
+		{
+			std::stringstream message;
+			message << "Impossible to open the dump file ('path' = " << f.path << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+}
+
+void Dumper
+::write_data(const int i, const std::vector<char> &frames)
+{
+	auto &f = this->files[i];
+	const auto bytes = this->registered_data_bytes[i];
+
+	for (size_t off = 0; off + bytes <= frames.size(); off += bytes)
+	{
+		const auto frame = frames.data() + off;
+
+		if (this->registered_data_once[i] && f.constant)
+		{
+			if (f.n_data == 0)
+				f.first.assign(frame, frame + bytes);
+			else if (std::equal(frame, frame + bytes, f.first.begin()))
+			{
+				f.n_repeated++;
+				continue;
+			}
+			else
+			{
+				// the data is not constant, the frames which have been skipped are written
+				for (; f.n_repeated > 0; f.n_repeated--, f.n_data++)
+					this->write_frame(i, f.first.data());
+				f.constant = false;
+				f.first.clear();
+			}
+		}
+
+		this->write_frame(i, frame);
+		f.n_data++;
+	}
 }
 
 void Dumper
-::write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size,
-                  const std::type_index type)
+::close_files()
 {
-	if      (type == typeid( int8_t )) this->_write_body_text< int8_t >(file, buffer, size);
-	else if (type == typeid(uint8_t )) this->_write_body_text<uint8_t >(file, buffer, size);
-	else if (type == typeid( int16_t)) this->_write_body_text< int16_t>(file, buffer, size);
-	else if (type == typeid(uint16_t)) this->_write_body_text<uint16_t>(file, buffer, size);
-	else if (type == typeid( int32_t)) this->_write_body_text< int32_t>(file, buffer, size);
-	else if (type == typeid(uint32_t)) this->_write_body_text<uint32_t>(file, buffer, size);
-	else if (type == typeid( int64_t)) this->_write_body_text< int64_t>(file, buffer, size);
-	else if (type == typeid(uint64_t)) this->_write_body_text<uint64_t>(file, buffer, size);
-	else if (type == typeid(float   )) this->_write_body_text<float   >(file, buffer, size);
-	else if (type == typeid(double  )) this->_write_body_text<double  >(file, buffer, size);
+	std::vector<std::string> failed;
+	for (auto i = 0; i < (int)this->files.size(); i++)
+	{
+		auto &f = this->files[i];
+		if (!f.stream.is_open())
+			continue;
+
+		// the number of frames was unknown when the header has been written
+		f.stream.seekp(f.n_data_pos);
+		if (this->registered_data_bin[i])
+			f.stream.write((char*)&f.n_data, sizeof(f.n_data));
+		else
+			f.stream << std::setw(n_data_width) << f.n_data;
+
+		f.stream.close();
+		if (f.stream.fail())
+			failed.push_back(f.path);
+	}
+	this->files.clear();
+
+	if (failed.size())
+	{
+		std::stringstream message;
+		message << "Impossible to write the dump file ('path' = " << failed[0] << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+void Dumper
+::drop_files()
+{
+	for (auto &f : this->files)
+		if (f.stream.is_open())
+		{
+			f.stream.close();
+			std::remove(f.path.c_str());
+		}
+	this->files.clear();
+}
+
+void Dumper
+::write_frame(const int i, const char *frame)
+{
+	auto &file = this->files[i].stream;
+
+	if (this->registered_data_bin[i])
+	{
+		file.write(frame, this->registered_data_bytes[i]);
+		return;
+	}
+
+	const auto type = this->registered_data_type[i];
+	const auto size = this->registered_data_size[i];
+
+	if      (type == typeid( int8_t )) this->_write_frame_text< int8_t >(file, frame, size);
+	else if (type == typeid(uint8_t )) this->_write_frame_text<uint8_t >(file, frame, size);
+	else if (type == typeid( int16_t)) this->_write_frame_text< int16_t>(file, frame, size);
+	else if (type == typeid(uint16_t)) this->_write_frame_text<uint16_t>(file, frame, size);
+	else if (type == typeid( int32_t)) this->_write_frame_text< int32_t>(file, frame, size);
+	else if (type == typeid(uint32_t)) this->_write_frame_text<uint32_t>(file, frame, size);
+	else if (type == typeid( int64_t)) this->_write_frame_text< int64_t>(file, frame, size);
+	else if (type == typeid(uint64_t)) this->_write_frame_text<uint64_t>(file, frame, size);
+	else if (type == typeid(float   )) this->_write_frame_text<float   >(file, frame, size);
+	else if (type == typeid(double  )) this->_write_frame_text<double  >(file, frame, size);
 	else
 		throw invalid_argument(__FILE__, __LINE__, __func__, "Unsupported data type.");
 }
 
 template <typename T>
 void Dumper
-::_write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size)
+::_write_frame_text(std::ofstream &file, const char *frame, const unsigned size)
 {
-	for (auto b : buffer)
-	{
-		const auto data = (T*)b.data();
-		for (unsigned i = 0; i < size; i++)
-			file << +data[i] << " ";
+	const auto data = (const T*)frame;
+	for (unsigned i = 0; i < size; i++)
+		file << +data[i] << " ";
+	file << std::endl << std::endl;
+}
+
+void Dumper
+::write_header_text(std::ofstream &file, const unsigned n_data, const unsigned data_size,
+                    const std::vector<unsigned> &headers)
+{
+	file << std::setw(n_data_width) << n_data << std::endl << std::endl;
+	file << data_size << std::endl << std::endl;
+	for (auto h : headers)
+		file << h << " ";
+	if (headers.size())
 		file << std::endl << std::endl;
-	}
 }
 
 void Dumper
@@ -214,52 +372,45 @@ void Dumper
 		file.write((char*)&h, sizeof(h));
 }
 
-void Dumper
-::write_body_binary(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned bytes)
-{
-	for (auto b : buffer)
-		file.write(reinterpret_cast<char*>(b.data()), b.size());
-}
-
 // ==================================================================================== explicit template instantiation
-template void Dumper::register_data<int8_t  >(const int8_t*,   const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint8_t >(const uint8_t*,  const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<int16_t >(const int16_t*,  const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint16_t>(const uint16_t*, const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<int32_t >(const int32_t*,  const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint32_t>(const uint32_t*, const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<int64_t >(const int64_t*,  const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint64_t>(const uint64_t*, const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<float   >(const float*,    const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<double  >(const double*,   const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-
-template void Dumper::register_data<int8_t,   std::allocator<int8_t  >>(const std::vector<int8_t,   std::allocator<int8_t  >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint8_t,  std::allocator<uint8_t >>(const std::vector<uint8_t,  std::allocator<uint8_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<int16_t,  std::allocator<int16_t >>(const std::vector<int16_t,  std::allocator<int16_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint16_t, std::allocator<uint16_t>>(const std::vector<uint16_t, std::allocator<uint16_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<int32_t,  std::allocator<int32_t >>(const std::vector<int32_t,  std::allocator<int32_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint32_t, std::allocator<uint32_t>>(const std::vector<uint32_t, std::allocator<uint32_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<int64_t,  std::allocator<int64_t >>(const std::vector<int64_t,  std::allocator<int64_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint64_t, std::allocator<uint64_t>>(const std::vector<uint64_t, std::allocator<uint64_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<float,    std::allocator<float   >>(const std::vector<float,    std::allocator<float   >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<double,   std::allocator<double  >>(const std::vector<double,   std::allocator<double  >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
+template void Dumper::register_data<int8_t  >(const int8_t*,   const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint8_t >(const uint8_t*,  const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<int16_t >(const int16_t*,  const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint16_t>(const uint16_t*, const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<int32_t >(const int32_t*,  const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint32_t>(const uint32_t*, const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<int64_t >(const int64_t*,  const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint64_t>(const uint64_t*, const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<float   >(const float*,    const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<double  >(const double*,   const unsigned, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+
+template void Dumper::register_data<int8_t,   std::allocator<int8_t  >>(const std::vector<int8_t,   std::allocator<int8_t  >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint8_t,  std::allocator<uint8_t >>(const std::vector<uint8_t,  std::allocator<uint8_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<int16_t,  std::allocator<int16_t >>(const std::vector<int16_t,  std::allocator<int16_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint16_t, std::allocator<uint16_t>>(const std::vector<uint16_t, std::allocator<uint16_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<int32_t,  std::allocator<int32_t >>(const std::vector<int32_t,  std::allocator<int32_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint32_t, std::allocator<uint32_t>>(const std::vector<uint32_t, std::allocator<uint32_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<int64_t,  std::allocator<int64_t >>(const std::vector<int64_t,  std::allocator<int64_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint64_t, std::allocator<uint64_t>>(const std::vector<uint64_t, std::allocator<uint64_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<float,    std::allocator<float   >>(const std::vector<float,    std::allocator<float   >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<double,   std::allocator<double  >>(const std::vector<double,   std::allocator<double  >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
 
 #include <mipp.h>
-template void Dumper::register_data<int8_t,   mipp::allocator<int8_t  >>(const std::vector<int8_t,   mipp::allocator<int8_t  >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint8_t,  mipp::allocator<uint8_t >>(const std::vector<uint8_t,  mipp::allocator<uint8_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<int16_t,  mipp::allocator<int16_t >>(const std::vector<int16_t,  mipp::allocator<int16_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint16_t, mipp::allocator<uint16_t>>(const std::vector<uint16_t, mipp::allocator<uint16_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<int32_t,  mipp::allocator<int32_t >>(const std::vector<int32_t,  mipp::allocator<int32_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint32_t, mipp::allocator<uint32_t>>(const std::vector<uint32_t, mipp::allocator<uint32_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<int64_t,  mipp::allocator<int64_t >>(const std::vector<int64_t,  mipp::allocator<int64_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<uint64_t, mipp::allocator<uint64_t>>(const std::vector<uint64_t, mipp::allocator<uint64_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<float,    mipp::allocator<float   >>(const std::vector<float,    mipp::allocator<float   >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-template void Dumper::register_data<double,   mipp::allocator<double  >>(const std::vector<double,   mipp::allocator<double  >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>);
-
-template void Dumper::_write_body_text<int8_t >(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<int16_t>(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<int32_t>(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<int64_t>(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<float  >(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
-template void Dumper::_write_body_text<double >(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
+template void Dumper::register_data<int8_t,   mipp::allocator<int8_t  >>(const std::vector<int8_t,   mipp::allocator<int8_t  >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint8_t,  mipp::allocator<uint8_t >>(const std::vector<uint8_t,  mipp::allocator<uint8_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<int16_t,  mipp::allocator<int16_t >>(const std::vector<int16_t,  mipp::allocator<int16_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint16_t, mipp::allocator<uint16_t>>(const std::vector<uint16_t, mipp::allocator<uint16_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<int32_t,  mipp::allocator<int32_t >>(const std::vector<int32_t,  mipp::allocator<int32_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint32_t, mipp::allocator<uint32_t>>(const std::vector<uint32_t, mipp::allocator<uint32_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<int64_t,  mipp::allocator<int64_t >>(const std::vector<int64_t,  mipp::allocator<int64_t >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<uint64_t, mipp::allocator<uint64_t>>(const std::vector<uint64_t, mipp::allocator<uint64_t>>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<float,    mipp::allocator<float   >>(const std::vector<float,    mipp::allocator<float   >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+template void Dumper::register_data<double,   mipp::allocator<double  >>(const std::vector<double,   mipp::allocator<double  >>&, const unsigned, const std::string&, const bool, const unsigned, std::vector<unsigned>, const Dumper::packing_t, const bool);
+
+template void Dumper::_write_frame_text<int8_t >(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<int16_t>(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<int32_t>(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<int64_t>(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<float  >(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<double >(std::ofstream&, const char*, const unsigned);
 // ==================================================================================== explicit template instantiation
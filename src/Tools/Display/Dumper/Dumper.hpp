@@ -2,10 +2,12 @@
 #define DUMPER_HPP_
 
 #include <tuple>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <fstream>
 #include <typeindex>
+#include <functional>
 
 namespace aff3ct
 {
@@ -16,10 +18,22 @@ class Dumper
 {
 	friend Dumper_reduction;
 
+public:
+	// how the frames of a registered data are stored in the dump files
+	enum class packing_t { NONE, // as they are in memory
+	                       BITS, // 1 bit per data (binary file starting with "bits_magic")
+	                       HALF  // IEEE 754 half precision floats (binary file)
+	                     };
+
+	// the first bytes of a bit-packed dump file
+	static const std::string bits_magic;
+
 protected:
 	static const std::string default_ext;
 
-	std::vector<std::vector<std::vector<char>>> buffer;
+	// the stored frames of each registered data (one after the other)
+	std::vector<std::vector<char>> buffer;
+	std::mutex                     mutex_buffer;
 
 	unsigned                           add_threshold;
 	std::vector<const char*>           registered_data_ptr;
@@ -30,36 +44,66 @@ protected:
 	std::vector<bool>                  registered_data_bin;
 	std::vector<std::vector<unsigned>> registered_data_head;
 	std::vector<unsigned>              registered_data_n_frames;
+	std::vector<packing_t>             registered_data_pack;
+	std::vector<bool>                  registered_data_once;  // a data which never changes is written once
+	std::vector<unsigned>              registered_data_bytes; // the number of bytes of a stored frame
+	std::vector<std::function<void(const char*,char*)>> registered_data_store;
+
+	// the dump files in which the frames are written
+	struct file_t
+	{
+		std::ofstream     stream;
+		std::string       path;
+		std::streampos    n_data_pos; // where the number of frames is written in the header
+		unsigned          n_data;     // the number of frames written in the file
+		unsigned          n_repeated; // the number of frames equal to the first one and not written (yet)
+		bool              constant;
+		std::vector<char> first;
+	};
+	std::vector<file_t> files;
 
 public:
 	Dumper(/*const int n_frames = 1*/);
 	virtual ~Dumper();
 
+	/*!
+	 * \brief Registers a data to dump for each added frame.
+	 *
+	 * \param packing: how the frames are stored ("BITS" for integers, "HALF" for floating-point numbers, both are
+	 *                 written in binary files).
+	 * \param once:    if the data is the same in all the added frames, it is written only once in the file (the
+	 *                 number of frames in the header is then 1).
+	 */
 	template <typename T>
 	void register_data(const T *ptr, const unsigned size, const unsigned add_threshold = 0,
 	                   const std::string &file_ext = default_ext, const bool binary_mode = false, const unsigned n_frames = 1,
-	                   std::vector<unsigned> headers = std::vector<unsigned>());
+	                   std::vector<unsigned> headers = std::vector<unsigned>(), const packing_t packing = packing_t::NONE,
+	                   const bool once = false);
 	template <typename T, class A = std::allocator<T>>
 	void register_data(const std::vector<T,A> &data, const unsigned add_threshold = 0,
 	                   const std::string &file_ext = default_ext, const bool binary_mode = false, const unsigned n_frames = 1,
-	                   std::vector<unsigned> headers = std::vector<unsigned>());
+	                   std::vector<unsigned> headers = std::vector<unsigned>(), const packing_t packing = packing_t::NONE,
+	                   const bool once = false);
 
 	virtual void dump (const std::string& base_path                );
 	virtual void add  (const unsigned n_err, const int frame_id = 0);
 	virtual void clear(                                            );
 
 protected:
+	void open_files (const std::string& base_path);
+	void write_data (const int i, const std::vector<char> &frames);
+	void close_files();
+	void drop_files ();
+
+	void write_frame(const int i, const char *frame);
 	void write_header_text(std::ofstream &file, const unsigned n_data, const unsigned data_size,
 	                       const std::vector<unsigned> &headers);
-	void write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size,
-	                     const std::type_index type);
 	void write_header_binary(std::ofstream &file, const unsigned n_data, const unsigned data_size,
 	                         const std::vector<unsigned> &headers);
-	void write_body_binary(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned bytes);
 
 private:
 	template <typename T>
-	void _write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size);
+	void _write_frame_text(std::ofstream &file, const char *frame, const unsigned size);
 };
 }
 }
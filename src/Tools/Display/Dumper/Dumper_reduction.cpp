@@ -10,9 +10,16 @@
 using namespace aff3ct::tools;
 
 Dumper_reduction
-::Dumper_reduction(std::vector<Dumper*> &dumpers)
-: Dumper(), dumpers(dumpers)
+::Dumper_reduction(std::vector<Dumper*> &dumpers, const std::chrono::milliseconds flush_period)
+: Dumper(), dumpers(dumpers), flush_period(flush_period), stopping(true)
 {
+	if (flush_period <= std::chrono::milliseconds(0))
+	{
+		std::stringstream message;
+		message << "'flush_period' has to be greater than 0 ('flush_period' = " << flush_period.count() << " ms).";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	this->checks();
 }
 
@@ -45,6 +52,8 @@ void Dumper_reduction
 			const auto bin_ref    = dumpers[0]->registered_data_bin     [i];
 			const auto head_ref   = dumpers[0]->registered_data_head    [i];
 			const auto fra_ref    = dumpers[0]->registered_data_n_frames[i];
+			const auto pack_ref   = dumpers[0]->registered_data_pack    [i];
+			const auto once_ref   = dumpers[0]->registered_data_once    [i];
 
 			for (auto j = 1; j < (int)dumpers.size(); j++)
 			{
@@ -55,6 +64,8 @@ void Dumper_reduction
 				const auto bin_cur    = dumpers[j]->registered_data_bin     [i];
 				const auto head_cur   = dumpers[j]->registered_data_head    [i];
 				const auto fra_cur    = dumpers[j]->registered_data_n_frames[i];
+				const auto pack_cur   = dumpers[j]->registered_data_pack    [i];
+				const auto once_cur   = dumpers[j]->registered_data_once    [i];
 
 				if (size_cur != size_ref)
 				{
@@ -110,6 +121,22 @@ void Dumper_reduction
 					        << ", 'fra_ref' = " << fra_ref << ").";
 					throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 				}
+
+				if (pack_cur != pack_ref)
+				{
+					std::stringstream message;
+					message << "'pack_cur' should be equal to 'pack_ref' ('pack_cur' = " << (int)pack_cur
+					        << ", 'pack_ref' = " << (int)pack_ref << ").";
+					throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+				}
+
+				if (once_cur != once_ref)
+				{
+					std::stringstream message;
+					message << "'once_cur' should be equal to 'once_ref' ('once_cur' = " << once_cur
+					        << ", 'once_ref' = " << once_ref << ").";
+					throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+				}
 			}
 		}
 	}
@@ -124,6 +151,7 @@ void Dumper_reduction
 Dumper_reduction
 ::~Dumper_reduction()
 {
+	this->stop();
 }
 
 void Dumper_reduction
@@ -133,7 +161,7 @@ void Dumper_reduction
 }
 
 void Dumper_reduction
-::dump(const std::string& base_path)
+::open(const std::string& base_path)
 {
 	this->checks();
 
@@ -141,6 +169,7 @@ void Dumper_reduction
 		throw invalid_argument(__FILE__, __LINE__, __func__, "'base_path' can't be empty.");
 
 	this->buffer             .resize(dumpers[0]->buffer.size());
+	this->frames             .resize(dumpers[0]->buffer.size());
 	this->registered_data_ptr.resize(dumpers[0]->registered_data_ptr.size());
 
 	this->registered_data_size   = dumpers[0]->registered_data_size;
@@ -149,49 +178,90 @@ void Dumper_reduction
 	this->registered_data_ext    = dumpers[0]->registered_data_ext;
 	this->registered_data_bin    = dumpers[0]->registered_data_bin;
 	this->registered_data_head   = dumpers[0]->registered_data_head;
+	this->registered_data_pack   = dumpers[0]->registered_data_pack;
+	this->registered_data_once   = dumpers[0]->registered_data_once;
+	this->registered_data_bytes  = dumpers[0]->registered_data_bytes;
+
+	this->open_files(base_path);
+}
+
+void Dumper_reduction
+::start(const std::string& base_path)
+{
+	this->stop();
+	this->open(base_path);
+
+	this->stopping = false;
+	this->writer = std::thread(&Dumper_reduction::writer_loop, this);
+}
 
-	for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
+void Dumper_reduction
+::stop()
+{
 	{
-		unsigned n_data = (unsigned)this->buffer[i].size();
-		for (auto d : this->dumpers)
-			n_data += (unsigned)d->buffer[i].size();
+		std::lock_guard<std::mutex> lock(this->mutex_writer);
+		this->stopping = true;
+	}
+	this->cv_writer.notify_all();
 
-		const auto size    = this->registered_data_size  [i];
-		const auto size_of = this->registered_data_sizeof[i];
-		const auto type    = this->registered_data_type  [i];
-		const auto ext     = this->registered_data_ext   [i];
-		const auto bin     = this->registered_data_bin   [i];
-		const auto head    = this->registered_data_head  [i];
+	if (this->writer.joinable())
+		this->writer.join();
+}
 
-		const std::string path = base_path + "." + ext;
+void Dumper_reduction
+::writer_loop()
+{
+	std::unique_lock<std::mutex> lock(this->mutex_writer);
+	while (!this->stopping)
+	{
+		if (this->cv_writer.wait_for(lock, this->flush_period, [this]() { return this->stopping; }))
+			break;
 
-		std::ofstream file;
-		if (bin)
-		{
-			file.open(path, std::ofstream::out | std::ios_base::binary);
+		lock.unlock();
+		this->flush();
+		lock.lock();
+	}
+}
 
-			this->write_header_binary(file, n_data, size, head);
-			this->write_body_binary(file, this->buffer[i], size * size_of);
-			for (auto d : this->dumpers)
-				this->write_body_binary(file, d->buffer[i], size * size_of);
-		}
-		else
+void Dumper_reduction
+::flush()
+{
+	// the frames of a Dumper are taken all at once, the files stay consistent (the i-th frame of each file comes from
+	// the same simulated frame)
+	for (auto d : this->dumpers)
+	{
 		{
-			file.open(path, std::ofstream::out);
-
-			this->write_header_text(file, n_data, size, head);
-			this->write_body_text(file, this->buffer[i], size, type);
-			for (auto d : this->dumpers)
-				this->write_body_text(file, d->buffer[i], size, type);
+			std::lock_guard<std::mutex> lock(d->mutex_buffer);
+			for (size_t i = 0; i < this->frames.size(); i++)
+				this->frames[i].swap(d->buffer[i]);
 		}
 
-		file.close();
+		for (auto i = 0; i < (int)this->frames.size(); i++)
+		{
+			this->write_data(i, this->frames[i]);
+			this->frames[i].clear();
+		}
 	}
 }
 
+void Dumper_reduction
+::dump(const std::string& base_path)
+{
+	this->stop();
+
+	if (this->files.empty())
+		this->open(base_path);
+
+	this->flush();
+	this->close_files();
+}
+
 void Dumper_reduction
 ::clear()
 {
+	this->stop();
+	this->drop_files();
+
 	Dumper::clear();
 	for (auto d : this->dumpers)
 		if (d != nullptr)
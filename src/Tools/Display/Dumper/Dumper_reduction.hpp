@@ -1,27 +1,67 @@
 #ifndef DUMPER_REDUCTION_HPP_
 #define DUMPER_REDUCTION_HPP_
 
+#include <chrono>
+#include <thread>
+#include <condition_variable>
+
 #include "Dumper.hpp"
 
 namespace aff3ct
 {
 namespace tools
 {
+/*!
+ * \class Dumper_reduction
+ *
+ * \brief Writes the frames added in the Dumper of each thread in the same files.
+ *
+ * Once "start" has been called, a background thread periodically moves the frames stored by the Dumpers into the
+ * files, the memory used by the Dumpers stays bounded whatever the number of frames. "dump" writes the last frames
+ * and closes the files.
+ */
 class Dumper_reduction : Dumper
 {
 protected:
 	std::vector<Dumper*> dumpers;
 
+	const std::chrono::milliseconds flush_period;
+	std::vector<std::vector<char>>  frames; // the frames taken from a Dumper by the writer thread
+
+	bool                    stopping;
+	std::mutex              mutex_writer;
+	std::condition_variable cv_writer;
+	std::thread             writer;
+
 public:
-	explicit Dumper_reduction(std::vector<Dumper*> &dumpers);
+	explicit Dumper_reduction(std::vector<Dumper*> &dumpers,
+	                          const std::chrono::milliseconds flush_period = std::chrono::milliseconds(500));
 	virtual ~Dumper_reduction();
 
+	/*!
+	 * \brief Opens the files and starts to write the frames in the background.
+	 *
+	 * \param base_path: the path of the files without the extensions.
+	 */
+	void start(const std::string& base_path);
+
+	/*!
+	 * \brief Writes the remaining frames and closes the files (they are opened first if "start" has not been called).
+	 */
 	virtual void dump (const std::string& base_path);
 	virtual void add  (const int frame_id = 0      );
+
+	/*!
+	 * \brief Clears the Dumpers, the files of a started and not dumped simulation are removed.
+	 */
 	virtual void clear(                            );
 
 private:
 	void checks();
+	void open(const std::string& base_path);
+	void stop();
+	void flush();
+	void writer_loop();
 };
 }
 }
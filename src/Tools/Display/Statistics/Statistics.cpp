@@ -19,32 +19,89 @@ Statistics
 }
 
 void Statistics
-::separation1(std::ostream &stream)
+::separation1(const bool perf, std::ostream &stream)
 {
-	stream << "# " << tools::format("-------------------------------------------||------------------------------||--------------------------------||--------------------------------", tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format("-------------------------------------------||------------------------------||--------------------------------||--------------------------------", tools::Style::BOLD);
+	if (perf)
+		stream << tools::format("||------------------------------------------------------", tools::Style::BOLD);
+	stream << std::endl;
 }
 
 void Statistics
-::separation2(std::ostream &stream)
+::separation2(const bool perf, std::ostream &stream)
 {
-	stream << "# " << tools::format("-------------|-------------------|---------||----------|----------|--------||----------|----------|----------||----------|----------|----------", tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format("-------------|-------------------|---------||----------|----------|--------||----------|----------|----------||----------|----------|----------", tools::Style::BOLD);
+	if (perf)
+		stream << tools::format("||----------|----------|----------|----------|----------", tools::Style::BOLD);
+	stream << std::endl;
 }
 
 void Statistics
-::show_header(std::ostream &stream)
+::show_header(const bool perf, std::ostream &stream)
 {
-	Statistics::separation1(stream);
+	Statistics::separation1(perf, stream);
 //	stream << "# " << tools::format("-------------------------------------------||------------------------------||--------------------------------||--------------------------------", tools::Style::BOLD) << std::endl;
-	stream << "# " << tools::format("       Statistics for the given task       ||       Basic statistics       ||       Measured throughput      ||        Measured latency        ", tools::Style::BOLD) << std::endl;
-	stream << "# " << tools::format("    ('*' = any, '-' = same as previous)    ||          on the task         ||   considering the last socket  ||   considering the last socket  ", tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format("       Statistics for the given task       ||       Basic statistics       ||       Measured throughput      ||        Measured latency        ", tools::Style::BOLD);
+	if (perf)
+		stream << tools::format("||            Hardware performance counters             ", tools::Style::BOLD);
+	stream << std::endl;
+	stream << "# " << tools::format("    ('*' = any, '-' = same as previous)    ||          on the task         ||   considering the last socket  ||   considering the last socket  ", tools::Style::BOLD);
+	if (perf)
+		stream << tools::format("||                 average on the task                  ", tools::Style::BOLD);
+	stream << std::endl;
 //	stream << "# " << tools::format("-------------------------------------------||------------------------------||--------------------------------||--------------------------------", tools::Style::BOLD) << std::endl;
-	Statistics::separation1(stream);
-	Statistics::separation2(stream);
+	Statistics::separation1(perf, stream);
+	Statistics::separation2(perf, stream);
 //	stream << "# " << tools::format("-------------|-------------------|---------||----------|----------|--------||----------|----------|----------||----------|----------|----------", tools::Style::BOLD) << std::endl;
-	stream << "# " << tools::format("      MODULE |              TASK |   TIMER ||    CALLS |     TIME |   PERC ||  AVERAGE |  MINIMUM |  MAXIMUM ||  AVERAGE |  MINIMUM |  MAXIMUM ", tools::Style::BOLD) << std::endl;
-	stream << "# " << tools::format("             |                   |         ||          |      (s) |    (%) ||   (Mb/s) |   (Mb/s) |   (Mb/s) ||     (us) |     (us) |     (us) ", tools::Style::BOLD) << std::endl;
+	stream << "# " << tools::format("      MODULE |              TASK |   TIMER ||    CALLS |     TIME |   PERC ||  AVERAGE |  MINIMUM |  MAXIMUM ||  AVERAGE |  MINIMUM |  MAXIMUM ", tools::Style::BOLD);
+	if (perf)
+		stream << tools::format("||   CYCLES |      IPC | L1D MISS | LLC MISS |  BR MISS ", tools::Style::BOLD);
+	stream << std::endl;
+	stream << "# " << tools::format("             |                   |         ||          |      (s) |    (%) ||   (Mb/s) |   (Mb/s) |   (Mb/s) ||     (us) |     (us) |     (us) ", tools::Style::BOLD);
+	if (perf)
+		stream << tools::format("||  (/call) |          |   (MPKI) |   (MPKI) |   (MPKI) ", tools::Style::BOLD);
+	stream << std::endl;
 //	stream << "# " << tools::format("-------------|-------------------|---------||----------|----------|--------||----------|----------|----------||----------|----------|----------", tools::Style::BOLD) << std::endl;
-	Statistics::separation2(stream);
+	Statistics::separation2(perf, stream);
+}
+
+std::string Statistics
+::perf_columns(const uint32_t n_calls, const Hardware_counters::values &perf)
+{
+	const auto cyc = (float)perf[Hardware_counters::CYCLES      ];
+	const auto ins = (float)perf[Hardware_counters::INSTRUCTIONS];
+
+	auto avg_cyc = n_calls ? cyc / (float)n_calls : 0.f;
+	auto ipc     = cyc ? ins / cyc : 0.f;
+	auto l1d_pki = ins ? ((float)perf[Hardware_counters::L1D_MISSES   ] * 1000.f) / ins : 0.f;
+	auto llc_pki = ins ? ((float)perf[Hardware_counters::LLC_MISSES   ] * 1000.f) / ins : 0.f;
+	auto brm_pki = ins ? ((float)perf[Hardware_counters::BRANCH_MISSES] * 1000.f) / ins : 0.f;
+
+#ifdef _WIN32
+	auto P = 1;
+#else
+	auto P = 2;
+#endif
+
+	float l2 = 99999.99f;
+
+	std::stringstream ssavg_cyc, ssipc, ssl1d_pki, ssllc_pki, ssbrm_pki;
+
+	ssavg_cyc << std::setprecision(avg_cyc > l2 ? P : 2) << (avg_cyc > l2 ? std::scientific : std::fixed) << std::setw(8) << avg_cyc;
+	ssipc     << std::setprecision(                   2) <<                                   std::fixed  << std::setw(8) << ipc;
+	ssl1d_pki << std::setprecision(l1d_pki > l2 ? P : 2) << (l1d_pki > l2 ? std::scientific : std::fixed) << std::setw(8) << l1d_pki;
+	ssllc_pki << std::setprecision(llc_pki > l2 ? P : 2) << (llc_pki > l2 ? std::scientific : std::fixed) << std::setw(8) << llc_pki;
+	ssbrm_pki << std::setprecision(brm_pki > l2 ? P : 2) << (brm_pki > l2 ? std::scientific : std::fixed) << std::setw(8) << brm_pki;
+
+	std::stringstream columns;
+	columns << tools::format(" || ", tools::Style::BOLD)
+	        << ssavg_cyc.str() << tools::format(" | ", tools::Style::BOLD)
+	        << ssipc    .str() << tools::format(" | ", tools::Style::BOLD)
+	        << ssl1d_pki.str() << tools::format(" | ", tools::Style::BOLD)
+	        << ssllc_pki.str() << tools::format(" | ", tools::Style::BOLD)
+	        << ssbrm_pki.str();
+
+	return columns.str();
 }
 
 void Statistics
@@ -56,6 +113,7 @@ void Statistics
             const std::chrono::nanoseconds task_tot_duration,
             const std::chrono::nanoseconds task_min_duration,
             const std::chrono::nanoseconds task_max_duration,
+            const Hardware_counters::values *task_perf,
                   std::ostream             &stream)
 {
 	if (task_n_calls == 0)
@@ -115,6 +173,7 @@ void Statistics
 	       << ssavg_lat.str() << tools::format(" | ",  tools::Style::BOLD)
 	       << ssmin_lat.str() << tools::format(" | ",  tools::Style::BOLD)
 	       << ssmax_lat.str() << ""
+	       << (task_perf != nullptr ? Statistics::perf_columns(task_n_calls, *task_perf) : "")
 	       << std::endl;
 }
 
@@ -127,6 +186,7 @@ void Statistics
              const std::chrono::nanoseconds timer_tot_duration,
              const std::chrono::nanoseconds timer_min_duration,
              const std::chrono::nanoseconds timer_max_duration,
+             const Hardware_counters::values *timer_perf,
                    std::ostream             &stream)
 {
 	if (task_n_calls == 0 || timer_n_calls == 0)
@@ -181,6 +241,7 @@ void Statistics
 	       << tools::format(ssravg_lat.str(), tools::Style::ITALIC) << tools::format(" | ",  tools::Style::BOLD)
 	       << tools::format(ssrmin_lat.str(), tools::Style::ITALIC) << tools::format(" | ",  tools::Style::BOLD)
 	       << tools::format(ssrmax_lat.str(), tools::Style::ITALIC) << ""
+	       << (timer_perf != nullptr ? Statistics::perf_columns(timer_n_calls, *timer_perf) : "")
 	       << std::endl;
 }
 
@@ -216,13 +277,22 @@ void Statistics
 	auto ttask_min_duration = std::chrono::nanoseconds(0);
 	auto ttask_max_duration = std::chrono::nanoseconds(0);
 
+	auto perf = false;
+	Hardware_counters::values ttask_perf;
+	ttask_perf.fill(0);
+
 	for (auto *t : tasks)
+	{
 		ttask_tot_duration += t->get_duration_total();
+		perf |= t->is_perf();
+		for (size_t e = 0; e < ttask_perf.size(); e++)
+			ttask_perf[e] += t->get_perf_total()[e];
+	}
 	auto total_sec = ((float)ttask_tot_duration.count()) * 0.000000001f;
 
 	if (ttask_tot_duration.count())
 	{
-		Statistics::show_header(stream);
+		Statistics::show_header(perf, stream);
 
 		size_t   ttask_n_elmts = 0;
 		uint32_t ttask_n_calls = 0;
@@ -263,7 +333,8 @@ void Statistics
 			ttask_max_duration += (task_max_duration * task_n_calls) / ttask_n_calls;
 
 			Statistics::show_task(total_sec, module_sname, task_name, task_n_elmts, task_n_calls,
-			                      task_tot_duration, task_min_duration, task_max_duration, stream);
+			                      task_tot_duration, task_min_duration, task_max_duration,
+			                      perf ? &t->get_perf_total() : nullptr, stream);
 
 			auto task_total_sec = ((float)task_tot_duration.count()) * 0.000000001f;
 
@@ -278,13 +349,15 @@ void Statistics
 			{
 				Statistics::show_timer(task_total_sec, task_n_calls, timers_n_elmts,
 				                       timers_name[i], timers_n_calls[i], timers_tot_duration[i],
-				                       timers_min_duration[i], timers_max_duration[i], stream);
+				                       timers_min_duration[i], timers_max_duration[i],
+				                       perf ? &t->get_timers_perf_total()[i] : nullptr, stream);
 			}
 		}
-		Statistics::separation2(stream);
+		Statistics::separation2(perf, stream);
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
-		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration,
+		                      perf ? &ttask_perf : nullptr, stream);
 	}
 	else
 	{
@@ -305,7 +378,8 @@ void Statistics
 			{
 				std::vector<const module::Task*> tsk;
 				for (auto *m : vm)
-					tsk.push_back(m->tasks[t]);
+					if (m != nullptr) // a module can be built for a part of the threads only
+						tsk.push_back(m->tasks[t]);
 				tasks.push_back(tsk);
 			}
 		}
@@ -342,14 +416,23 @@ void Statistics
 	auto ttask_min_duration = nanoseconds(0);
 	auto ttask_max_duration = nanoseconds(0);
 
+	auto perf = false;
+	Hardware_counters::values ttask_perf;
+	ttask_perf.fill(0);
+
 	for (auto &vt : tasks)
 		for (auto *t : vt)
+		{
 			ttask_tot_duration += t->get_duration_total();
+			perf |= t->is_perf();
+			for (size_t e = 0; e < ttask_perf.size(); e++)
+				ttask_perf[e] += t->get_perf_total()[e];
+		}
 	auto total_sec = ((float)ttask_tot_duration.count()) * 0.000000001f;
 
 	if (ttask_tot_duration.count())
 	{
-		Statistics::show_header(stream);
+		Statistics::show_header(perf, stream);
 
 		size_t ttask_n_elmts = 0;
 		auto   ttask_n_calls = 0;
@@ -388,6 +471,8 @@ void Statistics
 			auto task_tot_duration = nanoseconds(0);
 			auto task_min_duration = ttask_tot_duration;
 			auto task_max_duration = nanoseconds(0);
+			Hardware_counters::values task_perf;
+			task_perf.fill(0);
 
 			for (auto *t : vt)
 			{
@@ -395,13 +480,16 @@ void Statistics
 				task_tot_duration += t->get_duration_total();
 				task_min_duration  = std::min(task_min_duration, t->get_duration_min());
 				task_max_duration  = std::max(task_max_duration, t->get_duration_max());
+				for (size_t e = 0; e < task_perf.size(); e++)
+					task_perf[e] += t->get_perf_total()[e];
 			}
 
 			ttask_min_duration += (task_min_duration * task_n_calls) / ttask_n_calls;
 			ttask_max_duration += (task_max_duration * task_n_calls) / ttask_n_calls;
 
 			Statistics::show_task(total_sec, module_sname, task_name, task_n_elmts, task_n_calls,
-			                      task_tot_duration, task_min_duration, task_max_duration, stream);
+			                      task_tot_duration, task_min_duration, task_max_duration,
+			                      perf ? &task_perf : nullptr, stream);
 
 			auto task_total_sec = ((float)task_tot_duration.count()) * 0.000000001f;
 
@@ -414,23 +502,30 @@ void Statistics
 
 			for (size_t tn = 0; tn < vt[0]->get_timers_name().size(); tn++)
 			{
+				Hardware_counters::values timer_perf;
+				timer_perf.fill(0);
+
 				for (auto *t : vt)
 				{
 					timers_n_calls     [tn] += t->get_timers_n_calls()[tn];
 					timers_tot_duration[tn] += t->get_timers_total()[tn];
 					timers_min_duration[tn]  = std::min(task_min_duration, t->get_timers_min()[tn]);
 					timers_max_duration[tn]  = std::max(task_max_duration, t->get_timers_max()[tn]);
+					for (size_t e = 0; e < timer_perf.size(); e++)
+						timer_perf[e] += t->get_timers_perf_total()[tn][e];
 				}
 
 				Statistics::show_timer(task_total_sec, task_n_calls, timers_n_elmts,
 				                       timers_name[tn], timers_n_calls[tn], timers_tot_duration[tn],
-				                       timers_min_duration[tn], timers_max_duration[tn], stream);
+				                       timers_min_duration[tn], timers_max_duration[tn],
+				                       perf ? &timer_perf : nullptr, stream);
 			}
 		}
-		Statistics::separation2(stream);
+		Statistics::separation2(perf, stream);
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
-		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration,
+		                      perf ? &ttask_perf : nullptr, stream);
 	}
 	else
 	{
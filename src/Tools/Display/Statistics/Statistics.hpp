@@ -3,6 +3,7 @@
 
 #include "Module/Module.hpp"
 #include "Module/Task.hpp"
+#include "Tools/Perf/Hardware_counters/Hardware_counters.hpp"
 
 #include <vector>
 #include <iostream>
@@ -29,11 +30,13 @@ public:
 	                 std::ostream &stream = std::cout);
 
 private:
-	static void separation1(std::ostream &stream = std::cout);
+	static void separation1(const bool perf = false, std::ostream &stream = std::cout);
 
-	static void separation2(std::ostream &stream = std::cout);
+	static void separation2(const bool perf = false, std::ostream &stream = std::cout);
 
-	static void show_header(std::ostream &stream = std::cout);
+	static void show_header(const bool perf = false, std::ostream &stream = std::cout);
+
+	static std::string perf_columns(const uint32_t n_calls, const Hardware_counters::values &perf);
 
 	static void show_task(const float                    total_sec,
 	                      const std::string&             module_sname,
@@ -43,6 +46,7 @@ private:
 	                      const std::chrono::nanoseconds task_tot_duration,
 	                      const std::chrono::nanoseconds task_min_duration,
 	                      const std::chrono::nanoseconds task_max_duration,
+	                      const Hardware_counters::values *task_perf = nullptr,
 	                            std::ostream             &stream = std::cout);
 
 	static void show_timer(const float                    total_sec,
@@ -53,6 +57,7 @@ private:
 	                       const std::chrono::nanoseconds timer_tot_duration,
 	                       const std::chrono::nanoseconds timer_min_duration,
 	                       const std::chrono::nanoseconds timer_max_duration,
+	                       const Hardware_counters::values *timer_perf = nullptr,
 	                             std::ostream             &stream = std::cout);
 };
 
@@ -0,0 +1,169 @@
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <set>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Module.hpp"
+#include "Module/Task.hpp"
+
+#include "Timeline.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+std::atomic<bool>                     Timeline::enabled(false);
+size_t                                Timeline::capacity = 65536;
+std::chrono::steady_clock::time_point Timeline::t_origin = std::chrono::steady_clock::now();
+std::mutex                            Timeline::mutex_rings;
+std::vector<Timeline::Ring*>          Timeline::rings;
+uint32_t                              Timeline::n_threads = 0;
+
+namespace
+{
+// gives the ring back when the thread ends (its events remain until the next flush)
+struct Ring_holder
+{
+	Timeline::Ring* ring;
+	Ring_holder() : ring(nullptr) {}
+	~Ring_holder() { if (ring != nullptr) ring->release(); }
+};
+
+thread_local Ring_holder ring_holder;
+}
+
+Timeline::Ring
+::Ring(const size_t capacity, const int id)
+: events(capacity), n_events(0), in_use(true), id(id), thread(0)
+{
+}
+
+Timeline
+::Timeline()
+{
+}
+
+void Timeline
+::enable(const size_t capacity)
+{
+	if (capacity == 0)
+	{
+		std::stringstream message;
+		message << "'capacity' has to be greater than 0.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_rings);
+	Timeline::capacity = capacity;
+	Timeline::t_origin = std::chrono::steady_clock::now();
+	Timeline::enabled.store(true);
+}
+
+void Timeline
+::disable()
+{
+	std::lock_guard<std::mutex> lock(mutex_rings);
+	Timeline::enabled.store(false);
+	for (auto *r : rings)
+		if (!r->in_use)
+			r->events.clear();
+}
+
+Timeline::Ring& Timeline
+::get_ring()
+{
+	if (ring_holder.ring == nullptr)
+		ring_holder.ring = &Timeline::acquire_ring();
+	return *ring_holder.ring;
+}
+
+Timeline::Ring& Timeline
+::acquire_ring()
+{
+	std::lock_guard<std::mutex> lock(mutex_rings);
+
+	// reuse the ring of a terminated thread (the threads are created again for each SNR point)
+	for (auto *r : rings)
+		if (!r->in_use)
+		{
+			r->in_use = true;
+			r->thread = n_threads++;
+			if (r->events.size() != capacity)
+				r->events.resize(capacity);
+			return *r;
+		}
+
+	rings.push_back(new Ring(capacity, (int)rings.size()));
+	rings.back()->thread = n_threads++;
+	return *rings.back();
+}
+
+void Timeline
+::flush(const std::string &path, const int pid)
+{
+	std::lock_guard<std::mutex> lock(mutex_rings);
+
+	std::ofstream file(path);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the timeline file ('path' = " << path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" << std::endl;
+	file << std::fixed << std::setprecision(3);
+
+	auto first = true;
+	std::set<uint32_t> named; // the threads whose name has been written
+	for (auto *r : rings)
+	{
+		const auto n_events = r->n_events.load(std::memory_order_acquire);
+		if (n_events == 0)
+			continue;
+
+		// the oldest events have been overwritten if the ring is full
+		const auto n_kept = std::min((uint64_t)r->events.size(), n_events);
+		for (auto i = n_events - n_kept; i < n_events; i++)
+		{
+			const auto &e = r->events[i % r->events.size()];
+			const auto n_frames = (uint64_t)e.task->get_module().get_n_frames();
+
+			if (named.insert(e.thread).second)
+			{
+				file << (first ? "" : ",\n")
+				     << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << e.thread
+				     << ",\"args\":{\"name\":\"thread " << e.thread << "\"}}";
+				first = false;
+			}
+
+			file << ",\n"
+			     << "{\"name\":\"" << e.task->get_module().get_short_name() << "::" << e.task->get_name() << "\","
+			     << "\"cat\":\"" << e.task->get_module().get_short_name() << "\","
+			     << "\"ph\":\"X\","
+			     << "\"ts\":"  << ((double)e.t_begin             * 0.001) << ","
+			     << "\"dur\":" << ((double)(e.t_end - e.t_begin) * 0.001) << ","
+			     << "\"pid\":" << pid << ",\"tid\":" << e.thread << ","
+			     << "\"args\":{\"frames\":\"" << e.frame << "-" << (e.frame + n_frames -1) << "\"}}";
+		}
+
+		// the dropped events are reported on the thread of the oldest kept event
+		if (n_events > n_kept)
+			file << ",\n"
+			     << "{\"name\":\"dropped events\",\"ph\":\"C\",\"ts\":0,\"pid\":" << pid << ",\"tid\":"
+			     << r->events[(n_events - n_kept) % r->events.size()].thread
+			     << ",\"args\":{\"n\":" << (n_events - n_kept) << "}}";
+
+		r->n_events.store(0, std::memory_order_release);
+	}
+
+	file << std::endl << "]}" << std::endl;
+}
+
+void Timeline
+::clear()
+{
+	std::lock_guard<std::mutex> lock(mutex_rings);
+	for (auto *r : rings)
+		r->n_events.store(0, std::memory_order_release);
+}
@@ -0,0 +1,147 @@
+/*!
+ * \file
+ * \brief Records the Task executions of each thread and exports them as a timeline (trace-event JSON format).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef TIMELINE_HPP_
+#define TIMELINE_HPP_
+
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace module
+{
+class Task;
+}
+namespace tools
+{
+/*!
+ * \class Timeline
+ *
+ * \brief Records the Task executions of each thread and exports them as a timeline (trace-event JSON format).
+ *
+ * Each thread writes its events in its own ring buffer without any lock (only the first event of a thread takes a
+ * lock to get a buffer), when a buffer is full the oldest events are overwritten. The ring of a terminated thread is
+ * reused by the next one, each event keeps the id of its thread so the threads are not mixed in the timeline. The buffers are written in a file
+ * with "flush", this method has to be called when no Task is running (between two SNR points for instance). The file
+ * can be opened in "chrome://tracing" or in Perfetto (https://ui.perfetto.dev).
+ */
+class Timeline
+{
+public:
+	struct Event
+	{
+		const module::Task* task;
+		int64_t             t_begin; // in nanoseconds since the enabling of the timeline
+		int64_t             t_end;   // in nanoseconds since the enabling of the timeline
+		uint64_t            frame;   // the first frame processed by the Task
+		uint32_t            thread;  // the thread which executed the Task (a ring is reused by the next threads)
+	};
+
+	class Ring
+	{
+		friend Timeline;
+
+	private:
+		std::vector<Event>    events;
+		std::atomic<uint64_t> n_events;
+		std::atomic<bool>     in_use;
+		const int             id;
+		uint32_t              thread; // the thread which currently owns the ring
+
+	public:
+		Ring(const size_t capacity, const int id);
+
+		inline void add(const Event &e)
+		{
+			const auto n = n_events.load(std::memory_order_relaxed);
+			events[n % events.size()] = e;
+			n_events.store(n +1, std::memory_order_release);
+		}
+
+		inline void release()
+		{
+			in_use.store(false);
+		}
+	};
+
+private:
+	static std::atomic<bool>                     enabled;
+	static size_t                                capacity;
+	static std::chrono::steady_clock::time_point t_origin;
+	static std::mutex                            mutex_rings;
+	static std::vector<Ring*>                    rings;
+	static uint32_t                              n_threads;
+
+public:
+	/*!
+	 * \brief Starts the recording of the Task executions.
+	 *
+	 * \param capacity: the max number of events stored per thread between two flushes.
+	 */
+	static void enable(const size_t capacity = 65536);
+
+	/*!
+	 * \brief Stops the recording and frees the buffers, no Task has to be running.
+	 */
+	static void disable();
+
+	static inline bool is_enabled()
+	{
+		return enabled.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	 * \brief Records the execution of a Task by the calling thread.
+	 */
+	static inline void add(const module::Task &task,
+	                       const std::chrono::steady_clock::time_point &t_begin,
+	                       const std::chrono::steady_clock::time_point &t_end,
+	                       const uint64_t frame)
+	{
+		using namespace std::chrono;
+
+		Event e;
+		e.task    = &task;
+		e.t_begin = duration_cast<nanoseconds>(t_begin - t_origin).count();
+		e.t_end   = duration_cast<nanoseconds>(t_end   - t_origin).count();
+		e.frame   = frame;
+
+		auto &ring = get_ring();
+		e.thread = ring.thread;
+		ring.add(e);
+	}
+
+	/*!
+	 * \brief Writes the recorded events in a trace-event JSON file and empties the buffers.
+	 *
+	 * \param path: the path of the file.
+	 * \param pid:  the process id written in the events (the MPI rank for instance).
+	 */
+	static void flush(const std::string &path, const int pid = 0);
+
+	/*!
+	 * \brief Drops the recorded events without writing them, no Task has to be running.
+	 *
+	 * The events refer to their Task: they have to be flushed or dropped before the Tasks are destroyed.
+	 */
+	static void clear();
+
+private:
+	Timeline();
+
+	static Ring& get_ring();
+	static Ring& acquire_ring();
+};
+}
+}
+
+#endif /* TIMELINE_HPP_ */
@@ -41,6 +41,24 @@ void Interleaver_core_golden<T>
 	});
 }
 
+template <typename T>
+void Interleaver_core_golden<T>
+::save_state(std::ostream &os) const
+{
+	Interleaver_core<T>::save_state(os);
+	if (this->uniform)
+		os << gen << " ";
+}
+
+template <typename T>
+void Interleaver_core_golden<T>
+::load_state(std::istream &is)
+{
+	Interleaver_core<T>::load_state(is);
+	if (this->uniform)
+		is >> gen;
+}
+
 // ==================================================================================== explicit template instantiation
 #include <cstdint>
 template class aff3ct::tools::Interleaver_core_golden<uint8_t >;
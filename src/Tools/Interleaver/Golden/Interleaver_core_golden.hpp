@@ -20,6 +20,9 @@ public:
 	Interleaver_core_golden(const int size, const int seed = 0, const bool uniform = false, const int n_frames = 1);
 	virtual ~Interleaver_core_golden();
 
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
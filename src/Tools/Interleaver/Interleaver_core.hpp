@@ -2,9 +2,11 @@
 #define INTERLEAVER_CORE_HPP_
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 #include <sstream>
+#include <iostream>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -23,8 +25,8 @@ protected:
 	const int n_frames;
 	      bool uniform;
 	      bool initialized;
-	std::vector<T> pi;     /*!< Lookup table for the interleaving process */
-	std::vector<T> pi_inv; /*!< Lookup table for the deinterleaving process */
+	std::shared_ptr<std::vector<T>> pi;     /*!< Lookup table for the interleaving process */
+	std::shared_ptr<std::vector<T>> pi_inv; /*!< Lookup table for the deinterleaving process */
 
 public:
 	/*!
@@ -36,7 +38,8 @@ public:
 	 */
 	Interleaver_core(const int size, const std::string &name, const bool uniform = false, const int n_frames = 1)
 	: size(size), name(name), n_frames(n_frames), uniform(uniform), initialized(false),
-	  pi(size * n_frames, 0), pi_inv(size * n_frames, 0)
+	  pi    (std::make_shared<std::vector<T>>(size * n_frames, 0)),
+	  pi_inv(std::make_shared<std::vector<T>>(size * n_frames, 0))
 	{
 		if (size <= 0)
 		{
@@ -66,12 +69,12 @@ public:
 
 	const std::vector<T>& get_lut() const
 	{
-		return pi;
+		return *pi;
 	}
 
 	const std::vector<T>& get_lut_inv() const
 	{
-		return pi_inv;
+		return *pi_inv;
 	}
 
 	int get_size() const
@@ -94,6 +97,53 @@ public:
 		return initialized;
 	}
 
+	/*!
+	 * \brief Writes the lookup tables in use and the state of the generator, only a uniform interleaver changes
+	 *        from a frame to another (to checkpoint a simulation).
+	 *
+	 * \param os: the output stream (text format).
+	 */
+	virtual void save_state(std::ostream &os) const
+	{
+		if (this->uniform)
+		{
+			for (auto v : *this->pi    ) os << (uint64_t)v << " ";
+			for (auto v : *this->pi_inv) os << (uint64_t)v << " ";
+		}
+	}
+
+	/*!
+	 * \brief Restores a state written by "save_state".
+	 *
+	 * \param is: the input stream (text format).
+	 */
+	virtual void load_state(std::istream &is)
+	{
+		if (this->uniform)
+		{
+			// the tables shared with an other Interleaver_core are never written, they are reallocated
+			if (this->pi.use_count() > 1)
+			{
+				this->pi     = std::make_shared<std::vector<T>>(size * n_frames, 0);
+				this->pi_inv = std::make_shared<std::vector<T>>(size * n_frames, 0);
+			}
+
+			uint64_t v;
+			for (auto &x : *this->pi    ) { is >> v; x = (T)v; }
+			for (auto &x : *this->pi_inv) { is >> v; x = (T)v; }
+		}
+	}
+
+	/*!
+	 * \brief Regenerates the lookup tables of a uniform Interleaver_core for the frames starting at a global index,
+	 *        they only depend on the seed and on this index (does nothing for the other Interleaver_cores).
+	 *
+	 * \param counter: the index of the first frame.
+	 */
+	virtual void set_counter(const uint64_t counter)
+	{
+	}
+
 	std::string get_name() const
 	{
 		return name;
@@ -105,11 +155,53 @@ public:
 		this->initialized = true;
 	}
 
+	/*!
+	 * \brief Initializes the Interleaver_core with the lookup tables of "ref" (they are shared, not copied).
+	 *
+	 * The lookup tables of a non-uniform Interleaver_core never change after the initialization, so they can be
+	 * shared by the replicas of a communication chain. A uniform Interleaver_core is initialized as usual (its tables
+	 * are regenerated for each frame).
+	 *
+	 * \param ref: an Interleaver_core of the same type, size and number of frames.
+	 */
+	void init(const Interleaver_core<T> &ref)
+	{
+		if (ref.get_name() != this->get_name() || ref.get_size() != this->get_size() ||
+		    ref.get_n_frames() != this->get_n_frames())
+		{
+			std::stringstream message;
+			message << "'ref' has to be the same kind of Interleaver_core ('ref.get_name()' = " << ref.get_name()
+			        << ", 'get_name()' = " << this->get_name() << ", 'ref.get_size()' = " << ref.get_size()
+			        << ", 'get_size()' = " << this->get_size() << ", 'ref.get_n_frames()' = " << ref.get_n_frames()
+			        << ", 'get_n_frames()' = " << this->get_n_frames() << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->uniform || ref.uniform || !ref.initialized)
+			this->init();
+		else
+		{
+			this->pi          = ref.pi;
+			this->pi_inv      = ref.pi_inv;
+			this->initialized = true;
+		}
+	}
+
 	void refresh()
 	{
-		this->gen_lut(this->pi.data(), 0);
+		// the tables shared with an other Interleaver_core are never written, they are reallocated
+		if (this->pi.use_count() > 1)
+		{
+			this->pi     = std::make_shared<std::vector<T>>(size * n_frames, 0);
+			this->pi_inv = std::make_shared<std::vector<T>>(size * n_frames, 0);
+		}
+
+		auto &pi     = *this->pi;
+		auto &pi_inv = *this->pi_inv;
+
+		this->gen_lut(pi.data(), 0);
 		for (auto i = 0; i < (int)this->get_size(); i++)
-			this->pi_inv[this->pi[i]] = i;
+			pi_inv[pi[i]] = i;
 
 		if (uniform)
 		{
@@ -117,10 +209,10 @@ public:
 			{
 				const auto off = f * this->size;
 
-				this->gen_lut(this->pi.data() + off, f);
+				this->gen_lut(pi.data() + off, f);
 
 				for (auto i = 0; i < this->get_size(); i++)
-					this->pi_inv[off + this->pi[off +i]] = i;
+					pi_inv[off + pi[off +i]] = i;
 			}
 		}
 		else
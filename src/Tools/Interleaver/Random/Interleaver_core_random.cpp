@@ -1,6 +1,8 @@
 #include <algorithm>
 #include <numeric>
 
+#include "Tools/Algo/PRNG/PRNG_Threefry.hpp"
+
 #include "Interleaver_core_random.hpp"
 
 using namespace aff3ct;
@@ -9,7 +11,7 @@ using namespace aff3ct::tools;
 template <typename T>
 Interleaver_core_random<T>
 ::Interleaver_core_random(const int size, const int seed, const bool uniform, const int n_frames)
-: Interleaver_core<T>(size, "random", uniform, n_frames), rd_engine()
+: Interleaver_core<T>(size, "random", uniform, n_frames), rd_engine(), seed(seed)
 {
 	rd_engine.seed(seed);
 }
@@ -28,6 +30,43 @@ void Interleaver_core_random<T>
 	std::shuffle(lut, lut + this->get_size(), rd_engine);
 }
 
+template <typename T>
+void Interleaver_core_random<T>
+::set_counter(const uint64_t counter)
+{
+	if (this->uniform)
+	{
+		// the shuffle engine is reseeded from a counter-based hash of (seed, counter)
+		const uint32_t ctr[4] = {0, 0, (uint32_t)counter, (uint32_t)(counter >> 32)};
+		const uint32_t key[4] = {(uint32_t)this->seed, PRNG_Threefry::INTERLEAVER, 0, 0};
+		uint32_t hash[4];
+		PRNG_Threefry::compute_block(ctr, key, hash);
+
+		std::seed_seq seq(hash, hash + 4);
+		rd_engine.seed(seq);
+
+		this->refresh();
+	}
+}
+
+template <typename T>
+void Interleaver_core_random<T>
+::save_state(std::ostream &os) const
+{
+	Interleaver_core<T>::save_state(os);
+	if (this->uniform)
+		os << rd_engine << " ";
+}
+
+template <typename T>
+void Interleaver_core_random<T>
+::load_state(std::istream &is)
+{
+	Interleaver_core<T>::load_state(is);
+	if (this->uniform)
+		is >> rd_engine;
+}
+
 // ==================================================================================== explicit template instantiation
 #include <cstdint>
 template class aff3ct::tools::Interleaver_core_random<uint8_t >;
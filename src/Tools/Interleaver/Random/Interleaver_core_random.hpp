@@ -14,11 +14,16 @@ class Interleaver_core_random : public Interleaver_core<T>
 {
 private:
 	std::mt19937 rd_engine;
+	const int    seed;
 
 public:
 	Interleaver_core_random(const int size, const int seed = 0, const bool uniform = false, const int n_frames = 1);
 	virtual ~Interleaver_core_random();
 
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+	virtual void set_counter(const uint64_t counter);
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
@@ -48,6 +48,24 @@ void Interleaver_core_random_column<T>
 	}
 }
 
+template <typename T>
+void Interleaver_core_random_column<T>
+::save_state(std::ostream &os) const
+{
+	Interleaver_core<T>::save_state(os);
+	if (this->uniform)
+		os << rd_engine << " ";
+}
+
+template <typename T>
+void Interleaver_core_random_column<T>
+::load_state(std::istream &is)
+{
+	Interleaver_core<T>::load_state(is);
+	if (this->uniform)
+		is >> rd_engine;
+}
+
 // ==================================================================================== explicit template instantiation
 #include <cstdint>
 template class aff3ct::tools::Interleaver_core_random_column<uint8_t >;
@@ -23,6 +23,9 @@ public:
 	                               const int n_frames = 1);
 	virtual ~Interleaver_core_random_column();
 
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
@@ -11,7 +11,7 @@ using namespace aff3ct::tools;
 template <typename T>
 Interleaver_core_user<T>
 ::Interleaver_core_user(const int size, const std::string &filename, const int n_frames)
-: Interleaver_core<T>(size, "user", false, n_frames), cur_itl_id(0)
+: Interleaver_core<T>(size, "user", false, n_frames), partition()
 {
 	if (filename.empty())
 		throw invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
@@ -103,6 +103,8 @@ Interleaver_core_user<T>
 		message << "Can't open '" + filename + "' file.";
 		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->partition.set_n_fra((int)this->pi_buffer.size());
 }
 
 template <typename T>
@@ -115,8 +117,40 @@ template <typename T>
 void Interleaver_core_user<T>
 ::gen_lut(T *lut, const int frame_id)
 {
-	std::copy(this->pi_buffer[cur_itl_id].begin(), this->pi_buffer[cur_itl_id].end(), lut);
-	cur_itl_id = (cur_itl_id +1) % pi_buffer.size();
+	const auto itl_id = this->partition.next();
+	std::copy(this->pi_buffer[itl_id].begin(), this->pi_buffer[itl_id].end(), lut);
+}
+
+template <typename T>
+void Interleaver_core_user<T>
+::set_partition(const int part_id, const int n_parts)
+{
+	if (!this->uniform)
+		return;
+
+	this->partition.set_partition(part_id, n_parts);
+
+	// the tables of the first frame have already been generated (an idle part keeps them, they are never used)
+	if (this->initialized && !this->partition.is_idle())
+		this->refresh();
+}
+
+template <typename T>
+void Interleaver_core_user<T>
+::save_state(std::ostream &os) const
+{
+	Interleaver_core<T>::save_state(os);
+	if (this->uniform)
+		this->partition.save_state(os);
+}
+
+template <typename T>
+void Interleaver_core_user<T>
+::load_state(std::istream &is)
+{
+	Interleaver_core<T>::load_state(is);
+	if (this->uniform)
+		this->partition.load_state(is);
 }
 
 // ==================================================================================== explicit template instantiation
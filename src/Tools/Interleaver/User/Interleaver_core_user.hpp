@@ -1,6 +1,8 @@
 #ifndef INTERLEAVER_CORE_USER_HPP
 #define INTERLEAVER_CORE_USER_HPP
 
+#include "Tools/Algo/Frame_partition.hpp"
+
 #include "../Interleaver_core.hpp"
 
 namespace aff3ct
@@ -12,12 +14,22 @@ class Interleaver_core_user : public Interleaver_core<T>
 {
 private:
 	std::vector<std::vector<T>> pi_buffer;
-	int cur_itl_id;
+	Frame_partition partition; // the interleavers played by this instance
 
 public:
 	Interleaver_core_user(const int size, const std::string &filename, const int n_frames = 1);
 	virtual ~Interleaver_core_user();
 
+	/*!
+	 * \brief Replays only the interleavers "part_id", "part_id + n_parts", "part_id + 2 * n_parts", ... of the file
+	 *        (to share the frames between several instances), a part without interleaver can't be played (see
+	 *        Frame_partition). A non-uniform interleaver is the same for all the frames and is not partitioned.
+	 */
+	void set_partition(const int part_id, const int n_parts);
+
+	virtual void save_state(std::ostream &os) const;
+	virtual void load_state(std::istream &is);
+
 protected:
 	void gen_lut(T *lut, const int frame_id);
 };
@@ -0,0 +1,129 @@
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "confidence_interval.h"
+
+using namespace aff3ct;
+
+double tools::normal_quantile(const double p)
+{
+	if (p <= 0. || p >= 1.)
+	{
+		std::stringstream message;
+		message << "'p' has to be in ]0,1[ ('p' = " << p << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// bisection on the CDF, it is only computed once per simulation
+	auto lo = -40., hi = 40.;
+	for (auto i = 0; i < 200; i++)
+	{
+		const auto mid = (lo + hi) * 0.5;
+		if (0.5 * std::erfc(-mid / std::sqrt(2.)) < p)
+			lo = mid;
+		else
+			hi = mid;
+	}
+
+	return (lo + hi) * 0.5;
+}
+
+void tools::wilson_interval(const unsigned long long k, const unsigned long long n, const double z,
+                            double &lower, double &upper)
+{
+	if (n == 0)
+	{
+		lower = 0.;
+		upper = 1.;
+		return;
+	}
+
+	const auto nd   = (double)n;
+	const auto p    = (double)k / nd;
+	const auto z2   = z * z;
+	const auto den  = 1. + z2 / nd;
+	const auto mid  = (p + z2 / (2. * nd)) / den;
+	const auto half = z / den * std::sqrt(p * (1. - p) / nd + z2 / (4. * nd * nd));
+
+	lower = std::max(0., mid - half);
+	upper = std::min(1., mid + half);
+}
+
+namespace
+{
+// P(X <= m) for X ~ B(n,p), "lcoef[i]" = log(C(n,i)) and the sum is done in the log domain (the first terms underflow
+// when n is large)
+double binomial_cdf(const std::vector<double> &lcoef, const unsigned long long m, const unsigned long long n,
+                    const double p, std::vector<double> &lterms)
+{
+	if (p <= 0.) return 1.;
+	if (p >= 1.) return m >= n ? 1. : 0.;
+
+	const auto lp  = std::log  ( p);
+	const auto lq  = std::log1p(-p);
+	auto       max = -std::numeric_limits<double>::infinity();
+	for (unsigned long long i = 0; i <= m; i++)
+	{
+		lterms[i] = lcoef[i] + (double)i * lp + (double)(n - i) * lq;
+		max = std::max(max, lterms[i]);
+	}
+
+	auto sum = 0.;
+	for (unsigned long long i = 0; i <= m; i++)
+		sum += std::exp(lterms[i] - max);
+
+	return std::min(1., std::exp(max) * sum);
+}
+
+// the "p" for which P(X <= m) = target, the CDF decreases with "p"
+double binomial_cdf_inverse(const std::vector<double> &lcoef, const unsigned long long m, const unsigned long long n,
+                            const double target, std::vector<double> &lterms)
+{
+	auto lo = 0., hi = 1.;
+	for (auto i = 0; i < 64; i++)
+	{
+		const auto mid = (lo + hi) * 0.5;
+		if (binomial_cdf(lcoef, m, n, mid, lterms) > target)
+			lo = mid;
+		else
+			hi = mid;
+	}
+
+	return (lo + hi) * 0.5;
+}
+}
+
+void tools::clopper_pearson_interval(const unsigned long long k, const unsigned long long n, const double confidence,
+                                     double &lower, double &upper)
+{
+	if (confidence <= 0. || confidence >= 1.)
+	{
+		std::stringstream message;
+		message << "'confidence' has to be in ]0,1[ ('confidence' = " << confidence << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n == 0)
+	{
+		lower = 0.;
+		upper = 1.;
+		return;
+	}
+
+	const auto alpha = 1. - confidence;
+	const auto kk    = std::min(k, n);
+
+	std::vector<double> lcoef(kk +1), lterms(kk +1);
+	lcoef[0] = 0.;
+	for (unsigned long long i = 1; i <= kk; i++)
+		lcoef[i] = lcoef[i -1] + std::log((double)(n - i +1)) - std::log((double)i);
+
+	// lower bound: P(X >= k) = alpha/2, upper bound: P(X <= k) = alpha/2
+	lower = (kk == 0) ? 0. : binomial_cdf_inverse(lcoef, kk -1, n, 1. - alpha * 0.5, lterms);
+	upper = (kk == n) ? 1. : binomial_cdf_inverse(lcoef, kk,    n,      alpha * 0.5, lterms);
+}
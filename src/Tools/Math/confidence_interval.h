@@ -0,0 +1,29 @@
+#ifndef CONFIDENCE_INTERVAL_H_
+#define CONFIDENCE_INTERVAL_H_
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * The quantile of the standard normal distribution (the inverse of its CDF), "p" has to be in ]0,1[.
+ */
+double normal_quantile(const double p);
+
+/*
+ * Wilson score interval of the probability of a binomial distribution, after "k" successes over "n" trials. "z" is
+ * the normal quantile of the confidence level (1.96 for 95%).
+ */
+void wilson_interval(const unsigned long long k, const unsigned long long n, const double z,
+                     double &lower, double &upper);
+
+/*
+ * Clopper-Pearson (exact) interval of the probability of a binomial distribution, after "k" successes over "n"
+ * trials, "confidence" is in ]0,1[ (0.95 for 95%). The cost is proportional to "k".
+ */
+void clopper_pearson_interval(const unsigned long long k, const unsigned long long n, const double confidence,
+                              double &lower, double &upper);
+}
+}
+
+#endif /* CONFIDENCE_INTERVAL_H_ */
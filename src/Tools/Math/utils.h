@@ -5,6 +5,7 @@
 #include <sstream>
 #include <vector>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
 #include "Tools/Exception/exception.hpp"
@@ -100,6 +101,79 @@ inline R integral(function_type func, const R min, const R max, const int number
 
 	return area;
 }
+
+/*!
+ * \brief Converts a float into an IEEE 754 half precision float (rounded to the nearest, ties to even).
+ */
+inline uint16_t float_to_half(const float val)
+{
+	uint32_t x;
+	std::memcpy(&x, &val, sizeof(x));
+
+	const uint16_t sign = (uint16_t)((x >> 16) & 0x8000);
+	const uint32_t abs  = x & 0x7FFFFFFF;
+
+	if (abs >= 0x7F800000) // inf or nan
+		return sign | 0x7C00 | (abs > 0x7F800000 ? 0x200 : 0);
+	if (abs >= 0x477FF000) // greater than the max half (65504) once rounded
+		return sign | 0x7C00;
+
+	uint32_t h, rem, tie;
+	if (abs < 0x38800000) // subnormal half
+	{
+		if (abs < 0x33000000) // lower than the half of the min subnormal half
+			return sign;
+
+		const uint32_t m     = (abs & 0x7FFFFF) | 0x800000;
+		const uint32_t shift = 126 - (abs >> 23);
+		h   = m >> shift;
+		rem = m & ((1u << shift) -1);
+		tie = 1u << (shift -1);
+	}
+	else
+	{
+		h   = (abs - 0x38000000) >> 13;
+		rem = abs & 0x1FFF;
+		tie = 0x1000;
+	}
+
+	if (rem > tie || (rem == tie && (h & 1)))
+		h++;
+
+	return sign | (uint16_t)h;
+}
+
+/*!
+ * \brief Converts an IEEE 754 half precision float into a float (exact).
+ */
+inline float half_to_float(const uint16_t val)
+{
+	const uint32_t sign = (uint32_t)(val & 0x8000) << 16;
+	const uint32_t e    = (val >> 10) & 0x1F;
+	      uint32_t m    = val & 0x3FF;
+
+	uint32_t x;
+	if (e == 0x1F) // inf or nan
+		x = sign | 0x7F800000 | (m << 13);
+	else if (e != 0)
+		x = sign | ((e + 112) << 23) | (m << 13);
+	else if (m == 0)
+		x = sign;
+	else // subnormal half, normal float
+	{
+		uint32_t e_f = 113;
+		while (!(m & 0x400))
+		{
+			m <<= 1;
+			e_f--;
+		}
+		x = sign | (e_f << 23) | ((m & 0x3FF) << 13);
+	}
+
+	float f;
+	std::memcpy(&f, &x, sizeof(f));
+	return f;
+}
 }
 }
 
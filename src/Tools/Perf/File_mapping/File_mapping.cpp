@@ -0,0 +1,114 @@
+#if defined(__unix__) || defined(__unix) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define FILE_MAPPING_MMAP
+#endif
+#include <map>
+#include <mutex>
+#include <fstream>
+#include <iterator>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "File_mapping.hpp"
+
+using namespace aff3ct::tools;
+
+namespace
+{
+// the mappings in use, indexed by the path of their file
+std::mutex                                               mappings_mutex;
+std::map<std::string, std::weak_ptr<const File_mapping>> mappings;
+}
+
+std::shared_ptr<const File_mapping> File_mapping
+::open(const std::string &path)
+{
+	std::lock_guard<std::mutex> lock(mappings_mutex);
+
+	if (auto m = mappings[path].lock())
+		return m;
+
+	// forget the released mappings
+	for (auto it = mappings.begin(); it != mappings.end();)
+		it = it->second.expired() && it->first != path ? mappings.erase(it) : std::next(it);
+
+	std::shared_ptr<const File_mapping> m(new File_mapping(path));
+	mappings[path] = m;
+	return m;
+}
+
+File_mapping
+::File_mapping(const std::string &path)
+: path(path), ptr(nullptr), bytes(0), mapped(false)
+{
+	if (path.empty())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'path' should not be empty.");
+
+#ifdef FILE_MAPPING_MMAP
+	const auto fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+		throw invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + path + "' file.");
+
+	struct stat st;
+	const auto empty = fstat(fd, &st) == 0 && st.st_size == 0;
+	if (!empty)
+	{
+		auto p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (p != MAP_FAILED)
+		{
+			this->ptr    = (const char*)p;
+			this->bytes  = (size_t)st.st_size;
+			this->mapped = true;
+		}
+	}
+	::close(fd);
+
+	if (this->mapped || empty)
+		return;
+#endif
+
+	// the file can't be mapped: it is read once in memory
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + path + "' file.");
+
+	this->buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	this->ptr   = this->buffer.empty() ? nullptr : this->buffer.data();
+	this->bytes = this->buffer.size();
+}
+
+File_mapping
+::~File_mapping()
+{
+#ifdef FILE_MAPPING_MMAP
+	if (this->mapped)
+		munmap((void*)this->ptr, this->bytes);
+#endif
+}
+
+const std::string& File_mapping
+::get_path() const
+{
+	return this->path;
+}
+
+const char* File_mapping
+::data() const
+{
+	return this->ptr;
+}
+
+size_t File_mapping
+::size() const
+{
+	return this->bytes;
+}
+
+bool File_mapping
+::is_mapped() const
+{
+	return this->mapped;
+}
@@ -0,0 +1,75 @@
+/*!
+ * \file
+ * \brief Read-only mapping of a file in memory, shared by all its users.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef FILE_MAPPING_HPP_
+#define FILE_MAPPING_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class File_mapping
+ *
+ * \brief Read-only mapping of a file in memory, shared by all its users.
+ *
+ * The file is mapped once per process ("mmap"), whatever the number of modules (and threads) reading it: the pages are
+ * only loaded from the disk when they are first read and they can be dropped by the kernel under memory pressure. On
+ * the systems without "mmap" (or if the mapping fails), the whole file is read once in memory and shared in the same
+ * way. The mapping is released when its last user is destroyed.
+ */
+class File_mapping
+{
+private:
+	const std::string path;
+	const char *ptr;
+	size_t bytes;
+	bool mapped;
+	std::vector<char> buffer; // the content of the file when it can't be mapped
+
+public:
+	/*!
+	 * \brief Gives the mapping of a file, the same one is returned while the previous users hold it.
+	 *
+	 * \param path: the path of the file.
+	 */
+	static std::shared_ptr<const File_mapping> open(const std::string &path);
+
+	~File_mapping();
+
+	File_mapping(const File_mapping&) = delete;
+	File_mapping& operator=(const File_mapping&) = delete;
+
+	const std::string& get_path() const;
+
+	/*!
+	 * \brief The first byte of the file (nullptr if the file is empty).
+	 */
+	const char* data() const;
+
+	/*!
+	 * \brief The size of the file in bytes.
+	 */
+	size_t size() const;
+
+	/*!
+	 * \brief Returns false if the file has been read in memory instead of being mapped.
+	 */
+	bool is_mapped() const;
+
+private:
+	explicit File_mapping(const std::string &path);
+};
+}
+}
+
+#endif /* FILE_MAPPING_HPP_ */
@@ -0,0 +1,135 @@
+#if defined(__linux__) || defined(__linux)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <cstring>
+#endif
+
+#include "Hardware_counters.hpp"
+
+using namespace aff3ct::tools;
+
+#if defined(__linux__) || defined(__linux)
+namespace
+{
+// the counters of one thread: the first available event leads the group, the others are read at the same time
+struct Counters_group
+{
+	int fd[Hardware_counters::SIZE];
+	int leader;
+
+	Counters_group() : leader(-1)
+	{
+		const std::array<std::pair<uint32_t,uint64_t>, Hardware_counters::SIZE> events =
+		{{
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES      },
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS    },
+			{PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D                |
+			                     (PERF_COUNT_HW_CACHE_OP_READ     <<  8) |
+			                     (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES    },
+			{PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES   }
+		}};
+
+		for (auto e = 0; e < Hardware_counters::SIZE; e++)
+		{
+			struct perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size           = sizeof(attr);
+			attr.type           = events[e].first;
+			attr.config         = events[e].second;
+			attr.disabled       = leader == -1 ? 1 : 0;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv     = 1;
+			attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			// pid = 0 and cpu = -1: the calling thread on any CPU
+			fd[e] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+
+			if (fd[e] != -1 && leader == -1)
+				leader = fd[e];
+		}
+
+		if (leader != -1)
+		{
+			ioctl(leader, PERF_EVENT_IOC_RESET,  PERF_IOC_FLAG_GROUP);
+			ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		}
+	}
+
+	~Counters_group()
+	{
+		for (auto e = 0; e < Hardware_counters::SIZE; e++)
+			if (fd[e] != -1)
+				close(fd[e]);
+	}
+
+	bool read(Hardware_counters::values &v) const
+	{
+		v.fill(0);
+		if (leader == -1)
+			return false;
+
+		// PERF_FORMAT_GROUP layout: the number of events, the times enabled and running, then the values of the events
+		// (in the opening order)
+		uint64_t data[Hardware_counters::SIZE +3];
+		if (::read(leader, data, sizeof(data)) <= 0)
+			return false;
+
+		// the group is multiplexed with the other events of the PMU when it is not running all the time: the values are
+		// extrapolated to the whole enabled time
+		const auto time_enabled = data[1];
+		const auto time_running = data[2];
+		if (time_running == 0)
+			return true;
+		const auto scale = (double)time_enabled / (double)time_running;
+
+		auto i = 3;
+		for (auto e = 0; e < Hardware_counters::SIZE && i < (int)data[0] +3; e++)
+			if (fd[e] != -1)
+				v[e] = (uint64_t)((double)data[i++] * scale);
+
+		return true;
+	}
+};
+}
+#endif
+
+Hardware_counters
+::Hardware_counters()
+{
+}
+
+bool Hardware_counters
+::read(values &v)
+{
+#if defined(__linux__) || defined(__linux)
+	thread_local Counters_group group;
+	return group.read(v);
+#else
+	v.fill(0);
+	return false;
+#endif
+}
+
+bool Hardware_counters
+::is_available()
+{
+	values v;
+	return Hardware_counters::read(v);
+}
+
+std::string Hardware_counters
+::get_name(const event e)
+{
+	switch (e)
+	{
+		case CYCLES:        return "cycles";
+		case INSTRUCTIONS:  return "instructions";
+		case L1D_MISSES:    return "L1D misses";
+		case LLC_MISSES:    return "LLC misses";
+		case BRANCH_MISSES: return "branch misses";
+		default:            return "unknown";
+	}
+}
@@ -0,0 +1,58 @@
+/*!
+ * \file
+ * \brief Reads the hardware performance counters of the calling thread (Linux "perf_event_open").
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef HARDWARE_COUNTERS_HPP_
+#define HARDWARE_COUNTERS_HPP_
+
+#include <array>
+#include <string>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Hardware_counters
+ *
+ * \brief Reads the hardware performance counters of the calling thread (Linux "perf_event_open").
+ *
+ * The counters are opened the first time a thread reads them and they are closed when the thread ends, only the user
+ * space is counted. An event which is not supported by the CPU (or forbidden by the "perf_event_paranoid" level) is
+ * always read as 0. On the other systems all the counters are 0. When the PMU multiplexes the counters with other
+ * events, the values are extrapolated from the time the counters actually ran.
+ */
+class Hardware_counters
+{
+public:
+	enum event : uint8_t { CYCLES = 0, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, SIZE };
+
+	using values = std::array<uint64_t, SIZE>;
+
+	/*!
+	 * \brief Reads the counters of the calling thread.
+	 *
+	 * \param v: the current values of the counters.
+	 *
+	 * \return true if the counters are available.
+	 */
+	static bool read(values &v);
+
+	/*!
+	 * \brief Tells if the counters can be read on the calling thread.
+	 */
+	static bool is_available();
+
+	static std::string get_name(const event e);
+
+private:
+	Hardware_counters();
+};
+}
+}
+
+#endif /* HARDWARE_COUNTERS_HPP_ */
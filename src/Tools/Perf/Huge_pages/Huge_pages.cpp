@@ -0,0 +1,125 @@
+#if defined(__linux__) || defined(__linux)
+#include <sys/mman.h>
+#include <cstdlib>
+#include <mutex>
+#include <map>
+#endif
+#include <atomic>
+#include <sstream>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Huge_pages.hpp"
+
+using namespace aff3ct::tools;
+
+constexpr size_t Huge_pages::page_bytes;
+
+namespace
+{
+std::atomic<int> huge_pages_mode(Huge_pages::NO);
+
+#if defined(__linux__) || defined(__linux)
+// the way each huge buffer has been allocated, the mode may have changed before it is freed
+std::mutex huge_buffers_mutex;
+std::map<void*, Huge_pages::mode_t> huge_buffers;
+
+inline size_t round_up(const size_t bytes)
+{
+	return ((bytes + Huge_pages::page_bytes -1) / Huge_pages::page_bytes) * Huge_pages::page_bytes;
+}
+#endif
+}
+
+void Huge_pages
+::set_mode(const mode_t mode)
+{
+	huge_pages_mode = mode;
+}
+
+void Huge_pages
+::set_mode(const std::string &mode)
+{
+	     if (mode == "NO"      ) Huge_pages::set_mode(NO      );
+	else if (mode == "THP"     ) Huge_pages::set_mode(THP     );
+	else if (mode == "EXPLICIT") Huge_pages::set_mode(EXPLICIT);
+	else
+	{
+		std::stringstream message;
+		message << "Unknown huge pages mode ('mode' = " << mode << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+Huge_pages::mode_t Huge_pages
+::get_mode()
+{
+	return (mode_t)huge_pages_mode.load();
+}
+
+void* Huge_pages
+::allocate(const size_t bytes)
+{
+#if defined(__linux__) || defined(__linux)
+	const auto mode = Huge_pages::get_mode();
+	if (mode != NO && bytes >= page_bytes)
+	{
+		const auto mapped_bytes = round_up(bytes);
+		void *ptr = nullptr;
+		auto used_mode = NO;
+
+		if (mode == EXPLICIT)
+		{
+			ptr = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+			if (ptr != MAP_FAILED)
+				used_mode = EXPLICIT;
+			else
+				ptr = nullptr;
+		}
+
+		if (ptr == nullptr && posix_memalign(&ptr, page_bytes, mapped_bytes) == 0)
+		{
+			madvise(ptr, mapped_bytes, MADV_HUGEPAGE);
+			used_mode = THP;
+		}
+
+		if (ptr != nullptr)
+		{
+			std::lock_guard<std::mutex> lock(huge_buffers_mutex);
+			huge_buffers[ptr] = used_mode;
+			return ptr;
+		}
+	}
+#endif
+
+	return (void*)mipp::malloc<uint8_t>((uint32_t)bytes);
+}
+
+void Huge_pages
+::deallocate(void *ptr, const size_t bytes)
+{
+	if (ptr == nullptr)
+		return;
+
+#if defined(__linux__) || defined(__linux)
+	if (bytes >= page_bytes)
+	{
+		auto used_mode = NO;
+		{
+			std::lock_guard<std::mutex> lock(huge_buffers_mutex);
+			auto it = huge_buffers.find(ptr);
+			if (it != huge_buffers.end())
+			{
+				used_mode = it->second;
+				huge_buffers.erase(it);
+			}
+		}
+
+		if (used_mode == EXPLICIT) { munmap(ptr, round_up(bytes)); return; }
+		if (used_mode == THP     ) { std::free(ptr);               return; }
+	}
+#endif
+
+	mipp::free((uint8_t*)ptr);
+}
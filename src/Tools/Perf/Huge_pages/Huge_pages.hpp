@@ -0,0 +1,96 @@
+/*!
+ * \file
+ * \brief Allocates the large buffers on huge pages (Linux transparent or explicit huge pages).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef HUGE_PAGES_HPP_
+#define HUGE_PAGES_HPP_
+
+#include <cstddef>
+#include <string>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Huge_pages
+ *
+ * \brief Allocates the large buffers on huge pages (Linux transparent or explicit huge pages).
+ *
+ * The mode is common to the whole process. Only the buffers of at least one huge page (2 MB) are concerned, the
+ * smaller ones are allocated with MIPP as before (as well as all the buffers on the other systems). In the "THP" mode
+ * the buffer is aligned on a huge page and the kernel is advised to back it with transparent huge pages
+ * ("madvise"). In the "EXPLICIT" mode the buffer is mapped from the pool of huge pages reserved by the administrator
+ * ("/proc/sys/vm/nr_hugepages"), the "THP" mode is used when the pool is empty. In all cases the pages are only
+ * placed in memory when they are first written, by the thread which owns the buffer.
+ */
+class Huge_pages
+{
+public:
+	enum mode_t { NO = 0, THP, EXPLICIT };
+
+	static constexpr size_t page_bytes = 2 * 1024 * 1024;
+
+	static void   set_mode(const mode_t mode);
+	static void   set_mode(const std::string &mode);
+	static mode_t get_mode();
+
+	/*!
+	 * \brief Allocates a buffer aligned at least on the SIMD registers size.
+	 *
+	 * \param bytes: the size of the buffer in bytes.
+	 *
+	 * \return the address of the buffer.
+	 */
+	static void* allocate(const size_t bytes);
+
+	/*!
+	 * \brief Frees a buffer allocated with "allocate".
+	 *
+	 * \param ptr:   the address of the buffer.
+	 * \param bytes: the size of the buffer in bytes, the same as the one given to "allocate".
+	 */
+	static void deallocate(void *ptr, const size_t bytes);
+
+private:
+	Huge_pages();
+};
+
+/*!
+ * \class Huge_pages_allocator
+ *
+ * \brief Standard allocator on top of Huge_pages (to be used as the allocator of an std::vector).
+ */
+template <typename T>
+class Huge_pages_allocator
+{
+public:
+	using value_type = T;
+
+	Huge_pages_allocator() = default;
+	template <typename U> Huge_pages_allocator(const Huge_pages_allocator<U>&) {}
+
+	inline T* allocate(const size_t n)
+	{
+		return (T*)Huge_pages::allocate(n * sizeof(T));
+	}
+
+	inline void deallocate(T *ptr, const size_t n)
+	{
+		Huge_pages::deallocate((void*)ptr, n * sizeof(T));
+	}
+
+	template <typename U> struct rebind { using other = Huge_pages_allocator<U>; };
+};
+
+template <typename T, typename U>
+inline bool operator==(const Huge_pages_allocator<T>&, const Huge_pages_allocator<U>&) { return true;  }
+template <typename T, typename U>
+inline bool operator!=(const Huge_pages_allocator<T>&, const Huge_pages_allocator<U>&) { return false; }
+}
+}
+
+#endif /* HUGE_PAGES_HPP_ */
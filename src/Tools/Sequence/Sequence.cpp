@@ -0,0 +1,214 @@
+#include <map>
+#include <deque>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Module/Module.hpp"
+#include "Module/Socket.hpp"
+
+#include "Sequence.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static inline bool is_input(const module::Socket &s)
+{
+	return s.get_task().get_socket_type(s) != module::OUT;
+}
+
+static inline bool contains(const std::vector<module::Task*> &tasks, const module::Task *t)
+{
+	return std::find(tasks.begin(), tasks.end(), t) != tasks.end();
+}
+
+// a Task is bypassed when all its outputs have been bound on its own input data
+static bool is_bypassed(const module::Task &t)
+{
+	auto has_out = false;
+	for (auto *s_out : t.sockets)
+		if (!is_input(*s_out))
+		{
+			has_out = true;
+			if (s_out->get_bound_socket() == nullptr)
+				return false;
+
+			auto is_alias = false;
+			for (auto *s_in : t.sockets)
+				if (is_input(*s_in) && s_in->get_dataptr() == s_out->get_dataptr())
+					is_alias = true;
+
+			if (!is_alias)
+				return false;
+		}
+
+	return has_out;
+}
+
+// the Tasks bound to the outputs of 't' (+ the ordering between the consumers which update the data in place)
+static void get_successors(const module::Task &t, std::vector<std::pair<module::Task*,module::Task*>> &edges)
+{
+	for (auto *s : t.sockets)
+		if (t.get_socket_type(*s) != module::IN)
+		{
+			const auto &bss = s->get_bound_sockets();
+			for (size_t i = 0; i < bss.size(); i++)
+				if (is_input(*bss[i]))
+				{
+					edges.push_back(std::make_pair(const_cast<module::Task*>(&t), &bss[i]->get_task()));
+
+					if (bss[i]->get_task().get_socket_type(*bss[i]) == module::IN_OUT)
+						for (size_t j = i +1; j < bss.size(); j++)
+							if (is_input(*bss[j]) && &bss[j]->get_task() != &bss[i]->get_task())
+								edges.push_back(std::make_pair(&bss[i]->get_task(), &bss[j]->get_task()));
+				}
+		}
+}
+
+Sequence
+::Sequence(module::Task &first)
+{
+	this->init({&first}, {}, {});
+}
+
+Sequence
+::Sequence(module::Task &first, module::Task &last)
+{
+	this->init({&first}, {&last}, {});
+}
+
+Sequence
+::Sequence(const std::vector<module::Task*> &firsts,
+           const std::vector<module::Task*> &lasts,
+           const std::vector<module::Task*> &exclusions)
+{
+	this->init(firsts, lasts, exclusions);
+}
+
+Sequence
+::~Sequence()
+{
+}
+
+void Sequence
+::init(const std::vector<module::Task*> &firsts,
+       const std::vector<module::Task*> &lasts,
+       const std::vector<module::Task*> &exclusions)
+{
+	if (firsts.empty())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'firsts' can't be empty.");
+
+	// collect the Tasks reachable from the first ones (the last Tasks are not followed)
+	std::vector<module::Task*> reachable;
+	std::vector<std::pair<module::Task*,module::Task*>> edges;
+	std::deque<module::Task*> to_visit(firsts.begin(), firsts.end());
+	while (!to_visit.empty())
+	{
+		auto *t = to_visit.front();
+		to_visit.pop_front();
+
+		if (contains(reachable, t) || contains(exclusions, t))
+			continue;
+		reachable.push_back(t);
+
+		if (contains(lasts, t))
+			continue;
+
+		std::vector<std::pair<module::Task*,module::Task*>> t_edges;
+		get_successors(*t, t_edges);
+		for (auto &e : t_edges)
+			if (!contains(exclusions, e.second))
+			{
+				edges.push_back(e);
+				if (e.first == t)
+					to_visit.push_back(e.second);
+			}
+	}
+
+	// keep only the Tasks which lead to one of the last Tasks
+	std::vector<module::Task*> kept;
+	if (lasts.empty())
+		kept = reachable;
+	else
+	{
+		std::deque<module::Task*> to_visit_back;
+		for (auto *t : lasts)
+			if (contains(reachable, t))
+				to_visit_back.push_back(t);
+
+		while (!to_visit_back.empty())
+		{
+			auto *t = to_visit_back.front();
+			to_visit_back.pop_front();
+
+			if (contains(kept, t))
+				continue;
+			kept.push_back(t);
+
+			for (auto &e : edges)
+				if (e.second == t && contains(reachable, e.first))
+					to_visit_back.push_back(e.first);
+		}
+
+		// preserve the discovery order
+		std::vector<module::Task*> kept_ordered;
+		for (auto *t : reachable)
+			if (contains(kept, t))
+				kept_ordered.push_back(t);
+		kept = kept_ordered;
+	}
+
+	// topological sort (Kahn), the first Tasks do not wait for their inputs
+	std::map<module::Task*, int> n_in;
+	for (auto *t : kept)
+		n_in[t] = 0;
+	for (auto &e : edges)
+		if (e.first != e.second && n_in.count(e.first) && n_in.count(e.second) && !contains(firsts, e.second))
+			n_in[e.second]++;
+
+	std::vector<module::Task*> ordered;
+	std::deque<module::Task*> ready;
+	for (auto *t : kept)
+		if (n_in[t] == 0)
+			ready.push_back(t);
+
+	while (!ready.empty())
+	{
+		auto *t = ready.front();
+		ready.pop_front();
+		ordered.push_back(t);
+
+		for (auto &e : edges)
+			if (e.first == t && e.first != e.second && n_in.count(e.second) && !contains(firsts, e.second))
+				if (--n_in[e.second] == 0)
+					ready.push_back(e.second);
+	}
+
+	if (ordered.size() != kept.size())
+	{
+		std::stringstream message;
+		message << "The bound tasks contain a cycle, they can't be ordered ('ordered.size()' = " << ordered.size()
+		        << ", 'kept.size()' = " << kept.size() << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->tasks.clear();
+	this->tasks_bypassed.clear();
+	for (auto *t : ordered)
+		if (!is_bypassed(*t))
+			this->tasks.push_back(t);
+		else
+			this->tasks_bypassed.push_back(t);
+}
+
+const std::vector<module::Task*>& Sequence
+::get_tasks() const
+{
+	return this->tasks;
+}
+
+const std::vector<module::Task*>& Sequence
+::get_tasks_bypassed() const
+{
+	return this->tasks_bypassed;
+}
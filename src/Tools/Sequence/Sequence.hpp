@@ -0,0 +1,90 @@
+/*!
+ * \file
+ * \brief Flat execution plan of Tasks deduced from their bound Sockets.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SEQUENCE_HPP_
+#define SEQUENCE_HPP_
+
+#include <vector>
+
+#include "Module/Task.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Sequence
+ *
+ * \brief Flat execution plan of Tasks deduced from their bound Sockets.
+ *
+ * The Sequence walks the Socket bindings from the first Task(s) and orders the reachable Tasks topologically. If
+ * last Task(s) are given, only the Tasks between the first and the last ones are kept. The Tasks which simply forward
+ * their inputs (all their output Sockets have been bound on their own input data, which is the trick used in the
+ * simulations to bypass a "NO" module) are not executed. When several Tasks consume the same output, the binding
+ * order is preserved for the ones which update the data in place (IN_OUT Sockets).
+ *
+ * The Sequence captures the bindings at construction time, it has to be rebuilt if the Sockets are re-bound.
+ */
+class Sequence
+{
+protected:
+	std::vector<module::Task*> tasks;
+	std::vector<module::Task*> tasks_bypassed;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param first: the Task from which the bindings are followed.
+	 */
+	explicit Sequence(module::Task &first);
+
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param first: the Task from which the bindings are followed.
+	 * \param last:  the Task where the Sequence stops.
+	 */
+	Sequence(module::Task &first, module::Task &last);
+
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param firsts:     the Tasks from which the bindings are followed.
+	 * \param lasts:      the Tasks where the Sequence stops (all the reachable Tasks are kept if empty).
+	 * \param exclusions: the Tasks to ignore (they are neither executed nor followed).
+	 */
+	Sequence(const std::vector<module::Task*> &firsts,
+	         const std::vector<module::Task*> &lasts      = {},
+	         const std::vector<module::Task*> &exclusions = {});
+
+	/*!
+	 * \brief Destructor.
+	 */
+	virtual ~Sequence();
+
+	/*!
+	 * \brief Executes all the Tasks of the Sequence in order.
+	 */
+	inline void exec()
+	{
+		for (auto *t : this->tasks)
+			t->exec();
+	}
+
+	const std::vector<module::Task*>& get_tasks         () const;
+	const std::vector<module::Task*>& get_tasks_bypassed() const;
+
+private:
+	void init(const std::vector<module::Task*> &firsts,
+	          const std::vector<module::Task*> &lasts,
+	          const std::vector<module::Task*> &exclusions);
+};
+}
+}
+
+#endif /* SEQUENCE_HPP_ */
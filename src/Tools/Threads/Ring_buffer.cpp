@@ -0,0 +1,35 @@
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Ring_buffer.hpp"
+
+using namespace aff3ct::tools;
+
+Ring_buffer
+::Ring_buffer(const std::vector<size_t> &buffers_bytes, const size_t n_slots)
+: slots(n_slots), n_slots(n_slots), head(0), tail(0)
+{
+	if (n_slots == 0)
+	{
+		std::stringstream message;
+		message << "'n_slots' has to be greater than 0 ('n_slots' = " << n_slots << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto &slot : slots)
+		for (auto bytes : buffers_bytes)
+			slot.push_back(mipp::vector<uint8_t>(bytes));
+}
+
+Ring_buffer
+::~Ring_buffer()
+{
+}
+
+void Ring_buffer
+::reset()
+{
+	head.store(0);
+	tail.store(0);
+}
@@ -0,0 +1,103 @@
+/*!
+ * \file
+ * \brief Bounded lock-free queue of byte buffers between one producer thread and one consumer thread.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef RING_BUFFER_HPP
+#define RING_BUFFER_HPP
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Ring_buffer
+ *
+ * \brief Bounded lock-free queue of byte buffers between one producer thread and one consumer thread.
+ *
+ * Each slot of the ring contains a set of buffers (one per socket crossing the queue). The producer fills the slot
+ * returned by "get_slot_push" and publishes it with "push", the consumer works directly in the slot returned by
+ * "get_slot_pop" and gives it back with "pop". There is no copy on the consumer side and no lock on both sides.
+ */
+class Ring_buffer
+{
+private:
+	std::vector<std::vector<mipp::vector<uint8_t>>> slots;
+	const size_t n_slots;
+
+	// the head is only written by the producer and the tail by the consumer, keep them on different cache lines
+	alignas(64) std::atomic<size_t> head;
+	alignas(64) std::atomic<size_t> tail;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param buffers_bytes: the size (in bytes) of each buffer of a slot.
+	 * \param n_slots:       the number of slots in the ring.
+	 */
+	explicit Ring_buffer(const std::vector<size_t> &buffers_bytes, const size_t n_slots = 4);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	~Ring_buffer();
+
+	inline bool is_empty() const
+	{
+		return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+	}
+
+	inline bool is_full() const
+	{
+		return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire) == n_slots;
+	}
+
+	/*!
+	 * \brief Producer side, returns the slot to fill (the ring must not be full).
+	 */
+	inline std::vector<mipp::vector<uint8_t>>& get_slot_push()
+	{
+		return slots[head.load(std::memory_order_relaxed) % n_slots];
+	}
+
+	/*!
+	 * \brief Producer side, makes the filled slot visible to the consumer.
+	 */
+	inline void push()
+	{
+		head.store(head.load(std::memory_order_relaxed) +1, std::memory_order_release);
+	}
+
+	/*!
+	 * \brief Consumer side, returns the oldest published slot (the ring must not be empty).
+	 */
+	inline std::vector<mipp::vector<uint8_t>>& get_slot_pop()
+	{
+		return slots[tail.load(std::memory_order_relaxed) % n_slots];
+	}
+
+	/*!
+	 * \brief Consumer side, gives the slot back to the producer.
+	 */
+	inline void pop()
+	{
+		tail.store(tail.load(std::memory_order_relaxed) +1, std::memory_order_release);
+	}
+
+	/*!
+	 * \brief Drops the pending slots, no thread has to use the ring during the call.
+	 */
+	void reset();
+};
+}
+}
+
+#endif /* RING_BUFFER_HPP */
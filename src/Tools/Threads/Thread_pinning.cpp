@@ -0,0 +1,86 @@
+#if defined(__linux__) || defined(__linux)
+#include <pthread.h>
+#include <sched.h>
+#include <vector>
+#endif
+
+#include "Thread_pinning.hpp"
+
+using namespace aff3ct::tools;
+
+#if defined(__linux__) || defined(__linux)
+namespace
+{
+// the cores allowed to the process, read once before any thread is pinned
+const std::vector<int>& allowed_cores()
+{
+	static const std::vector<int> cores = []()
+	{
+		std::vector<int> cores;
+
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		if (sched_getaffinity(0, sizeof(set), &set) == 0)
+			for (auto c = 0; c < CPU_SETSIZE; c++)
+				if (CPU_ISSET(c, &set))
+					cores.push_back(c);
+
+		return cores;
+	}();
+
+	return cores;
+}
+}
+
+bool Thread_pinning
+::pin(const int puid)
+{
+	const auto &cores = allowed_cores();
+	if (cores.empty() || puid < 0)
+		return false;
+
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cores[puid % cores.size()], &set);
+
+	return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+void Thread_pinning
+::unpin()
+{
+	const auto &cores = allowed_cores();
+	if (cores.empty())
+		return;
+
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (auto c : cores)
+		CPU_SET(c, &set);
+
+	pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+int Thread_pinning
+::get_n_cores()
+{
+	return (int)allowed_cores().size();
+}
+#else
+bool Thread_pinning
+::pin(const int /*puid*/)
+{
+	return false;
+}
+
+void Thread_pinning
+::unpin()
+{
+}
+
+int Thread_pinning
+::get_n_cores()
+{
+	return 0;
+}
+#endif
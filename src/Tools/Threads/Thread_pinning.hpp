@@ -0,0 +1,53 @@
+/*!
+ * \file
+ * \brief Pins the calling thread on a logical core (Linux "pthread_setaffinity_np").
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef THREAD_PINNING_HPP_
+#define THREAD_PINNING_HPP_
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Thread_pinning
+ *
+ * \brief Pins the calling thread on a logical core (Linux "pthread_setaffinity_np").
+ *
+ * The logical cores are the ones allowed to the process when the first thread is pinned (the "taskset" or "numactl"
+ * restrictions are respected), the thread "puid" is pinned on the core "puid" modulo the number of allowed cores. As
+ * Linux places a page on the NUMA node of the thread which writes it first, a thread pinned before it allocates its
+ * data keeps them on its local memory. On the other systems the threads are not pinned.
+ */
+class Thread_pinning
+{
+public:
+	/*!
+	 * \brief Pins the calling thread.
+	 *
+	 * \param puid: the id of the processing unit, the same id always leads to the same core.
+	 *
+	 * \return true if the thread has been pinned.
+	 */
+	static bool pin(const int puid);
+
+	/*!
+	 * \brief Allows the calling thread to run on all the cores of the process again.
+	 */
+	static void unpin();
+
+	/*!
+	 * \brief Returns the number of logical cores allowed to the process (0 if it can't be known).
+	 */
+	static int get_n_cores();
+
+private:
+	Thread_pinning();
+};
+}
+}
+
+#endif /* THREAD_PINNING_HPP_ */
@@ -25,6 +25,7 @@
 #include <Tools/Math/matrix.h>
 #include <Tools/Math/utils.h>
 #include <Tools/Math/max.h>
+#include <Tools/Math/confidence_interval.h>
 
 #include <Factory/Module/Puncturer/Polar/Puncturer_polar.hpp>
 #include <Factory/Module/Puncturer/LDPC/Puncturer_LDPC.hpp>
@@ -115,17 +116,20 @@
 #include <Module/Source/AZCW/Source_AZCW.hpp>
 #include <Module/Source/Random/Source_random_fast.hpp>
 #include <Module/Source/Random/Source_random.hpp>
+#include <Module/Source/Random/Source_random_threefry.hpp>
 #include <Module/Source/User/Source_user.hpp>
 #include <Module/Quantizer/Fast/Quantizer_fast.hpp>
 #include <Module/Quantizer/Tricky/Quantizer_tricky.hpp>
 #include <Module/Quantizer/Quantizer.hpp>
 #include <Module/Quantizer/Standard/Quantizer_standard.hpp>
 #include <Module/Quantizer/NO/Quantizer_NO.hpp>
+#include <Module/Fused/BPSK_AWGN/Fused_BPSK_AWGN.hpp>
 #include <Module/Monitor/Monitor.hpp>
 #include <Module/Monitor/BFER/Monitor_BFER_reduction.hpp>
 #include <Module/Monitor/BFER/Monitor_BFER_reduction_mpi.hpp>
 #include <Module/Monitor/BFER/Monitor_BFER.hpp>
 #include <Module/Monitor/EXIT/Monitor_EXIT.hpp>
+#include <Module/Monitor/EXIT/Monitor_EXIT_reduction.hpp>
 #include <Module/SC_Module.hpp>
 #include <Module/Interleaver/Interleaver.hpp>
 #include <Module/Decoder/RSC/BCJR/Inter_intra/Decoder_RSC_BCJR_inter_intra_fast_x4_AVX.hpp>
@@ -237,7 +241,9 @@
 #include <Module/Modem/BPSK/Modem_BPSK_fast.hpp>
 #include <Module/Socket.hpp>
 #include <Module/Task.hpp>
+#include <Module/Task_timer.hpp>
 #include <Module/Channel/AWGN/Channel_AWGN_LLR.hpp>
+#include <Module/Channel/AWGN/Channel_AWGN_LLR_IS.hpp>
 #include <Module/Channel/Channel.hpp>
 #include <Module/Channel/User/Channel_user.hpp>
 #include <Module/Channel/Rayleigh/Channel_Rayleigh_LLR_user.hpp>
@@ -276,6 +282,9 @@
 #include <Launcher/Simulation/BFER_ite.hpp>
 #include <Launcher/Simulation/BFER_std.hpp>
 #include <Tools/Perf/Reorderer/Reorderer.hpp>
+#include <Tools/Perf/Hardware_counters/Hardware_counters.hpp>
+#include <Tools/Perf/Huge_pages/Huge_pages.hpp>
+#include <Tools/Perf/File_mapping/File_mapping.hpp>
 #include <Tools/Code/Polar/Frozenbits_notifier.hpp>
 #include <Tools/Code/Polar/Patterns/Pattern_polar_i.hpp>
 #include <Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp>
@@ -334,6 +343,10 @@
 #include <Tools/Exception/invalid_argument/invalid_argument.hpp>
 #include <Tools/Exception/exception.hpp>
 #include <Tools/Threads/Barrier.hpp>
+#include <Tools/Threads/Ring_buffer.hpp>
+#include <Tools/Threads/Thread_pinning.hpp>
+#include <Tools/Sequence/Sequence.hpp>
+#include <Tools/Checkpoint/Checkpoint.hpp>
 #include <Tools/Algo/Predicate_ite.hpp>
 #include <Tools/Algo/Predicate.hpp>
 #include <Tools/Algo/Tree/Binary_tree_metric.hpp>
@@ -342,11 +355,15 @@
 #include <Tools/Algo/Sparse_matrix/Sparse_matrix.hpp>
 #include <Tools/Algo/PRNG/PRNG_MT19937.hpp>
 #include <Tools/Algo/PRNG/PRNG_MT19937_simd.hpp>
+#include <Tools/Algo/PRNG/PRNG_Threefry.hpp>
 #include <Tools/Algo/Bit_packer.hpp>
+#include <Tools/Algo/Frame_partition.hpp>
 #include <Tools/Algo/Sort/LC_sorter.hpp>
 #include <Tools/Algo/Sort/LC_sorter_simd.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/MKL/Gaussian_noise_generator_MKL.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp>
+#include <Tools/Algo/Gaussian_noise_generator/Ziggurat/Gaussian_noise_generator_ziggurat.hpp>
+#include <Tools/Algo/Gaussian_noise_generator/Threefry/Gaussian_noise_generator_threefry.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/Gaussian_noise_generator.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/GSL/Gaussian_noise_generator_GSL.hpp>
 #include <Tools/Algo/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp>
@@ -368,6 +385,7 @@
 #include <Tools/Display/Terminal/EXIT/Terminal_EXIT.hpp>
 #include <Tools/Display/Statistics/Statistics.hpp>
 #include <Tools/Display/Frame_trace/Frame_trace.hpp>
+#include <Tools/Display/Timeline/Timeline.hpp>
 #include <Tools/Display/Dumper/Dumper_reduction.hpp>
 #include <Tools/Display/Dumper/Dumper.hpp>
 #include <Tools/SystemC/SC_Dummy.hpp>